@@ -0,0 +1,170 @@
+// LoopbackSerialContext による伝送路エミュレーション
+// 仮想時計上で COBS+CRC の要求・応答とログの連続送信を測定し、115200 baud と 921600 baud を比べる
+// （実時間に依存しないため、同じ条件なら毎回同じ数値になる）
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <omusubi/core/format.hpp>
+#include <omusubi/core/framing.hpp>
+#include <omusubi/platform/loopback/loopback_serial_context.hpp>
+
+using namespace omusubi;
+using namespace omusubi::platform::loopback;
+
+namespace {
+
+using Port = LoopbackSerialContext<>;
+
+constexpr uint32_t TRANSACTIONS = 500;
+constexpr uint32_t REQUEST_SIZE = 16;
+constexpr uint32_t RESPONSE_SIZE = 128;
+constexpr uint32_t LOG_FRAMES = 2000;
+constexpr uint32_t LOG_SIZE = 64;
+constexpr uint64_t TIMEOUT_NS = 100000000; // 100ms で再送
+
+struct Scenario {
+    const char* name;
+    LinkConfig link;
+};
+
+uint64_t earliest(uint64_t a, uint64_t b) {
+    return (a < b) ? a : b;
+}
+
+// 受信済みの領域をフレームデコーダへ渡す
+template <typename Decoder, typename F>
+uint32_t pump(Port& port, Decoder& decoder, F&& on_frame) {
+    uint32_t frames = 0;
+    for (span<const uint8_t> region = port.peek(); !region.empty(); region = port.peek()) {
+        frames += decoder.feed(region, on_frame);
+        port.consume(region.size());
+    }
+    return frames;
+}
+
+// ホストが要求を送り、デバイスが応答を返すまでの往復時間（停止待ち、CRC誤りは再送）
+void run_request_response(const Scenario& scenario) {
+    VirtualClock clock;
+    Port host(clock);
+    Port device(clock);
+    host.link(device);
+    host.set_link_config(scenario.link);
+    LinkConfig reverse = scenario.link;
+    reverse.seed += 1;
+    device.set_link_config(reverse);
+    (void)host.connect();
+    (void)device.connect();
+
+    CobsEncoder host_encoder(host);
+    CobsEncoder device_encoder(device);
+    CobsDecoder<REQUEST_SIZE> device_decoder;
+    CobsDecoder<RESPONSE_SIZE> host_decoder;
+    const uint8_t request[REQUEST_SIZE] = {1};
+    const uint8_t response[RESPONSE_SIZE] = {2};
+
+    static uint64_t rtt[TRANSACTIONS];
+    uint32_t retries = 0;
+    for (uint32_t i = 0; i < TRANSACTIONS; ++i) {
+        const uint64_t start = clock.now_ns();
+        bool answered = false;
+        while (!answered) {
+            host_encoder.write_frame(span<const uint8_t>(request));
+            const uint64_t deadline = clock.now_ns() + TIMEOUT_NS;
+
+            while (!answered) {
+                const uint64_t next = earliest(host.next_arrival_ns(), device.next_arrival_ns());
+                if (next > deadline) {
+                    clock.advance_to(deadline);
+                    ++retries;
+                    break;
+                }
+                clock.advance_to(next);
+                pump(device, device_decoder, [&](span<const uint8_t>) { device_encoder.write_frame(span<const uint8_t>(response)); });
+                answered = pump(host, host_decoder, [](span<const uint8_t>) {}) > 0;
+            }
+        }
+        rtt[i] = clock.now_ns() - start;
+
+        // 遅れて届いた重複応答を捨てる
+        clock.advance_ms(1);
+        clock.advance_to(std::max(host.tx_idle_ns(), device.tx_idle_ns()));
+        while (host.next_arrival_ns() != Port::NO_ARRIVAL || device.next_arrival_ns() != Port::NO_ARRIVAL) {
+            clock.advance_to(earliest(host.next_arrival_ns(), device.next_arrival_ns()));
+        }
+        (void)host.consume(host.available());
+        (void)device.consume(device.available());
+        host_decoder.reset();
+        device_decoder.reset();
+    }
+
+    std::sort(rtt, rtt + TRANSACTIONS);
+    std::cout << format<160>("  {:<24} rtt p50={:>6}us p99={:>6}us  retries={}\n", scenario.name, rtt[TRANSACTIONS / 2] / 1000, rtt[TRANSACTIONS * 99 / 100] / 1000, retries).c_str();
+}
+
+// デバイスがログフレームを送り続けたときのペイロードのスループット
+void run_log_stream(const Scenario& scenario) {
+    VirtualClock clock;
+    Port host(clock);
+    Port device(clock);
+    device.link(host);
+    device.set_link_config(scenario.link);
+    (void)host.connect();
+    (void)device.connect();
+
+    CobsEncoder encoder(device);
+    CobsDecoder<LOG_SIZE> decoder;
+    uint8_t record[LOG_SIZE];
+    for (uint32_t i = 0; i < LOG_SIZE; ++i) {
+        record[i] = static_cast<uint8_t>('a' + i % 26);
+    }
+
+    uint32_t received = 0;
+    for (uint32_t i = 0; i < LOG_FRAMES; ++i) {
+        // 送信路が空くのを待ってから次のフレームを書く（UARTの送信完了割り込み相当）
+        clock.advance_to(device.tx_idle_ns());
+        encoder.write_frame(span<const uint8_t>(record));
+        received += pump(host, decoder, [](span<const uint8_t>) {});
+    }
+    while (host.next_arrival_ns() != Port::NO_ARRIVAL) {
+        clock.advance_to(host.next_arrival_ns());
+        received += pump(host, decoder, [](span<const uint8_t>) {});
+    }
+
+    const uint64_t ns = clock.now_ns();
+    const auto bytes_per_second = static_cast<uint32_t>(static_cast<uint64_t>(received) * LOG_SIZE * 1000000000ULL / ns);
+    const uint32_t line_rate = scenario.link.baud_rate / Port::BITS_PER_BYTE;
+    std::cout << format<160>("  {:<24} {:>6} B/s ({:>3}% of line)  frames={}/{}  crc_errors={}\n", scenario.name, bytes_per_second, static_cast<uint32_t>(bytes_per_second * 100ULL / line_rate), received, LOG_FRAMES,
+                             decoder.get_stats().crc_errors)
+                     .c_str();
+}
+
+} // namespace
+
+int main() {
+    const Scenario scenarios[] = {
+        {"115200 ideal", {115200, 0, 0, 0.0, 1}},
+        {"115200 usb-serial", {115200, 1000, 1000, 0.0, 1}},
+        {"115200 noisy (1e-5)", {115200, 1000, 1000, 1e-5, 1}},
+        {"921600 ideal", {921600, 0, 0, 0.0, 1}},
+        {"921600 usb-serial", {921600, 1000, 1000, 0.0, 1}},
+        {"921600 noisy (1e-5)", {921600, 1000, 1000, 1e-5, 1}},
+    };
+
+    const auto wall_start = std::chrono::steady_clock::now();
+
+    std::cout << "=== Link Emulation (virtual clock) ===\n\n";
+    std::cout << format<96>("Request/response ({} B → {} B, COBS+CRC, {} transactions)\n", REQUEST_SIZE, RESPONSE_SIZE, TRANSACTIONS).c_str();
+    for (const Scenario& scenario : scenarios) {
+        run_request_response(scenario);
+    }
+
+    std::cout << format<96>("\nLog stream ({} B records, {} frames)\n", LOG_SIZE, LOG_FRAMES).c_str();
+    for (const Scenario& scenario : scenarios) {
+        run_log_stream(scenario);
+    }
+
+    const auto wall_ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - wall_start).count();
+    std::cout << format<96>("\nsimulated in {} ms (wall clock)\n", static_cast<uint32_t>(wall_ms)).c_str();
+    return 0;
+}
@@ -0,0 +1,129 @@
+// MpmcQueue ベンチマーク
+// 生産者・消費者スレッド数 1/2/4/8 でのスループットとレイテンシを計測する
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <omusubi/core/format.hpp>
+#include <omusubi/core/mpmc_queue.hpp>
+#include <thread>
+
+using namespace omusubi;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr uint32_t QUEUE_CAPACITY = 1024;
+constexpr uint32_t TOTAL_ITEMS = 1U << 20;
+constexpr uint32_t BATCH_SIZE = 16;
+constexpr uint32_t MAX_THREADS = 8;
+constexpr uint32_t SAMPLE_INTERVAL = 64; // レイテンシは64要素に1回サンプリング
+constexpr uint32_t MAX_SAMPLES = TOTAL_ITEMS / SAMPLE_INTERVAL;
+
+// 要素は投入時刻（ナノ秒）
+MpmcQueue<uint64_t, QUEUE_CAPACITY> queue;
+
+uint64_t samples[MAX_SAMPLES];
+std::atomic<uint32_t> sample_count {0};
+
+uint64_t now_ns() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now().time_since_epoch()).count());
+}
+
+void produce(uint32_t items, uint32_t batch_size) {
+    uint64_t batch[BATCH_SIZE];
+    uint32_t sent = 0;
+
+    while (sent < items) {
+        const uint32_t n = std::min(batch_size, items - sent);
+        const uint64_t timestamp = now_ns();
+        for (uint32_t i = 0; i < n; ++i) {
+            batch[i] = timestamp;
+        }
+
+        uint32_t pushed = 0;
+        while (pushed < n) {
+            const uint32_t count = queue.push(span<const uint64_t>(batch + pushed, n - pushed));
+            if (count == 0) {
+                std::this_thread::yield();
+            }
+            pushed += count;
+        }
+        sent += n;
+    }
+}
+
+void consume(std::atomic<uint32_t>& received, uint32_t batch_size) {
+    uint64_t batch[BATCH_SIZE];
+    uint32_t local_count = 0;
+
+    while (received.load(std::memory_order_relaxed) < TOTAL_ITEMS) {
+        const uint32_t n = queue.pop(span<uint64_t>(batch, batch_size));
+        if (n == 0) {
+            std::this_thread::yield();
+            continue;
+        }
+
+        const uint64_t now = now_ns();
+        for (uint32_t i = 0; i < n; ++i) {
+            if (++local_count % SAMPLE_INTERVAL == 0) {
+                const uint32_t index = sample_count.fetch_add(1, std::memory_order_relaxed);
+                if (index < MAX_SAMPLES) {
+                    samples[index] = now - batch[i];
+                }
+            }
+        }
+        received.fetch_add(n, std::memory_order_relaxed);
+    }
+}
+
+void run(uint32_t threads, uint32_t batch_size) {
+    std::atomic<uint32_t> received {0};
+    sample_count.store(0);
+
+    std::thread producers[MAX_THREADS];
+    std::thread consumers[MAX_THREADS];
+    const uint32_t per_producer = TOTAL_ITEMS / threads;
+
+    const auto start = Clock::now();
+
+    for (uint32_t i = 0; i < threads; ++i) {
+        consumers[i] = std::thread(consume, std::ref(received), batch_size);
+    }
+    for (uint32_t i = 0; i < threads; ++i) {
+        producers[i] = std::thread(produce, per_producer, batch_size);
+    }
+    for (uint32_t i = 0; i < threads; ++i) {
+        producers[i].join();
+        consumers[i].join();
+    }
+
+    const auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - start).count();
+    const auto throughput = static_cast<uint32_t>(static_cast<double>(TOTAL_ITEMS) / (static_cast<double>(elapsed) / 1e6) / 1000.0);
+
+    const uint32_t count = std::min(sample_count.load(), MAX_SAMPLES);
+    std::sort(samples, samples + count);
+    const uint64_t p50 = (count > 0) ? samples[count / 2] : 0;
+    const uint64_t p99 = (count > 0) ? samples[count * 99 / 100] : 0;
+
+    std::cout << format<96>("{:>3}P/{:>3}C  batch={:>2}  {:>8} kops/s  p50={:>8}ns  p99={:>10}ns\n", threads, threads, batch_size, throughput, p50, p99).c_str();
+}
+
+} // namespace
+
+int main() {
+    std::cout << "=== MpmcQueue Benchmark ===\n";
+    std::cout << format<64>("capacity={}, items={}, cores={}\n\n", QUEUE_CAPACITY, TOTAL_ITEMS, std::thread::hardware_concurrency()).c_str();
+
+    for (uint32_t batch_size : {1U, BATCH_SIZE}) {
+        for (uint32_t threads : {1U, 2U, 4U, 8U}) {
+            run(threads, batch_size);
+        }
+        std::cout << "\n";
+    }
+
+    std::cout << "レイテンシは投入から取り出しまでの時間（1バッチ内の要素は同じ投入時刻）\n";
+    return 0;
+}
@@ -0,0 +1,190 @@
+// 時系列圧縮ベンチマーク
+// 100Hz の加速度センサー（Vector3）の記録を 50 サンプルのパケットに分けて符号化し、
+// 1サンプルあたりのバイト数と符号化の速度を比較する
+
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <omusubi/core/format.hpp>
+#include <omusubi/core/timeseries.hpp>
+#include <omusubi/core/types.h>
+#include <omusubi/core/varint.hpp>
+
+using namespace omusubi;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr uint32_t SAMPLE_COUNT = 6000;      // 100Hz で60秒
+constexpr uint32_t PACKET_SAMPLES = 50;      // 1パケット0.5秒分
+constexpr uint32_t REPEAT = 20;              // 速度計測の繰り返し回数
+constexpr float LSB = 9.80665F * 4.0F / 65536.0F; // ±2g・16ビットの分解能（m/s^2）
+constexpr uint32_t RAW_SAMPLE_SIZE = sizeof(uint32_t) + sizeof(Vector3);
+
+struct Trace {
+    const char* name;
+    uint32_t timestamps[SAMPLE_COUNT];
+    Vector3 values[SAMPLE_COUNT];
+};
+
+Trace traces[3];
+
+// 再現性のある疑似乱数（センサーノイズ用）
+uint32_t random_state = 12345;
+
+float noise(float amplitude) {
+    random_state = random_state * 1664525U + 1013904223U;
+    return amplitude * (static_cast<float>(random_state >> 8) / 16777216.0F - 0.5F);
+}
+
+float quantize(float value) {
+    return std::round(value / LSB) * LSB;
+}
+
+// 静止・歩行・振動の記録を模した波形（ADCの分解能に量子化、タイマーのジッタあり）
+void record(Trace& trace, const char* name, float motion, float frequency, float noise_amplitude) {
+    trace.name = name;
+    uint32_t t = 3000;
+    for (uint32_t i = 0; i < SAMPLE_COUNT; ++i) {
+        t += (i % 97 == 0) ? 11 : 10;
+        const float phase = 2.0F * 3.14159265F * frequency * static_cast<float>(i) / 100.0F;
+        trace.timestamps[i] = t;
+        trace.values[i] = Vector3(quantize(0.3F * motion * std::sin(phase) + noise(noise_amplitude)),
+                                  quantize(0.5F * motion * std::cos(phase * 0.5F) + noise(noise_amplitude)),
+                                  quantize(9.80665F + motion * std::sin(phase * 2.0F) + noise(noise_amplitude)));
+    }
+}
+
+// 時刻は delta-of-delta、各軸は XOR 符号化
+uint32_t encode_xor(const Trace& trace, uint32_t first, FixedBuffer<1024>& packet) {
+    packet.clear();
+    FixedBuffer<256> time_part;
+    FixedBuffer<256> axis_part[3];
+    TimestampEncoder timestamps(time_part);
+    XorFloatEncoder x(axis_part[0]);
+    XorFloatEncoder y(axis_part[1]);
+    XorFloatEncoder z(axis_part[2]);
+
+    for (uint32_t i = first; i < first + PACKET_SAMPLES; ++i) {
+        timestamps.append(trace.timestamps[i]);
+        x.append(trace.values[i].x);
+        y.append(trace.values[i].y);
+        z.append(trace.values[i].z);
+    }
+
+    // 各部分の長さを varint で前置する
+    const uint32_t sizes[4] = {timestamps.finish().value_or(0), x.finish().value_or(0), y.finish().value_or(0), z.finish().value_or(0)};
+    for (uint32_t size : sizes) {
+        append_varint(packet, size);
+    }
+    packet.append(span<const uint8_t>(time_part.data(), time_part.size()));
+    for (const auto& part : axis_part) {
+        packet.append(part.as_span());
+    }
+    return packet.size();
+}
+
+// 時刻は delta-of-delta、各軸は ADC 値の差分を ZigZag + varint
+uint32_t encode_counts(const Trace& trace, uint32_t first, FixedBuffer<1024>& packet) {
+    packet.clear();
+    FixedBuffer<256> time_part;
+    TimestampEncoder timestamps(time_part);
+    int32_t previous[3] = {0, 0, 0};
+
+    for (uint32_t i = first; i < first + PACKET_SAMPLES; ++i) {
+        timestamps.append(trace.timestamps[i]);
+    }
+    append_varint(packet, timestamps.finish().value_or(0));
+    packet.append(span<const uint8_t>(time_part.data(), time_part.size()));
+
+    for (uint32_t i = first; i < first + PACKET_SAMPLES; ++i) {
+        const float axes[3] = {trace.values[i].x, trace.values[i].y, trace.values[i].z};
+        for (uint32_t a = 0; a < 3; ++a) {
+            const auto counts = static_cast<int32_t>(std::lround(axes[a] / LSB));
+            append_signed_varint(packet, counts - previous[a]);
+            previous[a] = counts;
+        }
+    }
+    return packet.size();
+}
+
+// XOR 符号化したパケットを復号して元の値と照合する
+bool decode_xor(const Trace& trace, uint32_t first, const FixedBuffer<1024>& packet) {
+    VarintReader header(packet.as_span());
+    uint32_t sizes[4];
+    for (uint32_t& size : sizes) {
+        size = static_cast<uint32_t>(header.read_unsigned().value_or(0));
+    }
+
+    const uint8_t* data = packet.data() + header.position();
+    TimestampDecoder timestamps(span<const uint8_t>(data, sizes[0]), PACKET_SAMPLES);
+    data += sizes[0];
+    XorFloatDecoder<float> axes[3] = {
+        XorFloatDecoder<float>(span<const uint8_t>(data, sizes[1]), PACKET_SAMPLES),
+        XorFloatDecoder<float>(span<const uint8_t>(data + sizes[1], sizes[2]), PACKET_SAMPLES),
+        XorFloatDecoder<float>(span<const uint8_t>(data + sizes[1] + sizes[2], sizes[3]), PACKET_SAMPLES),
+    };
+
+    bool ok = true;
+    for (uint32_t i = first; i < first + PACKET_SAMPLES; ++i) {
+        ok &= timestamps.next().value_or(0) == trace.timestamps[i];
+        ok &= axes[0].next().value_or(NAN) == trace.values[i].x;
+        ok &= axes[1].next().value_or(NAN) == trace.values[i].y;
+        ok &= axes[2].next().value_or(NAN) == trace.values[i].z;
+    }
+    return ok;
+}
+
+template <typename Encode>
+void run(const Trace& trace, const char* method, Encode encode) {
+    FixedBuffer<1024> packet;
+    uint64_t total = 0;
+    for (uint32_t first = 0; first < SAMPLE_COUNT; first += PACKET_SAMPLES) {
+        total += encode(trace, first, packet);
+    }
+
+    const auto start = Clock::now();
+    for (uint32_t r = 0; r < REPEAT; ++r) {
+        for (uint32_t first = 0; first < SAMPLE_COUNT; first += PACKET_SAMPLES) {
+            encode(trace, first, packet);
+        }
+    }
+    const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count();
+    const auto ns_per_sample = static_cast<uint32_t>(elapsed / (static_cast<int64_t>(SAMPLE_COUNT) * REPEAT));
+
+    const auto centi_bytes = static_cast<uint32_t>(total * 100 / SAMPLE_COUNT);
+    const auto ratio = static_cast<uint32_t>(static_cast<uint64_t>(SAMPLE_COUNT) * RAW_SAMPLE_SIZE * 100 / total);
+    std::cout << format<128>("{:<8} {:<16} {:>3}.{:0>2} B/sample  x{}.{:0>2}  {:>5} ns/sample\n", trace.name, method, centi_bytes / 100, centi_bytes % 100, ratio / 100, ratio % 100, ns_per_sample).c_str();
+}
+
+} // namespace
+
+int main() {
+    std::cout << "=== Time Series Compression Benchmark ===\n";
+    std::cout << format<96>("samples={} (100Hz), packet={} samples, raw={} B/sample\n\n", SAMPLE_COUNT, PACKET_SAMPLES, RAW_SAMPLE_SIZE).c_str();
+
+    record(traces[0], "still", 0.0F, 0.0F, 6.0F * LSB);
+    record(traces[1], "walking", 2.0F, 1.8F, 40.0F * LSB);
+    record(traces[2], "vibrate", 0.5F, 23.0F, 200.0F * LSB);
+
+    for (const Trace& trace : traces) {
+        bool verified = true;
+        FixedBuffer<1024> packet;
+        for (uint32_t first = 0; first < SAMPLE_COUNT; first += PACKET_SAMPLES) {
+            encode_xor(trace, first, packet);
+            verified &= decode_xor(trace, first, packet);
+        }
+        if (!verified) {
+            std::cout << format<64>("{}: XOR decode mismatch\n", trace.name).c_str();
+            return 1;
+        }
+
+        run(trace, "dod+xor", encode_xor);
+        run(trace, "dod+zigzag", encode_counts);
+        std::cout << "\n";
+    }
+
+    std::cout << "xor はセンサー値を float のまま、zigzag は ADC 値の差分を varint で符号化\n";
+    return 0;
+}
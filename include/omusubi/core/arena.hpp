@@ -0,0 +1,222 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <omusubi/core/scope_exit.hpp>
+#include <omusubi/core/span.hpp>
+#include <string_view>
+#include <type_traits>
+
+namespace omusubi {
+
+/**
+ * @brief 呼び出し側が用意したメモリ上のモノトニックアリーナ
+ *
+ * span<uint8_t> の先頭から順にアライン済みのブロックを切り出す（バンプアロケーション）。
+ * 個別の解放は行わず、mark() で記録した位置へ rewind() することで
+ * それ以降に確保したメモリをまとめて O(1) で回収する。断片化は発生しない。
+ *
+ * フレーム単位の一時データ（解析済みフィールド、作業用配列、整形済み文字列など）向け。
+ *
+ * @note デストラクタは呼ばれないため、create() / allocate_array() で生成できるのは
+ *       トリビアルに破棄可能な型のみ。
+ * @note スレッドセーフではない
+ *
+ * @par 使用例
+ * @code
+ * static uint8_t scratch_memory[4096];
+ * Arena arena {span<uint8_t>(scratch_memory)};
+ *
+ * void on_frame(span<const uint8_t> frame) {
+ *     auto scope = arena.scope();  // スコープ終了時にこの位置へ巻き戻す
+ *
+ *     span<Field> fields = arena.allocate_array<Field>(16);
+ *     std::string_view name = arena.copy_string(extract_name(frame));
+ *     // ...
+ * }
+ * @endcode
+ */
+class Arena {
+public:
+    /**
+     * @brief 巻き戻し位置
+     */
+    struct Marker {
+        size_t offset;
+    };
+
+    /**
+     * @brief scope_exit から呼ばれる巻き戻し処理
+     */
+    class Rewinder {
+    public:
+        Rewinder(Arena* arena, Marker marker) noexcept : arena_(arena), marker_(marker) {}
+
+        void operator()() const noexcept { arena_->rewind(marker_); }
+
+    private:
+        Arena* arena_;
+        Marker marker_;
+    };
+
+    /**
+     * @brief メモリ領域を指定して構築
+     */
+    explicit Arena(span<uint8_t> memory) noexcept : base_(memory.data()), capacity_(memory.size()) {}
+
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+    Arena(Arena&&) = delete;
+    Arena& operator=(Arena&&) = delete;
+    ~Arena() noexcept = default;
+
+    /**
+     * @brief 総容量（バイト）を取得
+     */
+    [[nodiscard]] size_t capacity() const noexcept { return capacity_; }
+
+    /**
+     * @brief 使用中のバイト数を取得（アライメントの詰め物を含む）
+     */
+    [[nodiscard]] size_t used() const noexcept { return offset_; }
+
+    /**
+     * @brief 残りのバイト数を取得
+     */
+    [[nodiscard]] size_t remaining() const noexcept { return capacity_ - offset_; }
+
+    /**
+     * @brief 使用量の最大値を取得
+     */
+    [[nodiscard]] size_t high_water_mark() const noexcept { return high_water_mark_; }
+
+    /**
+     * @brief アライン済みのブロックを確保
+     *
+     * @param size バイト数
+     * @param alignment アライメント（2の累乗）
+     * @return ブロックの先頭（容量不足の場合nullptr）
+     */
+    [[nodiscard]] void* allocate(size_t size, size_t alignment = alignof(std::max_align_t)) noexcept {
+        const auto address = reinterpret_cast<uintptr_t>(base_) + offset_;
+        const size_t padding = (alignment - (address & (alignment - 1))) & (alignment - 1);
+
+        if (padding > remaining() || size > remaining() - padding) {
+            return nullptr;
+        }
+
+        uint8_t* block = base_ + offset_ + padding;
+        offset_ += padding + size;
+        if (offset_ > high_water_mark_) {
+            high_water_mark_ = offset_;
+        }
+
+        return block;
+    }
+
+    /**
+     * @brief オブジェクトを1つ生成
+     *
+     * @return 生成したオブジェクト（容量不足の場合nullptr）
+     */
+    template <typename T, typename... Args>
+    // NOLINTNEXTLINE(cppcoreguidelines-missing-std-forward)
+    [[nodiscard]] T* create(Args&&... args) noexcept {
+        static_assert(std::is_trivially_destructible_v<T>, "Arena objects are never destroyed; T must be trivially destructible");
+
+        void* memory = allocate(sizeof(T), alignof(T));
+        if (memory == nullptr) {
+            return nullptr;
+        }
+
+        return new (memory) T(static_cast<Args&&>(args)...);
+    }
+
+    /**
+     * @brief 値初期化した配列を確保
+     *
+     * @return 確保した配列（容量不足の場合は空のspan）
+     */
+    template <typename T>
+    [[nodiscard]] span<T> allocate_array(size_t count) noexcept {
+        static_assert(std::is_trivially_destructible_v<T>, "Arena objects are never destroyed; T must be trivially destructible");
+
+        if (count > remaining() / sizeof(T)) {
+            return span<T>();
+        }
+
+        void* memory = allocate(sizeof(T) * count, alignof(T));
+        if (memory == nullptr) {
+            return span<T>();
+        }
+
+        T* array = static_cast<T*>(memory);
+        for (size_t i = 0; i < count; ++i) {
+            new (array + i) T();
+        }
+
+        return span<T>(array, count);
+    }
+
+    /**
+     * @brief 文字列をアリーナへコピー（null終端付き）
+     *
+     * @return コピーした文字列（容量不足の場合は空）
+     */
+    [[nodiscard]] std::string_view copy_string(std::string_view str) noexcept {
+        auto* buffer = static_cast<char*>(allocate(str.size() + 1, 1));
+        if (buffer == nullptr) {
+            return std::string_view {};
+        }
+
+        for (size_t i = 0; i < str.size(); ++i) {
+            buffer[i] = str[i];
+        }
+        buffer[str.size()] = '\0';
+
+        return std::string_view {buffer, str.size()};
+    }
+
+    /**
+     * @brief 現在の位置を記録
+     */
+    [[nodiscard]] Marker mark() const noexcept { return Marker {offset_}; }
+
+    /**
+     * @brief 記録した位置へ巻き戻す
+     *
+     * marker 以降に確保したメモリはすべて無効になる。
+     */
+    void rewind(Marker marker) noexcept {
+        if (marker.offset <= offset_) {
+            offset_ = marker.offset;
+        }
+    }
+
+    /**
+     * @brief 現在の位置を記録し、スコープ終了時に巻き戻す scope_exit を返す
+     *
+     * @par 使用例
+     * @code
+     * {
+     *     auto scope = arena.scope();
+     *     auto* temp = arena.create<Header>();
+     * }  // ここで temp の領域が回収される
+     * @endcode
+     */
+    [[nodiscard]] scope_exit<Rewinder> scope() noexcept { return scope_exit<Rewinder>(Rewinder(this, mark())); }
+
+    /**
+     * @brief すべて回収
+     */
+    void reset() noexcept { offset_ = 0; }
+
+private:
+    uint8_t* base_;
+    size_t capacity_;
+    size_t offset_ = 0;
+    size_t high_water_mark_ = 0;
+};
+
+} // namespace omusubi
@@ -0,0 +1,822 @@
+#pragma once
+
+#include <cfloat>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <omusubi/core/fixed_buffer.hpp>
+#include <omusubi/core/result.hpp>
+#include <omusubi/core/span.hpp>
+#include <omusubi/core/types.h>
+#include <omusubi/interface/writable.h>
+#include <string_view>
+#include <type_traits>
+
+namespace omusubi {
+
+/**
+ * @brief CBOR データ項目の種類
+ */
+enum class CborType : uint8_t {
+    UNSIGNED,   ///< 非負整数（メジャータイプ0）
+    NEGATIVE,   ///< 負の整数（メジャータイプ1）
+    BYTES,      ///< バイト列（メジャータイプ2）
+    TEXT,       ///< UTF-8文字列（メジャータイプ3）
+    ARRAY,      ///< 配列（メジャータイプ4）
+    MAP,        ///< マップ（メジャータイプ5）
+    TAG,        ///< タグ（メジャータイプ6）
+    BOOL,       ///< true / false
+    NULL_VALUE, ///< null
+    UNDEFINED,  ///< undefined
+    FLOAT,      ///< 半精度・単精度・倍精度浮動小数点数
+    SIMPLE      ///< その他の単純値
+};
+
+namespace detail {
+
+inline constexpr uint8_t CBOR_UNSIGNED = 0;
+inline constexpr uint8_t CBOR_NEGATIVE = 1;
+inline constexpr uint8_t CBOR_BYTES = 2;
+inline constexpr uint8_t CBOR_TEXT = 3;
+inline constexpr uint8_t CBOR_ARRAY = 4;
+inline constexpr uint8_t CBOR_MAP = 5;
+inline constexpr uint8_t CBOR_TAG = 6;
+inline constexpr uint8_t CBOR_SIMPLE = 7;
+
+inline constexpr uint8_t CBOR_FALSE = 0xF4;
+inline constexpr uint8_t CBOR_TRUE = 0xF5;
+inline constexpr uint8_t CBOR_NULL = 0xF6;
+inline constexpr uint8_t CBOR_HALF = 0xF9;
+inline constexpr uint8_t CBOR_SINGLE = 0xFA;
+inline constexpr uint8_t CBOR_DOUBLE = 0xFB;
+
+/**
+ * @brief 項目のヘッダ（先頭バイトと引数）を書き込む
+ *
+ * @return ヘッダのバイト数（1, 2, 3, 5, 9）
+ */
+[[nodiscard]] inline uint32_t cbor_encode_head(uint8_t* out, uint8_t major, uint64_t argument) noexcept {
+    const auto type = static_cast<uint8_t>(major << 5);
+
+    if (argument < 24) {
+        out[0] = static_cast<uint8_t>(type | argument);
+        return 1;
+    }
+
+    uint32_t bytes = 8;
+    uint8_t info = 27;
+    if (argument <= 0xFFU) {
+        bytes = 1;
+        info = 24;
+    } else if (argument <= 0xFFFFU) {
+        bytes = 2;
+        info = 25;
+    } else if (argument <= 0xFFFFFFFFU) {
+        bytes = 4;
+        info = 26;
+    }
+
+    out[0] = static_cast<uint8_t>(type | info);
+    for (uint32_t i = 0; i < bytes; ++i) {
+        out[bytes - i] = static_cast<uint8_t>(argument >> (8 * i));
+    }
+    return bytes + 1;
+}
+
+/**
+ * @brief float が半精度で正確に表せる場合、その半精度のビット列を求める
+ *
+ * @return 正確に表せない場合false
+ */
+[[nodiscard]] inline bool cbor_float_to_half(float value, uint16_t& half) noexcept {
+    uint32_t bits = 0;
+    std::memcpy(&bits, &value, sizeof(bits));
+
+    const auto sign = static_cast<uint16_t>((bits >> 16) & 0x8000U);
+    const uint32_t exponent = (bits >> 23) & 0xFFU;
+    const uint32_t mantissa = bits & 0x7FFFFFU;
+
+    if (exponent == 0xFF) {
+        // 無限大・NaN（仮数の下位13bitが0のもの）
+        if ((mantissa & 0x1FFFU) != 0) {
+            return false;
+        }
+        half = static_cast<uint16_t>(sign | 0x7C00U | (mantissa >> 13));
+        return true;
+    }
+
+    if (exponent == 0) {
+        // ±0 のみ（単精度の非正規化数は半精度の範囲外）
+        if (mantissa != 0) {
+            return false;
+        }
+        half = sign;
+        return true;
+    }
+
+    const int32_t e = static_cast<int32_t>(exponent) - 127;
+
+    if (e >= -14 && e <= 15) {
+        if ((mantissa & 0x1FFFU) != 0) {
+            return false;
+        }
+        half = static_cast<uint16_t>(sign | (static_cast<uint32_t>(e + 15) << 10) | (mantissa >> 13));
+        return true;
+    }
+
+    if (e >= -24 && e < -14) {
+        // 半精度の非正規化数
+        const uint32_t significand = 0x800000U | mantissa;
+        const auto shift = static_cast<uint32_t>(-1 - e);
+        if ((significand & ((1U << shift) - 1)) != 0) {
+            return false;
+        }
+        half = static_cast<uint16_t>(sign | (significand >> shift));
+        return true;
+    }
+
+    return false;
+}
+
+/**
+ * @brief 半精度のビット列を float に変換
+ */
+[[nodiscard]] inline float cbor_half_to_float(uint16_t half) noexcept {
+    const uint32_t sign = static_cast<uint32_t>(half & 0x8000U) << 16;
+    const uint32_t exponent = (half >> 10) & 0x1FU;
+    uint32_t mantissa = half & 0x3FFU;
+    uint32_t bits = 0;
+
+    if (exponent == 0x1F) {
+        bits = sign | 0x7F800000U | (mantissa << 13);
+    } else if (exponent != 0) {
+        bits = sign | ((exponent + 112) << 23) | (mantissa << 13);
+    } else if (mantissa == 0) {
+        bits = sign;
+    } else {
+        // 非正規化数を正規化する
+        uint32_t e = 113;
+        while ((mantissa & 0x400U) == 0) {
+            mantissa <<= 1;
+            --e;
+        }
+        bits = sign | (e << 23) | ((mantissa & 0x3FFU) << 13);
+    }
+
+    float value = 0.0F;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+/**
+ * @brief FixedBuffer にヘッダとペイロードを追加
+ */
+template <uint32_t Capacity>
+[[nodiscard]] Error cbor_emit(FixedBuffer<Capacity>& sink, span<const uint8_t> head, span<const uint8_t> payload) noexcept {
+    if (head.size() + payload.size() > sink.capacity() - sink.size()) {
+        return Error::BUFFER_FULL;
+    }
+    sink.append(head);
+    sink.append(payload);
+    return Error::OK;
+}
+
+/**
+ * @brief ByteWritable にヘッダとペイロードを書き込む（ペイロードはコピーせずギャザー書き込み）
+ */
+[[nodiscard]] inline Error cbor_emit(ByteWritable& sink, span<const uint8_t> head, span<const uint8_t> payload) noexcept {
+    size_t written = 0;
+    if (payload.empty()) {
+        written = sink.write(head);
+    } else {
+        const span<const uint8_t> parts[] = {head, payload};
+        written = sink.writev(span<const span<const uint8_t>>(parts));
+    }
+    return (written == head.size() + payload.size()) ? Error::OK : Error::WRITE_FAILED;
+}
+
+template <typename T>
+struct IsByteType : std::integral_constant<bool, std::is_same_v<std::remove_cv_t<T>, uint8_t>> {};
+
+template <typename T>
+struct IsCharType : std::integral_constant<bool, std::is_same_v<std::remove_cv_t<T>, char>> {};
+
+} // namespace detail
+
+/**
+ * @brief CBOR（RFC 8949）エンコーダ
+ *
+ * FixedBuffer<N> または ByteWritable に直接書き込む。動的メモリ確保なし。
+ * 値の型から符号化を決める（write(value)）。
+ *
+ * | C++ の型 | CBOR |
+ * |---|---|
+ * | bool | true / false |
+ * | 整数型 | 非負整数 / 負の整数（最短の長さ） |
+ * | float / double | 値を正確に表せる最短の浮動小数点数（半精度・単精度・倍精度） |
+ * | std::string_view / 文字列リテラル / span<const char> | UTF-8文字列 |
+ * | span<const uint8_t> | バイト列 |
+ * | span<const T> | T の配列 |
+ * | Vector3 | 単精度3要素の配列 |
+ *
+ * 書き込みに失敗すると以降の書き込みは無視され、finish() がエラーを返す。
+ * ByteWritable への出力では、文字列・バイト列のペイロードをヘッダとともに writev() で送るためコピーしない。
+ *
+ * @tparam Sink FixedBuffer<N> または ByteWritable を継承した型
+ *
+ * @par 使用例
+ * @code
+ * FixedBuffer<64> packet;
+ * CborWriter writer(packet);
+ * writer.write_map_header(3);
+ * writer.write("t");
+ * writer.write(get_uptime_ms());
+ * writer.write("accel");
+ * writer.write(accelerometer.get_values());  // Measurable3D
+ * writer.write("temp");
+ * writer.write(23.5F);
+ *
+ * auto size = writer.finish();  // Error::BUFFER_FULL で打ち切り
+ * @endcode
+ */
+template <typename Sink>
+class CborWriter {
+public:
+    /**
+     * @brief 出力先を指定して構築
+     */
+    explicit CborWriter(Sink& sink) noexcept : sink_(&sink) {}
+
+    /**
+     * @brief 値を型に応じて符号化
+     *
+     * @return 書き込めた場合true（以前に失敗している場合もfalse）
+     */
+    template <typename T>
+    bool write(const T& value) noexcept {
+        if constexpr (std::is_same_v<T, bool>) {
+            return write_simple(value ? detail::CBOR_TRUE : detail::CBOR_FALSE);
+        } else if constexpr (std::is_integral_v<T>) {
+            if constexpr (std::is_signed_v<T>) {
+                if (value < 0) {
+                    return write_head(detail::CBOR_NEGATIVE, ~static_cast<uint64_t>(static_cast<int64_t>(value)));
+                }
+            }
+            return write_head(detail::CBOR_UNSIGNED, static_cast<uint64_t>(value));
+        } else if constexpr (std::is_same_v<T, float>) {
+            return write_float(value);
+        } else if constexpr (std::is_same_v<T, double>) {
+            return write_double(value);
+        } else if constexpr (std::is_same_v<T, std::string_view>) {
+            return write_string(detail::CBOR_TEXT, reinterpret_cast<const uint8_t*>(value.data()), value.size());
+        } else if constexpr (std::is_same_v<T, Vector3>) {
+            return write_array_header(3) && write_float(value.x) && write_float(value.y) && write_float(value.z);
+        } else {
+            static_assert(sizeof(T) == 0, "CborWriter: unsupported type");
+            return false;
+        }
+    }
+
+    /**
+     * @brief 文字列リテラルをUTF-8文字列として符号化
+     */
+    template <size_t N>
+    bool write(const char (&str)[N]) noexcept {
+        return write_string(detail::CBOR_TEXT, reinterpret_cast<const uint8_t*>(str), N - 1);
+    }
+
+    /**
+     * @brief span を符号化（uint8_t はバイト列、char はUTF-8文字列、それ以外は配列）
+     */
+    template <typename T>
+    bool write(span<T> values) noexcept {
+        if constexpr (detail::IsByteType<T>::value) {
+            return write_string(detail::CBOR_BYTES, values.data(), values.size());
+        } else if constexpr (detail::IsCharType<T>::value) {
+            return write_string(detail::CBOR_TEXT, reinterpret_cast<const uint8_t*>(values.data()), values.size());
+        } else {
+            if (!write_head(detail::CBOR_ARRAY, values.size())) {
+                return false;
+            }
+            for (const auto& value : values) {
+                if (!write(value)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+    }
+
+    /**
+     * @brief null を符号化
+     */
+    bool write_null() noexcept { return write_simple(detail::CBOR_NULL); }
+
+    /**
+     * @brief 配列のヘッダを符号化（続けて count 個の要素を書き込む）
+     */
+    bool write_array_header(uint32_t count) noexcept { return write_head(detail::CBOR_ARRAY, count); }
+
+    /**
+     * @brief マップのヘッダを符号化（続けて count 組のキーと値を書き込む）
+     */
+    bool write_map_header(uint32_t count) noexcept { return write_head(detail::CBOR_MAP, count); }
+
+    /**
+     * @brief タグを符号化（続けてタグ付けする値を書き込む）
+     */
+    bool write_tag(uint64_t tag) noexcept { return write_head(detail::CBOR_TAG, tag); }
+
+    /**
+     * @brief 書き込んだバイト数を取得
+     */
+    [[nodiscard]] uint32_t bytes_written() const noexcept { return bytes_written_; }
+
+    /**
+     * @brief 結果を取得
+     *
+     * @return 書き込んだバイト数（途中で失敗した場合 Error::BUFFER_FULL または Error::WRITE_FAILED）
+     */
+    [[nodiscard]] Result<uint32_t> finish() const noexcept {
+        if (error_ != Error::OK) {
+            return Result<uint32_t>::err(error_);
+        }
+        return Result<uint32_t>::ok(bytes_written_);
+    }
+
+private:
+    bool emit(span<const uint8_t> head, span<const uint8_t> payload) noexcept {
+        if (error_ != Error::OK) {
+            return false;
+        }
+
+        error_ = detail::cbor_emit(*sink_, head, payload);
+        if (error_ != Error::OK) {
+            return false;
+        }
+        bytes_written_ += static_cast<uint32_t>(head.size() + payload.size());
+        return true;
+    }
+
+    bool write_head(uint8_t major, uint64_t argument) noexcept {
+        uint8_t head[9];
+        const uint32_t n = detail::cbor_encode_head(head, major, argument);
+        return emit(span<const uint8_t>(head, n), span<const uint8_t>());
+    }
+
+    bool write_simple(uint8_t byte) noexcept { return emit(span<const uint8_t>(&byte, 1), span<const uint8_t>()); }
+
+    bool write_string(uint8_t major, const uint8_t* data, size_t size) noexcept {
+        uint8_t head[9];
+        const uint32_t n = detail::cbor_encode_head(head, major, size);
+        return emit(span<const uint8_t>(head, n), span<const uint8_t>(data, size));
+    }
+
+    bool write_float(float value) noexcept {
+        uint8_t head[5];
+        uint16_t half = 0;
+
+        if (detail::cbor_float_to_half(value, half)) {
+            head[0] = detail::CBOR_HALF;
+            head[1] = static_cast<uint8_t>(half >> 8);
+            head[2] = static_cast<uint8_t>(half);
+            return emit(span<const uint8_t>(head, 3), span<const uint8_t>());
+        }
+
+        uint32_t bits = 0;
+        std::memcpy(&bits, &value, sizeof(bits));
+        head[0] = detail::CBOR_SINGLE;
+        for (uint32_t i = 0; i < 4; ++i) {
+            head[4 - i] = static_cast<uint8_t>(bits >> (8 * i));
+        }
+        return emit(span<const uint8_t>(head, 5), span<const uint8_t>());
+    }
+
+    bool write_double(double value) noexcept {
+        // 単精度で正確に表せる値（NaNを含む）は短い形式にする
+        if (value != value) {
+            return write_float(std::numeric_limits<float>::quiet_NaN());
+        }
+        if (value >= -static_cast<double>(FLT_MAX) && value <= static_cast<double>(FLT_MAX) && static_cast<double>(static_cast<float>(value)) == value) {
+            return write_float(static_cast<float>(value));
+        }
+        if (value == std::numeric_limits<double>::infinity() || value == -std::numeric_limits<double>::infinity()) {
+            return write_float(static_cast<float>(value));
+        }
+
+        uint64_t bits = 0;
+        std::memcpy(&bits, &value, sizeof(bits));
+        uint8_t head[9];
+        head[0] = detail::CBOR_DOUBLE;
+        for (uint32_t i = 0; i < 8; ++i) {
+            head[8 - i] = static_cast<uint8_t>(bits >> (8 * i));
+        }
+        return emit(span<const uint8_t>(head, 9), span<const uint8_t>());
+    }
+
+    Sink* sink_;
+    uint32_t bytes_written_ = 0;
+    Error error_ = Error::OK;
+};
+
+/**
+ * @brief CBOR（RFC 8949）のプル型デコーダ
+ *
+ * バイト列を先頭から1項目ずつ読む。文字列・バイト列は入力へのビュー（std::string_view / span）として返し、コピーしない。
+ * 読み取りに失敗した場合は位置を進めない。
+ *
+ * - 入力が途中で終わっている: Error::BUFFER_EMPTY
+ * - 型が違う・値が読み取り先の型の範囲外・不正な符号化: Error::INVALID_DATA
+ *
+ * 不定長の項目（追加情報31）には対応しない（INVALID_DATA）。文字列のUTF-8検証は行わない。
+ *
+ * @par 使用例
+ * @code
+ * CborReader reader(span<const uint8_t>(rx, n));
+ * auto pairs = reader.read_map_header();
+ * for (uint32_t i = 0; pairs.is_ok() && i < pairs.value(); ++i) {
+ *     auto key = reader.read<std::string_view>();
+ *     if (key.is_ok() && key.value() == "accel") {
+ *         auto accel = reader.read<Vector3>();
+ *     } else {
+ *         reader.skip();
+ *     }
+ * }
+ * @endcode
+ */
+class CborReader {
+public:
+    /**
+     * @brief 入力を指定して構築
+     */
+    explicit CborReader(span<const uint8_t> data) noexcept : data_(data) {}
+
+    /**
+     * @brief 現在の読み取り位置を取得
+     */
+    [[nodiscard]] size_t position() const noexcept { return position_; }
+
+    /**
+     * @brief 残りのバイト数を取得
+     */
+    [[nodiscard]] size_t remaining() const noexcept { return data_.size() - position_; }
+
+    /**
+     * @brief 入力の終端に達したか判定
+     */
+    [[nodiscard]] bool is_end() const noexcept { return position_ >= data_.size(); }
+
+    /**
+     * @brief 次の項目の種類を取得（位置は進めない）
+     */
+    [[nodiscard]] Result<CborType> peek_type() const noexcept {
+        if (is_end()) {
+            return Result<CborType>::err(Error::BUFFER_EMPTY);
+        }
+
+        const uint8_t initial = data_[position_];
+        switch (initial >> 5) {
+            case detail::CBOR_UNSIGNED:
+                return Result<CborType>::ok(CborType::UNSIGNED);
+            case detail::CBOR_NEGATIVE:
+                return Result<CborType>::ok(CborType::NEGATIVE);
+            case detail::CBOR_BYTES:
+                return Result<CborType>::ok(CborType::BYTES);
+            case detail::CBOR_TEXT:
+                return Result<CborType>::ok(CborType::TEXT);
+            case detail::CBOR_ARRAY:
+                return Result<CborType>::ok(CborType::ARRAY);
+            case detail::CBOR_MAP:
+                return Result<CborType>::ok(CborType::MAP);
+            case detail::CBOR_TAG:
+                return Result<CborType>::ok(CborType::TAG);
+            default:
+                break;
+        }
+
+        switch (initial) {
+            case detail::CBOR_FALSE:
+            case detail::CBOR_TRUE:
+                return Result<CborType>::ok(CborType::BOOL);
+            case detail::CBOR_NULL:
+                return Result<CborType>::ok(CborType::NULL_VALUE);
+            case 0xF7:
+                return Result<CborType>::ok(CborType::UNDEFINED);
+            case detail::CBOR_HALF:
+            case detail::CBOR_SINGLE:
+            case detail::CBOR_DOUBLE:
+                return Result<CborType>::ok(CborType::FLOAT);
+            default:
+                return Result<CborType>::ok(CborType::SIMPLE);
+        }
+    }
+
+    /**
+     * @brief 次の項目を型 T として読む
+     *
+     * T: bool / 整数型 / float / double / std::string_view / span<const uint8_t> / Vector3
+     * - 整数は T の範囲内であること
+     * - float / double は半精度・単精度・倍精度のいずれからも読める（double → float は丸める）
+     */
+    template <typename T>
+    [[nodiscard]] Result<T> read() noexcept {
+        if constexpr (std::is_same_v<T, bool>) {
+            if (is_end()) {
+                return Result<T>::err(Error::BUFFER_EMPTY);
+            }
+            const uint8_t initial = data_[position_];
+            if (initial != detail::CBOR_FALSE && initial != detail::CBOR_TRUE) {
+                return Result<T>::err(Error::INVALID_DATA);
+            }
+            ++position_;
+            return Result<T>::ok(initial == detail::CBOR_TRUE);
+        } else if constexpr (std::is_integral_v<T>) {
+            return read_integer<T>();
+        } else if constexpr (std::is_floating_point_v<T>) {
+            return read_floating<T>();
+        } else if constexpr (std::is_same_v<T, std::string_view>) {
+            const Result<span<const uint8_t>> bytes = read_string(detail::CBOR_TEXT);
+            if (bytes.is_err()) {
+                return Result<T>::err(bytes.error());
+            }
+            return Result<T>::ok(std::string_view(reinterpret_cast<const char*>(bytes.value().data()), bytes.value().size()));
+        } else if constexpr (std::is_same_v<T, span<const uint8_t>>) {
+            return read_string(detail::CBOR_BYTES);
+        } else if constexpr (std::is_same_v<T, Vector3>) {
+            return read_vector3();
+        } else {
+            static_assert(sizeof(T) == 0, "CborReader: unsupported type");
+            return Result<T>::err(Error::INVALID_DATA);
+        }
+    }
+
+    /**
+     * @brief 配列のヘッダを読む
+     *
+     * @return 要素数
+     */
+    [[nodiscard]] Result<uint32_t> read_array_header() noexcept { return read_count(detail::CBOR_ARRAY); }
+
+    /**
+     * @brief マップのヘッダを読む
+     *
+     * @return キーと値の組の数
+     */
+    [[nodiscard]] Result<uint32_t> read_map_header() noexcept { return read_count(detail::CBOR_MAP); }
+
+    /**
+     * @brief タグを読む（続けてタグ付けされた値を読む）
+     */
+    [[nodiscard]] Result<uint64_t> read_tag() noexcept {
+        Header header;
+        const Error error = read_header(header, detail::CBOR_TAG);
+        if (error != Error::OK) {
+            return Result<uint64_t>::err(error);
+        }
+        position_ += header.size;
+        return Result<uint64_t>::ok(header.argument);
+    }
+
+    /**
+     * @brief 次の項目が null なら読み進める
+     *
+     * @return null を読んだ場合true
+     */
+    bool read_null() noexcept {
+        if (is_end() || data_[position_] != detail::CBOR_NULL) {
+            return false;
+        }
+        ++position_;
+        return true;
+    }
+
+    /**
+     * @brief 次の項目を読み飛ばす（配列・マップ・タグは中身ごと）
+     *
+     * @return 読み飛ばしたバイト数
+     */
+    [[nodiscard]] Result<uint32_t> skip() noexcept {
+        const size_t start = position_;
+        uint64_t pending = 1;
+
+        while (pending > 0) {
+            Header header;
+            const Error error = read_header(header);
+            if (error != Error::OK) {
+                position_ = start;
+                return Result<uint32_t>::err(error);
+            }
+            position_ += header.size;
+            --pending;
+
+            // 各項目は最低1バイトなので、残りより多い要素数は途中で終わっている
+            const uint64_t left = remaining();
+            switch (header.major) {
+                case detail::CBOR_BYTES:
+                case detail::CBOR_TEXT:
+                    if (header.argument > left) {
+                        position_ = start;
+                        return Result<uint32_t>::err(Error::BUFFER_EMPTY);
+                    }
+                    position_ += static_cast<size_t>(header.argument);
+                    break;
+                case detail::CBOR_ARRAY:
+                case detail::CBOR_MAP: {
+                    const uint64_t items = (header.major == detail::CBOR_MAP) ? header.argument * 2 : header.argument;
+                    if (header.argument > left || pending + items > left) {
+                        position_ = start;
+                        return Result<uint32_t>::err(Error::BUFFER_EMPTY);
+                    }
+                    pending += items;
+                    break;
+                }
+                case detail::CBOR_TAG:
+                    ++pending;
+                    break;
+                default:
+                    break;
+            }
+        }
+
+        return Result<uint32_t>::ok(static_cast<uint32_t>(position_ - start));
+    }
+
+private:
+    struct Header {
+        uint8_t major;
+        uint8_t info;
+        uint64_t argument;
+        uint32_t size; ///< ヘッダのバイト数
+    };
+
+    /**
+     * @brief 現在位置のヘッダを解析（位置は進めない）
+     */
+    [[nodiscard]] Error read_header(Header& header) const noexcept {
+        if (is_end()) {
+            return Error::BUFFER_EMPTY;
+        }
+
+        const uint8_t initial = data_[position_];
+        header.major = static_cast<uint8_t>(initial >> 5);
+        header.info = static_cast<uint8_t>(initial & 0x1FU);
+
+        uint32_t bytes = 0;
+        if (header.info < 24) {
+            header.argument = header.info;
+            header.size = 1;
+            return Error::OK;
+        }
+        if (header.info > 27) {
+            // 予約値・不定長
+            return Error::INVALID_DATA;
+        }
+
+        bytes = 1U << (header.info - 24);
+        if (remaining() < bytes + 1) {
+            return Error::BUFFER_EMPTY;
+        }
+
+        uint64_t argument = 0;
+        for (uint32_t i = 1; i <= bytes; ++i) {
+            argument = (argument << 8) | data_[position_ + i];
+        }
+        header.argument = argument;
+        header.size = bytes + 1;
+        return Error::OK;
+    }
+
+    /**
+     * @brief 現在位置のヘッダを解析し、メジャータイプを確認する（位置は進めない）
+     */
+    [[nodiscard]] Error read_header(Header& header, uint8_t major) const noexcept {
+        if (is_end()) {
+            return Error::BUFFER_EMPTY;
+        }
+        if ((data_[position_] >> 5) != major) {
+            return Error::INVALID_DATA;
+        }
+        return read_header(header);
+    }
+
+    template <typename T>
+    [[nodiscard]] Result<T> read_integer() noexcept {
+        if (is_end()) {
+            return Result<T>::err(Error::BUFFER_EMPTY);
+        }
+
+        const auto major = static_cast<uint8_t>(data_[position_] >> 5);
+        if (major != detail::CBOR_UNSIGNED && major != detail::CBOR_NEGATIVE) {
+            return Result<T>::err(Error::INVALID_DATA);
+        }
+
+        Header header;
+        const Error error = read_header(header);
+        if (error != Error::OK) {
+            return Result<T>::err(error);
+        }
+
+        // 負の整数 -1 - n は、n <= T の最大値のとき T で表せる
+        constexpr auto max = static_cast<uint64_t>(std::numeric_limits<T>::max());
+        if (major == detail::CBOR_NEGATIVE && !std::is_signed_v<T>) {
+            return Result<T>::err(Error::INVALID_DATA);
+        }
+        if (header.argument > max) {
+            return Result<T>::err(Error::INVALID_DATA);
+        }
+
+        position_ += header.size;
+        if (major == detail::CBOR_NEGATIVE) {
+            return Result<T>::ok(static_cast<T>(-1 - static_cast<int64_t>(header.argument)));
+        }
+        return Result<T>::ok(static_cast<T>(header.argument));
+    }
+
+    template <typename T>
+    [[nodiscard]] Result<T> read_floating() noexcept {
+        if (is_end()) {
+            return Result<T>::err(Error::BUFFER_EMPTY);
+        }
+
+        const uint8_t initial = data_[position_];
+        if (initial != detail::CBOR_HALF && initial != detail::CBOR_SINGLE && initial != detail::CBOR_DOUBLE) {
+            return Result<T>::err(Error::INVALID_DATA);
+        }
+
+        Header header;
+        const Error error = read_header(header);
+        if (error != Error::OK) {
+            return Result<T>::err(error);
+        }
+        position_ += header.size;
+
+        if (initial == detail::CBOR_HALF) {
+            return Result<T>::ok(static_cast<T>(detail::cbor_half_to_float(static_cast<uint16_t>(header.argument))));
+        }
+        if (initial == detail::CBOR_SINGLE) {
+            const auto bits = static_cast<uint32_t>(header.argument);
+            float value = 0.0F;
+            std::memcpy(&value, &bits, sizeof(value));
+            return Result<T>::ok(static_cast<T>(value));
+        }
+
+        double value = 0.0;
+        std::memcpy(&value, &header.argument, sizeof(value));
+        return Result<T>::ok(static_cast<T>(value));
+    }
+
+    [[nodiscard]] Result<span<const uint8_t>> read_string(uint8_t major) noexcept {
+        Header header;
+        const Error error = read_header(header, major);
+        if (error != Error::OK) {
+            return Result<span<const uint8_t>>::err(error);
+        }
+        if (header.argument > remaining() - header.size) {
+            return Result<span<const uint8_t>>::err(Error::BUFFER_EMPTY);
+        }
+
+        const span<const uint8_t> bytes(data_.data() + position_ + header.size, static_cast<size_t>(header.argument));
+        position_ += header.size + static_cast<size_t>(header.argument);
+        return Result<span<const uint8_t>>::ok(bytes);
+    }
+
+    [[nodiscard]] Result<uint32_t> read_count(uint8_t major) noexcept {
+        Header header;
+        const Error error = read_header(header, major);
+        if (error != Error::OK) {
+            return Result<uint32_t>::err(error);
+        }
+        if (header.argument > 0xFFFFFFFFU) {
+            return Result<uint32_t>::err(Error::INVALID_DATA);
+        }
+        position_ += header.size;
+        return Result<uint32_t>::ok(static_cast<uint32_t>(header.argument));
+    }
+
+    [[nodiscard]] Result<Vector3> read_vector3() noexcept {
+        const size_t start = position_;
+        Vector3 value;
+        float* components[] = {&value.x, &value.y, &value.z};
+
+        const Result<uint32_t> count = read_array_header();
+        if (count.is_err() || count.value() != 3) {
+            position_ = start;
+            return Result<Vector3>::err(count.is_err() ? count.error() : Error::INVALID_DATA);
+        }
+
+        for (float* component : components) {
+            const Result<float> f = read<float>();
+            if (f.is_err()) {
+                position_ = start;
+                return Result<Vector3>::err(f.error());
+            }
+            *component = f.value();
+        }
+        return Result<Vector3>::ok(value);
+    }
+
+    span<const uint8_t> data_;
+    size_t position_ = 0;
+};
+
+} // namespace omusubi
@@ -0,0 +1,150 @@
+#pragma once
+
+#include <omusubi/core/string_view.h>
+
+#include <cstdint>
+#include <omusubi/core/east_asian_width_table.hpp>
+#include <string_view>
+
+namespace omusubi::utf8 {
+
+/**
+ * @brief UTF-8文字を1文字デコード
+ *
+ * 不正なシーケンス（途中で切れている、継続バイトが不正）の場合は
+ * 先頭1バイトを U+FFFD として扱う。
+ *
+ * @param str 先頭バイトへのポインタ
+ * @param remaining 残りバイト数（1以上）
+ * @param codepoint デコード結果
+ * @return 消費したバイト数
+ */
+constexpr uint8_t decode(const char* str, uint32_t remaining, uint32_t& codepoint) noexcept {
+    const auto first = static_cast<uint8_t>(str[0]);
+    const uint8_t length = get_char_byte_length(first);
+
+    if (length == 1) {
+        codepoint = (first < 0x80) ? first : 0xFFFD;
+        return 1;
+    }
+
+    if (length > remaining) {
+        codepoint = 0xFFFD;
+        return 1;
+    }
+
+    uint32_t value = first & (0x7F >> length);
+    for (uint8_t i = 1; i < length; ++i) {
+        const auto next = static_cast<uint8_t>(str[i]);
+        if ((next & 0xC0) != 0x80) {
+            codepoint = 0xFFFD;
+            return 1;
+        }
+        value = (value << 6) | (next & 0x3F);
+    }
+
+    codepoint = value;
+    return length;
+}
+
+/**
+ * @brief コードポイントの表示幅（桁数）を取得
+ *
+ * @return 0（結合文字・制御文字など）、1（半角）、2（全角）
+ */
+constexpr uint8_t codepoint_width(uint32_t codepoint) noexcept {
+    // ASCII・ラテン文字の高速パス
+    if (codepoint < 0x300) {
+        return (codepoint >= 0x20 && (codepoint < 0x7F || codepoint >= 0xA0)) ? 1 : 0;
+    }
+
+    if (codepoint >= detail::EAW_TABLE_LIMIT) {
+        // 第14面のタグ文字・異体字セレクタ
+        return (codepoint >= 0xE0000 && codepoint <= 0xE0FFF) ? 0 : 1;
+    }
+
+    const uint32_t block = detail::EAW_STAGE1[codepoint >> detail::EAW_BLOCK_SHIFT];
+    const uint32_t offset = codepoint & ((1U << detail::EAW_BLOCK_SHIFT) - 1);
+    const uint8_t packed = detail::EAW_STAGE2[(block << (detail::EAW_BLOCK_SHIFT - 2)) + (offset >> 2)];
+
+    return (packed >> ((offset & 3) * 2)) & 3;
+}
+
+} // namespace omusubi::utf8
+
+namespace omusubi {
+
+/**
+ * @brief 表示幅で切り詰めた先頭部分
+ */
+struct WidthPrefix {
+    uint32_t byte_length; ///< 先頭部分のバイト長（文字の途中で切れることはない）
+    uint32_t columns;     ///< 先頭部分の表示幅
+};
+
+/**
+ * @brief 表示幅 max_columns 以内に収まる最長の先頭部分を求める
+ *
+ * 1回の走査で、バイト長と表示幅を同時に求める。
+ * 最後の文字に続く幅0の文字（結合文字など）は先頭部分に含める。
+ */
+[[nodiscard]] constexpr WidthPrefix measure_width(std::string_view sv, uint32_t max_columns) noexcept {
+    const char* const data = sv.data();
+    const auto length = static_cast<uint32_t>(sv.size());
+    uint32_t pos = 0;
+    uint32_t columns = 0;
+
+    while (pos < length) {
+        const auto byte = static_cast<uint8_t>(data[pos]);
+        uint8_t width = 0;
+        uint8_t char_len = 1;
+
+        if (byte < 0x80) {
+            width = (byte >= 0x20 && byte != 0x7F) ? 1 : 0;
+        } else {
+            uint32_t codepoint = 0;
+            char_len = utf8::decode(data + pos, length - pos, codepoint);
+            width = utf8::codepoint_width(codepoint);
+        }
+
+        if (columns + width > max_columns) {
+            break;
+        }
+
+        columns += width;
+        pos += char_len;
+    }
+
+    return WidthPrefix {pos, columns};
+}
+
+/**
+ * @brief std::string_view の表示幅（桁数）を取得
+ *
+ * 全角文字（漢字・かな・全角英数など）は2桁、結合文字は0桁として数える。
+ *
+ * @par 使用例
+ * @code
+ * display_width("Hello"sv);       // 5
+ * display_width("こんにちは"sv);  // 10
+ * @endcode
+ */
+[[nodiscard]] constexpr uint32_t display_width(std::string_view sv) noexcept {
+    return measure_width(sv, UINT32_MAX).columns;
+}
+
+/**
+ * @brief 表示幅 max_columns 以内に収まるよう切り詰める
+ *
+ * 文字の途中や全角文字の半分で切れることはない。
+ *
+ * @par 使用例
+ * @code
+ * truncate_to_width("温度センサー"sv, 7);  // "温度セ"（6桁）
+ * @endcode
+ */
+[[nodiscard]] constexpr std::string_view truncate_to_width(std::string_view sv, uint32_t max_columns) noexcept {
+    return sv.substr(0, measure_width(sv, max_columns).byte_length);
+}
+
+} // namespace omusubi
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstring>
 #include <omusubi/core/span.hpp>
 
 namespace omusubi {
@@ -49,6 +50,25 @@ public:
         return true;
     }
 
+    /**
+     * @brief バイト列を追加
+     *
+     * 全体が収まらない場合は何も追加しない。
+     *
+     * @return 容量が不足している場合false
+     */
+    bool append(span<const uint8_t> bytes) noexcept {
+        if (bytes.size() > Capacity - length_) {
+            return false;
+        }
+
+        if (!bytes.empty()) {
+            std::memcpy(buffer_ + length_, bytes.data(), bytes.size());
+        }
+        length_ += static_cast<uint32_t>(bytes.size());
+        return true;
+    }
+
     /**
      * @brief クリア
      */
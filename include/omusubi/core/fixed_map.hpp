@@ -0,0 +1,392 @@
+#pragma once
+
+#include <cstdint>
+#include <new>
+#include <omusubi/core/hash.hpp>
+#include <omusubi/core/result.hpp>
+
+namespace omusubi {
+
+namespace detail {
+
+/**
+ * @brief FixedMap の制御バイト群（8スロット）に対するSWAR演算
+ *
+ * 制御バイトは 0x00 が空きスロット、0x80 | タグ（ハッシュ上位7bit）が使用中スロット。
+ */
+struct MapGroup {
+    static constexpr uint32_t WIDTH = 8;
+    static constexpr uint64_t LSB = 0x0101010101010101U;
+    static constexpr uint64_t MSB = 0x8080808080808080U;
+
+    uint64_t bits;
+
+    /**
+     * @brief 8バイトを読み込む（先頭バイトが最下位）
+     */
+    [[nodiscard]] static MapGroup load(const uint8_t* ctrl) noexcept {
+        uint64_t bits = 0;
+        for (uint32_t i = 0; i < WIDTH; ++i) {
+            bits |= static_cast<uint64_t>(ctrl[i]) << (i * 8);
+        }
+        return MapGroup {bits};
+    }
+
+    /**
+     * @brief 制御バイトが byte と一致する位置の最上位ビットを立てたマスク
+     *
+     * 一致したバイトより後ろで偽陽性が出ることがあるため、候補はキー比較で確認する。
+     */
+    [[nodiscard]] uint64_t match(uint8_t byte) const noexcept {
+        const uint64_t x = bits ^ (LSB * byte);
+        return (x - LSB) & ~x & MSB;
+    }
+
+    /**
+     * @brief 空きスロットの位置の最上位ビットを立てたマスク
+     */
+    [[nodiscard]] uint64_t match_empty() const noexcept { return ~bits & MSB; }
+
+    /**
+     * @brief マスクの最下位の立っているビットが示すスロット位置（mask != 0）
+     */
+    [[nodiscard]] static uint32_t lowest(uint64_t mask) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+        return static_cast<uint32_t>(__builtin_ctzll(mask)) / 8;
+#else
+        uint32_t index = 0;
+        while ((mask & 0x80U) == 0) {
+            mask >>= 8;
+            ++index;
+        }
+        return index;
+#endif
+    }
+};
+
+} // namespace detail
+
+/**
+ * @brief 固定容量のハッシュマップ（オープンアドレス法）
+ *
+ * 全要素を静的な内部領域に保持する。動的メモリ確保なし。
+ * - スロットごとの制御バイト（ハッシュ上位7bitのタグ）を8スロット単位でSWAR比較し、
+ *   キー比較はタグが一致した候補のみ行う
+ * - 線形探索。削除は後続要素を前に詰める（バックワードシフト）ため墓石が残らず、
+ *   削除を繰り返しても探索長が伸びない
+ * - テーブルサイズは負荷率75%以下となる2のべき乗
+ *
+ * @tparam K キーの型（Hash<K> と operator== が必要。std::string_view は文字列を複製しない）
+ * @tparam V 値の型
+ * @tparam N 最大要素数
+ *
+ * @par 使用例
+ * @code
+ * static FixedMap<uint64_t, PeerState, 16> peers;  // BLEアドレス → 状態
+ *
+ * auto result = peers.insert(address, PeerState {});
+ * if (result.is_err()) {
+ *     // Error::BUFFER_FULL
+ * }
+ *
+ * if (PeerState* state = peers.find(address)) {
+ *     state->rssi = rssi;
+ * }
+ * peers.erase(address);
+ * @endcode
+ */
+template <typename K, typename V, uint32_t N>
+class FixedMap {
+    static_assert(N > 0, "FixedMap capacity must be greater than 0");
+
+    static constexpr uint32_t calculate_table_size() noexcept {
+        uint32_t size = detail::MapGroup::WIDTH;
+        while (size * 3 < N * 4) {
+            size <<= 1;
+        }
+        return size;
+    }
+
+public:
+    /** @brief スロット数（2のべき乗） */
+    static constexpr uint32_t TABLE_SIZE = calculate_table_size();
+
+    /**
+     * @brief キーと値の組
+     */
+    struct Entry {
+        K key;
+        V value;
+    };
+
+    /**
+     * @brief 使用中スロットを順に辿るイテレータ（順序は不定）
+     */
+    template <typename Map, typename E>
+    class Iterator {
+    public:
+        Iterator(Map* map, uint32_t slot) noexcept : map_(map), slot_(slot) { skip_empty(); }
+
+        E& operator*() const noexcept { return map_->entry(slot_); }
+
+        E* operator->() const noexcept { return &map_->entry(slot_); }
+
+        Iterator& operator++() noexcept {
+            ++slot_;
+            skip_empty();
+            return *this;
+        }
+
+        [[nodiscard]] bool operator==(const Iterator& other) const noexcept { return slot_ == other.slot_; }
+
+        [[nodiscard]] bool operator!=(const Iterator& other) const noexcept { return slot_ != other.slot_; }
+
+    private:
+        void skip_empty() noexcept {
+            while (slot_ < TABLE_SIZE && map_->ctrl_[slot_] == EMPTY) {
+                ++slot_;
+            }
+        }
+
+        Map* map_;
+        uint32_t slot_;
+    };
+
+    using iterator = Iterator<FixedMap, Entry>;
+    using const_iterator = Iterator<const FixedMap, const Entry>;
+
+    /**
+     * @brief デフォルトコンストラクタ
+     */
+    FixedMap() noexcept {
+        for (uint8_t& c : ctrl_) {
+            c = EMPTY;
+        }
+    }
+
+    /**
+     * @brief デストラクタ（全要素を破棄）
+     */
+    ~FixedMap() noexcept { clear(); }
+
+    FixedMap(const FixedMap&) = delete;
+    FixedMap& operator=(const FixedMap&) = delete;
+    FixedMap(FixedMap&&) = delete;
+    FixedMap& operator=(FixedMap&&) = delete;
+
+    /**
+     * @brief 容量を取得
+     */
+    [[nodiscard]] static constexpr uint32_t capacity() noexcept { return N; }
+
+    /**
+     * @brief 要素数を取得
+     */
+    [[nodiscard]] uint32_t size() const noexcept { return size_; }
+
+    /**
+     * @brief 空か判定
+     */
+    [[nodiscard]] bool is_empty() const noexcept { return size_ == 0; }
+
+    /**
+     * @brief 満杯か判定
+     */
+    [[nodiscard]] bool is_full() const noexcept { return size_ == N; }
+
+    /**
+     * @brief キーを検索
+     *
+     * @return 値へのポインタ（見つからない場合nullptr）
+     */
+    [[nodiscard]] V* find(const K& key) noexcept {
+        const uint32_t slot = find_slot(key, Hash<K> {}(key));
+        return (slot != NOT_FOUND) ? &entry(slot).value : nullptr;
+    }
+
+    [[nodiscard]] const V* find(const K& key) const noexcept {
+        const uint32_t slot = find_slot(key, Hash<K> {}(key));
+        return (slot != NOT_FOUND) ? &entry(slot).value : nullptr;
+    }
+
+    /**
+     * @brief キーが登録済みか判定
+     */
+    [[nodiscard]] bool contains(const K& key) const noexcept { return find(key) != nullptr; }
+
+    /**
+     * @brief キーが未登録の場合のみ値を直接構築
+     *
+     * 登録済みの場合は既存の値を返す（args は使われない）。
+     *
+     * @return 値へのポインタ（満杯の場合は Error::BUFFER_FULL）
+     */
+    template <typename... Args>
+    // NOLINTNEXTLINE(cppcoreguidelines-missing-std-forward)
+    Result<V*> try_emplace(const K& key, Args&&... args) noexcept {
+        const uint32_t hash = Hash<K> {}(key);
+        const uint32_t existing = find_slot(key, hash);
+
+        if (existing != NOT_FOUND) {
+            return Result<V*>::ok(&entry(existing).value);
+        }
+        if (size_ >= N) {
+            return Result<V*>::err(Error::BUFFER_FULL);
+        }
+
+        const uint32_t slot = find_empty(hash);
+        Entry* e = new (&storage_[slot]) Entry {key, V(static_cast<Args&&>(args)...)};
+        set_ctrl(slot, tag(hash));
+        ++size_;
+
+        return Result<V*>::ok(&e->value);
+    }
+
+    /**
+     * @brief 値を登録（登録済みの場合は上書き）
+     *
+     * @return 値へのポインタ（満杯の場合は Error::BUFFER_FULL）
+     */
+    Result<V*> insert(const K& key, const V& value) noexcept {
+        V* existing = find(key);
+        if (existing != nullptr) {
+            *existing = value;
+            return Result<V*>::ok(existing);
+        }
+        return try_emplace(key, value);
+    }
+
+    /**
+     * @brief キーを削除
+     *
+     * 同じクラスタ内の後続要素のうち、空いたスロットへ移動できるものを前に詰める。
+     *
+     * @return 見つからない場合false
+     */
+    bool erase(const K& key) noexcept {
+        uint32_t hole = find_slot(key, Hash<K> {}(key));
+        if (hole == NOT_FOUND) {
+            return false;
+        }
+
+        entry(hole).~Entry();
+
+        for (uint32_t slot = (hole + 1) & MASK; ctrl_[slot] != EMPTY; slot = (slot + 1) & MASK) {
+            const uint32_t home = Hash<K> {}(entry(slot).key) & MASK;
+
+            // home から slot までの探索路上に hole があれば hole へ移動できる
+            if (((slot - home) & MASK) >= ((slot - hole) & MASK)) {
+                new (&storage_[hole]) Entry(static_cast<Entry&&>(entry(slot)));
+                entry(slot).~Entry();
+                set_ctrl(hole, ctrl_[slot]);
+                hole = slot;
+            }
+        }
+
+        set_ctrl(hole, EMPTY);
+        --size_;
+        return true;
+    }
+
+    /**
+     * @brief 全要素を削除
+     */
+    void clear() noexcept {
+        for (uint32_t slot = 0; slot < TABLE_SIZE; ++slot) {
+            if (ctrl_[slot] != EMPTY) {
+                entry(slot).~Entry();
+                set_ctrl(slot, EMPTY);
+            }
+        }
+        size_ = 0;
+    }
+
+    [[nodiscard]] iterator begin() noexcept { return iterator(this, 0); }
+
+    [[nodiscard]] iterator end() noexcept { return iterator(this, TABLE_SIZE); }
+
+    [[nodiscard]] const_iterator begin() const noexcept { return const_iterator(this, 0); }
+
+    [[nodiscard]] const_iterator end() const noexcept { return const_iterator(this, TABLE_SIZE); }
+
+private:
+    static constexpr uint32_t MASK = TABLE_SIZE - 1;
+    static constexpr uint32_t NOT_FOUND = 0xFFFFFFFFU;
+    static constexpr uint8_t EMPTY = 0x00;
+
+    /**
+     * @brief 制御バイトに格納するタグ（ハッシュ上位7bit + 使用中フラグ）
+     */
+    static constexpr uint8_t tag(uint32_t hash) noexcept { return static_cast<uint8_t>(0x80U | (hash >> 25)); }
+
+    /**
+     * @brief 未使用スロットを含めた要素領域
+     */
+    struct alignas(Entry) Storage {
+        unsigned char bytes[sizeof(Entry)];
+    };
+
+    Entry& entry(uint32_t slot) noexcept { return *std::launder(reinterpret_cast<Entry*>(&storage_[slot])); }
+
+    const Entry& entry(uint32_t slot) const noexcept { return *std::launder(reinterpret_cast<const Entry*>(&storage_[slot])); }
+
+    /**
+     * @brief 制御バイトを設定（先頭グループ分は末尾の複製にも反映）
+     */
+    void set_ctrl(uint32_t slot, uint8_t value) noexcept {
+        ctrl_[slot] = value;
+        if (slot < detail::MapGroup::WIDTH) {
+            ctrl_[TABLE_SIZE + slot] = value;
+        }
+    }
+
+    /**
+     * @brief キーのスロットを検索
+     *
+     * 空きスロットを含むグループに到達したら探索を終了する
+     * （線形探索では、キーは home から空きスロットまでの間にしか存在しない）。
+     */
+    uint32_t find_slot(const K& key, uint32_t hash) const noexcept {
+        const uint8_t key_tag = tag(hash);
+        uint32_t pos = hash & MASK;
+
+        for (uint32_t probed = 0; probed < TABLE_SIZE; probed += detail::MapGroup::WIDTH) {
+            const detail::MapGroup group = detail::MapGroup::load(ctrl_ + pos);
+
+            for (uint64_t candidates = group.match(key_tag); candidates != 0; candidates &= candidates - 1) {
+                const uint32_t slot = (pos + detail::MapGroup::lowest(candidates)) & MASK;
+                if (entry(slot).key == key) {
+                    return slot;
+                }
+            }
+
+            if (group.match_empty() != 0) {
+                return NOT_FOUND;
+            }
+            pos = (pos + detail::MapGroup::WIDTH) & MASK;
+        }
+
+        return NOT_FOUND;
+    }
+
+    /**
+     * @brief home 以降で最初の空きスロットを検索（size_ < N であること）
+     */
+    uint32_t find_empty(uint32_t hash) const noexcept {
+        uint32_t pos = hash & MASK;
+
+        for (;;) {
+            const uint64_t empty = detail::MapGroup::load(ctrl_ + pos).match_empty();
+            if (empty != 0) {
+                return (pos + detail::MapGroup::lowest(empty)) & MASK;
+            }
+            pos = (pos + detail::MapGroup::WIDTH) & MASK;
+        }
+    }
+
+    Storage storage_[TABLE_SIZE];
+    uint8_t ctrl_[TABLE_SIZE + detail::MapGroup::WIDTH];
+    uint32_t size_ = 0;
+};
+
+} // namespace omusubi
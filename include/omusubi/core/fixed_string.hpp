@@ -3,6 +3,7 @@
 #include <omusubi/core/string_view.h>
 
 #include <cstdint>
+#include <omusubi/core/fixed_string_ref.hpp>
 #include <omusubi/core/span.hpp>
 #include <omusubi/core/string_base.hpp>
 #include <string_view>
@@ -80,73 +81,39 @@ public:
     [[nodiscard]] constexpr operator std::string_view() const noexcept { return view(); }
 
     /**
-     * @brief 文字列を追加
+     * @brief 容量を型から消去した参照を取得
      */
-    constexpr bool append(std::string_view view) noexcept {
-        const auto view_size = static_cast<uint32_t>(view.size());
-
-        if (byte_length_ + view_size > Capacity) {
-            return false;
-        }
-
-        for (uint32_t i = 0; i < view_size; ++i) {
-            buffer_[byte_length_++] = view[i]; // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
-        }
+    [[nodiscard]] constexpr FixedStringRef ref() noexcept { return FixedStringRef(buffer_, &byte_length_, Capacity); }
 
-        buffer_[byte_length_] = '\0'; // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+    /**
+     * @brief FixedStringRefへの暗黙変換
+     */
+    [[nodiscard]] constexpr operator FixedStringRef() noexcept { return ref(); }
 
-        return true;
-    }
+    /**
+     * @brief 文字列を追加
+     */
+    constexpr bool append(std::string_view view) noexcept { return ref().append(view); }
 
     /**
      * @brief C文字列を追加
      */
-    constexpr bool append(const char* str) noexcept {
-        if (str == nullptr) {
-            return false;
-        }
-
-        return append(from_c_string(str));
-    }
+    constexpr bool append(const char* str) noexcept { return ref().append(str); }
 
     /**
      * @brief 1文字追加
      */
-    constexpr bool append(char c) noexcept {
-        if (byte_length_ >= Capacity) {
-            return false;
-        }
-
-        buffer_[byte_length_++] = c;  // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
-        buffer_[byte_length_] = '\0'; // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
-
-        return true;
-    }
+    constexpr bool append(char c) noexcept { return ref().append(c); }
 
     /**
      * @brief クリア
      */
-    constexpr void clear() noexcept {
-        byte_length_ = 0;
-        buffer_[0] = '\0';
-    }
+    constexpr void clear() noexcept { ref().clear(); }
 
     [[nodiscard]] bool operator==(std::string_view other) const noexcept { return String<FixedString<Capacity>>::equals(other); }
 
     [[nodiscard]] bool operator!=(std::string_view other) const noexcept { return !String<FixedString<Capacity>>::equals(other); }
 
-    [[nodiscard]] constexpr std::string_view get_char(uint32_t char_index) const noexcept {
-        uint32_t byte_pos = this->get_char_position(char_index);
-
-        if (byte_pos >= byte_length_) {
-            return std::string_view {};
-        }
-
-        uint8_t char_len = utf8::get_char_byte_length(static_cast<uint8_t>(buffer_[byte_pos]));
-
-        return std::string_view {buffer_ + byte_pos, char_len};
-    }
-
     /**
      * @brief イテレータ（開始）
      */
@@ -170,15 +137,7 @@ public:
     /**
      * @brief spanから構築
      */
-    constexpr void from_span(span<const char> s) noexcept {
-        byte_length_ = (s.size() < Capacity) ? static_cast<uint32_t>(s.size()) : Capacity;
-
-        for (uint32_t i = 0; i < byte_length_; ++i) {
-            buffer_[i] = s[i];
-        }
-
-        buffer_[byte_length_] = '\0';
-    }
+    constexpr void from_span(span<const char> s) noexcept { ref().assign(std::string_view {s.data(), s.size()}); }
 
 private:
     char buffer_[Capacity + 1]; // +1 for null terminator
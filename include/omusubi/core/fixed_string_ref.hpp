@@ -0,0 +1,203 @@
+#pragma once
+
+#include <omusubi/core/string_view.h>
+
+#include <cstdint>
+#include <omusubi/core/string_base.hpp>
+#include <string_view>
+
+namespace omusubi {
+
+/**
+ * @brief 容量を型から消去した FixedString への可変参照
+ *
+ * バッファへのポインタ、長さへのポインタ、容量の3つだけを持つ非所有型。
+ * FixedString<N> から暗黙変換できるため、FixedString を受け取る関数を
+ * 容量ごとにテンプレート化する必要がなくなり、インスタンス化の重複を避けられる。
+ *
+ * 容量の上限とnull終端の保証は FixedString と同じ。
+ *
+ * @note 参照先の FixedString より長く保持しないこと
+ *
+ * @par 使用例
+ * @code
+ * // 容量に依存しない関数（1回だけインスタンス化される）
+ * void append_reading(FixedStringRef out, std::string_view name) {
+ *     out.append(name);
+ *     out.append('=');
+ * }
+ *
+ * FixedString<32> small;
+ * FixedString<256> large;
+ * append_reading(small, "temp");
+ * append_reading(large, "humidity");
+ * @endcode
+ */
+class FixedStringRef : public String<FixedStringRef> {
+public:
+    /**
+     * @brief バッファを指定して構築
+     *
+     * @param buffer capacity + 1 バイト以上のバッファ（null終端用）
+     * @param length 現在のバイト長（buffer[*length] は '\0' であること）
+     * @param capacity 最大バイト長
+     */
+    constexpr FixedStringRef(char* buffer, uint32_t* length, uint32_t capacity) noexcept : buffer_(buffer), length_(length), capacity_(capacity) {}
+
+    /**
+     * @brief 容量を取得
+     */
+    [[nodiscard]] constexpr uint32_t capacity() const noexcept { return capacity_; }
+
+    /**
+     * @brief バイト長を取得
+     */
+    [[nodiscard]] constexpr uint32_t byte_length() const noexcept { return *length_; }
+
+    /**
+     * @brief サイズを取得（byte_length()のエイリアス、std::string互換）
+     */
+    [[nodiscard]] constexpr size_t size() const noexcept { return *length_; }
+
+    /**
+     * @brief 残り容量を取得
+     */
+    [[nodiscard]] constexpr uint32_t remaining() const noexcept { return capacity_ - *length_; }
+
+    /**
+     * @brief データへのポインタを取得
+     */
+    [[nodiscard]] constexpr const char* data() const noexcept { return buffer_; }
+
+    /**
+     * @brief C文字列として取得（null終端保証）
+     */
+    [[nodiscard]] constexpr const char* c_str() const noexcept { return buffer_; }
+
+    /**
+     * @brief std::string_viewに変換
+     */
+    [[nodiscard]] constexpr std::string_view view() const noexcept { return std::string_view {buffer_, *length_}; }
+
+    /**
+     * @brief std::string_viewへの暗黙変換
+     */
+    [[nodiscard]] constexpr operator std::string_view() const noexcept { return view(); }
+
+    /**
+     * @brief 文字列を追加
+     *
+     * 全体が収まらない場合は何も追加しない。
+     */
+    constexpr bool append(std::string_view view) noexcept {
+        const auto view_size = static_cast<uint32_t>(view.size());
+        uint32_t length = *length_;
+
+        if (length + view_size > capacity_) {
+            return false;
+        }
+
+        for (uint32_t i = 0; i < view_size; ++i) {
+            buffer_[length++] = view[i];
+        }
+
+        buffer_[length] = '\0';
+        *length_ = length;
+
+        return true;
+    }
+
+    /**
+     * @brief C文字列を追加
+     */
+    constexpr bool append(const char* str) noexcept {
+        if (str == nullptr) {
+            return false;
+        }
+
+        return append(from_c_string(str));
+    }
+
+    /**
+     * @brief 1文字追加
+     */
+    constexpr bool append(char c) noexcept {
+        uint32_t length = *length_;
+
+        if (length >= capacity_) {
+            return false;
+        }
+
+        buffer_[length++] = c;
+        buffer_[length] = '\0';
+        *length_ = length;
+
+        return true;
+    }
+
+    /**
+     * @brief 同じ文字を count 個追加
+     *
+     * 全体が収まらない場合は何も追加しない。
+     */
+    constexpr bool append(uint32_t count, char c) noexcept {
+        uint32_t length = *length_;
+
+        if (count > capacity_ - length) {
+            return false;
+        }
+
+        for (uint32_t i = 0; i < count; ++i) {
+            buffer_[length++] = c;
+        }
+
+        buffer_[length] = '\0';
+        *length_ = length;
+
+        return true;
+    }
+
+    /**
+     * @brief クリア
+     */
+    constexpr void clear() noexcept {
+        *length_ = 0;
+        buffer_[0] = '\0';
+    }
+
+    /**
+     * @brief 内容を置き換え（容量を超える部分は切り捨て）
+     */
+    constexpr void assign(std::string_view view) noexcept {
+        const auto view_size = static_cast<uint32_t>(view.size());
+        const uint32_t length = (view_size < capacity_) ? view_size : capacity_;
+
+        for (uint32_t i = 0; i < length; ++i) {
+            buffer_[i] = view[i];
+        }
+
+        buffer_[length] = '\0';
+        *length_ = length;
+    }
+
+    [[nodiscard]] bool operator==(std::string_view other) const noexcept { return equals(other); }
+
+    [[nodiscard]] bool operator!=(std::string_view other) const noexcept { return !equals(other); }
+
+    /**
+     * @brief イテレータ（開始）
+     */
+    [[nodiscard]] constexpr const char* begin() const noexcept { return buffer_; }
+
+    /**
+     * @brief イテレータ（終了）
+     */
+    [[nodiscard]] constexpr const char* end() const noexcept { return buffer_ + *length_; }
+
+private:
+    char* buffer_;
+    uint32_t* length_;
+    uint32_t capacity_;
+};
+
+} // namespace omusubi
@@ -0,0 +1,402 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <omusubi/core/result.hpp>
+#include <omusubi/core/span.hpp>
+#include <type_traits>
+
+namespace omusubi {
+
+/**
+ * @brief 固定容量の可変長配列（インプレースベクター）
+ *
+ * 最大 N 個の T を内部の未初期化領域に保持する。動的メモリ確保なし。
+ * 要素は追加時に構築され、削除時・破棄時にデストラクタが呼ばれる。
+ *
+ * - 容量超過は Result（Error::BUFFER_FULL）で通知する
+ * - トリビアルにコピー可能な型は memcpy / memmove で一括コピーする
+ * - span<T> / span<const T> として参照できる
+ *
+ * @tparam T 要素の型
+ * @tparam N 最大要素数
+ *
+ * @par 使用例
+ * @code
+ * FixedVector<Vector3, 32> samples;
+ *
+ * auto result = samples.emplace_back(x, y, z);
+ * if (result.is_err()) {
+ *     // Error::BUFFER_FULL
+ * }
+ *
+ * for (const Vector3& sample : samples) { ... }
+ * samples.erase_unordered(0);  // 末尾要素で穴埋め（O(1)）
+ * @endcode
+ */
+template <typename T, uint32_t N>
+class FixedVector {
+    static_assert(N > 0, "FixedVector capacity must be greater than 0");
+
+public:
+    using value_type = T;
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    /**
+     * @brief デフォルトコンストラクタ
+     */
+    FixedVector() noexcept = default;
+
+    /**
+     * @brief デストラクタ（全要素を破棄）
+     */
+    ~FixedVector() noexcept { destroy_range(0, size_); }
+
+    /**
+     * @brief コピーコンストラクタ
+     */
+    FixedVector(const FixedVector& other) noexcept { copy_construct(other.data(), other.size_); }
+
+    /**
+     * @brief ムーブコンストラクタ（要素ごとにムーブ）
+     */
+    FixedVector(FixedVector&& other) noexcept {
+        move_construct(other.data(), other.size_);
+        other.clear();
+    }
+
+    /**
+     * @brief コピー代入
+     */
+    FixedVector& operator=(const FixedVector& other) noexcept {
+        if (this != &other) {
+            clear();
+            copy_construct(other.data(), other.size_);
+        }
+        return *this;
+    }
+
+    /**
+     * @brief ムーブ代入（要素ごとにムーブ）
+     */
+    FixedVector& operator=(FixedVector&& other) noexcept {
+        if (this != &other) {
+            clear();
+            move_construct(other.data(), other.size_);
+            other.clear();
+        }
+        return *this;
+    }
+
+    // ========================================
+    // 容量
+    // ========================================
+
+    /**
+     * @brief 容量を取得
+     */
+    [[nodiscard]] static constexpr uint32_t capacity() noexcept { return N; }
+
+    /**
+     * @brief 要素数を取得
+     */
+    [[nodiscard]] uint32_t size() const noexcept { return size_; }
+
+    /**
+     * @brief 空か判定
+     */
+    [[nodiscard]] bool is_empty() const noexcept { return size_ == 0; }
+
+    /**
+     * @brief 満杯か判定
+     */
+    [[nodiscard]] bool is_full() const noexcept { return size_ == N; }
+
+    // ========================================
+    // 要素アクセス
+    // ========================================
+
+    /**
+     * @brief データへのポインタを取得
+     */
+    [[nodiscard]] T* data() noexcept { return std::launder(reinterpret_cast<T*>(storage_)); }
+
+    /**
+     * @brief データへのポインタを取得（読み取り専用）
+     */
+    [[nodiscard]] const T* data() const noexcept { return std::launder(reinterpret_cast<const T*>(storage_)); }
+
+    /**
+     * @brief 要素アクセス（範囲チェックなし）
+     */
+    T& operator[](uint32_t index) noexcept { return data()[index]; }
+
+    const T& operator[](uint32_t index) const noexcept { return data()[index]; }
+
+    /**
+     * @brief 範囲チェック付き要素アクセス
+     *
+     * @return 要素へのポインタ（範囲外の場合nullptr）
+     */
+    [[nodiscard]] T* at(uint32_t index) noexcept { return (index < size_) ? data() + index : nullptr; }
+
+    [[nodiscard]] const T* at(uint32_t index) const noexcept { return (index < size_) ? data() + index : nullptr; }
+
+    /**
+     * @brief 先頭要素（空でないこと）
+     */
+    T& front() noexcept { return data()[0]; }
+
+    const T& front() const noexcept { return data()[0]; }
+
+    /**
+     * @brief 末尾要素（空でないこと）
+     */
+    T& back() noexcept { return data()[size_ - 1]; }
+
+    const T& back() const noexcept { return data()[size_ - 1]; }
+
+    /**
+     * @brief イテレータ（開始）
+     */
+    [[nodiscard]] iterator begin() noexcept { return data(); }
+
+    [[nodiscard]] const_iterator begin() const noexcept { return data(); }
+
+    /**
+     * @brief イテレータ（終了）
+     */
+    [[nodiscard]] iterator end() noexcept { return data() + size_; }
+
+    [[nodiscard]] const_iterator end() const noexcept { return data() + size_; }
+
+    /**
+     * @brief spanとして取得（書き込み可能）
+     */
+    [[nodiscard]] span<T> as_span() noexcept { return span<T>(data(), size_); }
+
+    /**
+     * @brief spanとして取得（読み取り専用）
+     */
+    [[nodiscard]] span<const T> as_span() const noexcept { return span<const T>(data(), size_); }
+
+    // ========================================
+    // 変更
+    // ========================================
+
+    /**
+     * @brief 末尾に要素を直接構築
+     *
+     * @return 構築した要素へのポインタ（満杯の場合は Error::BUFFER_FULL）
+     */
+    template <typename... Args>
+    // NOLINTNEXTLINE(cppcoreguidelines-missing-std-forward)
+    Result<T*> emplace_back(Args&&... args) noexcept {
+        if (size_ >= N) {
+            return Result<T*>::err(Error::BUFFER_FULL);
+        }
+
+        T* element = new (data() + size_) T(static_cast<Args&&>(args)...);
+        ++size_;
+        return Result<T*>::ok(element);
+    }
+
+    /**
+     * @brief 末尾に要素を追加（コピー）
+     */
+    Result<T*> push_back(const T& value) noexcept { return emplace_back(value); }
+
+    /**
+     * @brief 末尾に要素を追加（ムーブ）
+     */
+    Result<T*> push_back(T&& value) noexcept { return emplace_back(static_cast<T&&>(value)); }
+
+    /**
+     * @brief 複数要素を末尾に追加
+     *
+     * 全体が収まらない場合は何も追加しない。
+     *
+     * @return 追加後の要素数（容量不足の場合は Error::BUFFER_FULL）
+     */
+    Result<uint32_t> append(span<const T> values) noexcept {
+        const auto count = static_cast<uint32_t>(values.size());
+        if (count > N - size_) {
+            return Result<uint32_t>::err(Error::BUFFER_FULL);
+        }
+
+        T* dest = data() + size_;
+        if constexpr (std::is_trivially_copyable_v<T>) {
+            if (count > 0) {
+                std::memcpy(dest, values.data(), sizeof(T) * count);
+            }
+        } else {
+            for (uint32_t i = 0; i < count; ++i) {
+                new (dest + i) T(values[i]);
+            }
+        }
+
+        size_ += count;
+        return Result<uint32_t>::ok(size_);
+    }
+
+    /**
+     * @brief 指定位置に要素を直接構築（後続要素は後ろへずれる）
+     *
+     * @return 構築した要素へのポインタ（満杯の場合は Error::BUFFER_FULL、範囲外の場合は Error::INVALID_PARAMETER）
+     */
+    template <typename... Args>
+    // NOLINTNEXTLINE(cppcoreguidelines-missing-std-forward)
+    Result<T*> emplace(uint32_t index, Args&&... args) noexcept {
+        if (index > size_) {
+            return Result<T*>::err(Error::INVALID_PARAMETER);
+        }
+        if (size_ >= N) {
+            return Result<T*>::err(Error::BUFFER_FULL);
+        }
+
+        if (index == size_) {
+            return emplace_back(static_cast<Args&&>(args)...);
+        }
+
+        // 引数が自身の要素を参照している場合に備え、先に構築してから移動する
+        T value(static_cast<Args&&>(args)...);
+        T* elements = data();
+
+        if constexpr (std::is_trivially_copyable_v<T>) {
+            std::memmove(elements + index + 1, elements + index, sizeof(T) * (size_ - index));
+            std::memcpy(elements + index, &value, sizeof(T));
+        } else {
+            new (elements + size_) T(static_cast<T&&>(elements[size_ - 1]));
+            for (uint32_t i = size_ - 1; i > index; --i) {
+                elements[i] = static_cast<T&&>(elements[i - 1]);
+            }
+            elements[index] = static_cast<T&&>(value);
+        }
+
+        ++size_;
+        return Result<T*>::ok(elements + index);
+    }
+
+    /**
+     * @brief 指定位置に要素を挿入
+     */
+    Result<T*> insert(uint32_t index, const T& value) noexcept { return emplace(index, value); }
+
+    /**
+     * @brief 末尾要素を削除
+     *
+     * @return 空の場合false
+     */
+    bool pop_back() noexcept {
+        if (size_ == 0) {
+            return false;
+        }
+
+        --size_;
+        data()[size_].~T();
+        return true;
+    }
+
+    /**
+     * @brief 指定位置の要素を削除（順序を維持、O(n)）
+     *
+     * @return 範囲外の場合false
+     */
+    bool erase(uint32_t index) noexcept {
+        if (index >= size_) {
+            return false;
+        }
+
+        T* elements = data();
+
+        if constexpr (std::is_trivially_copyable_v<T>) {
+            std::memmove(elements + index, elements + index + 1, sizeof(T) * (size_ - index - 1));
+        } else {
+            for (uint32_t i = index; i + 1 < size_; ++i) {
+                elements[i] = static_cast<T&&>(elements[i + 1]);
+            }
+        }
+
+        return pop_back();
+    }
+
+    /**
+     * @brief 指定位置の要素を削除（末尾要素で穴埋め、順序は維持しない、O(1)）
+     *
+     * @return 範囲外の場合false
+     */
+    bool erase_unordered(uint32_t index) noexcept {
+        if (index >= size_) {
+            return false;
+        }
+
+        if (index != size_ - 1) {
+            T* elements = data();
+            elements[index] = static_cast<T&&>(elements[size_ - 1]);
+        }
+
+        return pop_back();
+    }
+
+    /**
+     * @brief 全要素を削除
+     */
+    void clear() noexcept {
+        destroy_range(0, size_);
+        size_ = 0;
+    }
+
+    /**
+     * @brief spanの内容で置き換え（容量を超える部分は切り捨て）
+     */
+    void from_span(span<const T> values) noexcept {
+        clear();
+        const auto count = static_cast<uint32_t>(values.size());
+        append(span<const T>(values.data(), (count < N) ? count : N));
+    }
+
+private:
+    void destroy_range(uint32_t first, uint32_t last) noexcept {
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            T* elements = data();
+            for (uint32_t i = first; i < last; ++i) {
+                elements[i].~T();
+            }
+        }
+    }
+
+    void copy_construct(const T* source, uint32_t count) noexcept {
+        T* dest = data();
+        if constexpr (std::is_trivially_copyable_v<T>) {
+            if (count > 0) {
+                std::memcpy(dest, source, sizeof(T) * count);
+            }
+        } else {
+            for (uint32_t i = 0; i < count; ++i) {
+                new (dest + i) T(source[i]);
+            }
+        }
+        size_ = count;
+    }
+
+    void move_construct(T* source, uint32_t count) noexcept {
+        T* dest = data();
+        if constexpr (std::is_trivially_copyable_v<T>) {
+            if (count > 0) {
+                std::memcpy(dest, source, sizeof(T) * count);
+            }
+        } else {
+            for (uint32_t i = 0; i < count; ++i) {
+                new (dest + i) T(static_cast<T&&>(source[i]));
+            }
+        }
+        size_ = count;
+    }
+
+    alignas(T) unsigned char storage_[sizeof(T) * N];
+    uint32_t size_ = 0;
+};
+
+} // namespace omusubi
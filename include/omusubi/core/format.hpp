@@ -23,7 +23,9 @@
  */
 
 #include <cstdint>
+#include <omusubi/core/display_width.hpp>
 #include <omusubi/core/fixed_string.hpp>
+#include <omusubi/core/fixed_string_ref.hpp>
 #include <string_view>
 #include <type_traits>
 
@@ -47,6 +49,18 @@ constexpr uint32_t count_placeholders(const char* str, uint32_t len) noexcept {
                 // プレースホルダー '{}' をカウント
                 ++count;
                 i += 2;
+            } else if (i + 1 < len && str[i + 1] == ':') {
+                // 書式指定付きプレースホルダー '{:...}' をカウント
+                uint32_t close = i + 2;
+                while (close < len && str[close] != '}') {
+                    ++close;
+                }
+                if (close < len) {
+                    ++count;
+                    i = close + 1;
+                } else {
+                    ++i;
+                }
             } else {
                 // 不正なフォーマット（'{'の後に'}'がない）
                 ++i;
@@ -366,10 +380,10 @@ constexpr uint32_t unsigned_to_string(T value, char* buffer, uint32_t buffer_siz
 }
 
 /**
- * @brief 16進数文字列に変換
+ * @brief 基数を指定して符号なしの値を文字列に変換（2〜16進数）
  */
 template <typename T>
-constexpr uint32_t hex_to_string(T value, char* buffer, uint32_t buffer_size, bool uppercase = false) noexcept {
+constexpr uint32_t radix_to_string(T value, uint32_t base, char* buffer, uint32_t buffer_size, bool uppercase = false) noexcept {
     const char* digits = uppercase ? "0123456789ABCDEF" : "0123456789abcdef";
 
     uint32_t pos = 0;
@@ -379,10 +393,10 @@ constexpr uint32_t hex_to_string(T value, char* buffer, uint32_t buffer_size, bo
         }
         buffer[pos++] = '0';
     } else {
-        // 逆順で16進数を格納
+        // 逆順で数字を格納
         while (value > 0 && pos < buffer_size) {
-            buffer[pos++] = digits[value % 16];
-            value /= 16;
+            buffer[pos++] = digits[value % base];
+            value /= base;
         }
 
         // 反転
@@ -396,6 +410,14 @@ constexpr uint32_t hex_to_string(T value, char* buffer, uint32_t buffer_size, bo
     return pos;
 }
 
+/**
+ * @brief 16進数文字列に変換
+ */
+template <typename T>
+constexpr uint32_t hex_to_string(T value, char* buffer, uint32_t buffer_size, bool uppercase = false) noexcept {
+    return radix_to_string(value, 16, buffer, buffer_size, uppercase);
+}
+
 /**
  * @brief 型の素の型を取得（std::decayの簡易版）
  */
@@ -518,11 +540,135 @@ struct formatter {
     }
 };
 
+/**
+ * @brief 書式指定（{:[[fill]align][width][.precision][type]}）
+ *
+ * - align: '<' 左寄せ、'>' 右寄せ、'^' 中央寄せ（省略時は文字列が左寄せ、数値が右寄せ）
+ * - width: 最小表示幅（桁数）。全角文字は2桁として数える
+ * - precision: 文字列の最大表示幅。全角文字の途中で切れることはない
+ * - type: 'd' 10進数、'x' / 'X' 16進数、'b' 2進数（整数のみ）。'f' / 's' は既定の表記
+ */
+struct FormatSpec {
+    uint32_t width;
+    uint32_t precision; ///< UINT32_MAX: 指定なし
+    char fill;
+    char align; ///< '\0': 型ごとのデフォルト
+    char type;  ///< '\0': 指定なし
+    bool valid; ///< false: 解釈できない書式指定
+};
+
+/**
+ * @brief 書式指定を解析
+ * @param spec ':' と '}' の間の文字列
+ */
+constexpr FormatSpec parse_format_spec(std::string_view spec) noexcept {
+    FormatSpec result {0, UINT32_MAX, ' ', '\0', '\0', true};
+    const auto spec_len = static_cast<uint32_t>(spec.size());
+    uint32_t pos = 0;
+
+    const auto is_align = [](char c) { return c == '<' || c == '>' || c == '^'; };
+
+    if (spec_len >= 2 && is_align(spec[1])) {
+        result.fill = spec[0];
+        result.align = spec[1];
+        pos = 2;
+    } else if (spec_len >= 1 && is_align(spec[0])) {
+        result.align = spec[0];
+        pos = 1;
+    }
+
+    while (pos < spec_len && spec[pos] >= '0' && spec[pos] <= '9') {
+        result.width = result.width * 10 + static_cast<uint32_t>(spec[pos] - '0');
+        ++pos;
+    }
+
+    if (pos < spec_len && spec[pos] == '.') {
+        ++pos;
+        result.precision = 0;
+        while (pos < spec_len && spec[pos] >= '0' && spec[pos] <= '9') {
+            result.precision = result.precision * 10 + static_cast<uint32_t>(spec[pos] - '0');
+            ++pos;
+        }
+    }
+
+    if (pos < spec_len) {
+        const char type = spec[pos];
+        if (type == 'd' || type == 'x' || type == 'X' || type == 'b' || type == 'f' || type == 's') {
+            result.type = type;
+            ++pos;
+        }
+    }
+
+    result.valid = (pos == spec_len);
+    return result;
+}
+
+/**
+ * @brief 型指定に従って値を文字列に変換
+ *
+ * 'x' / 'X' / 'b' は整数型（bool・char を除く）のみ基数を変え、負数は '-' と絶対値で表す。
+ * それ以外は formatter の既定の表記になる。
+ */
+template <typename T>
+constexpr uint32_t to_string_with_type(T value, char type, char* buffer, uint32_t buffer_size) noexcept {
+    if constexpr (std::is_integral_v<T> && !std::is_same_v<T, bool> && !std::is_same_v<T, char>) {
+        if (type == 'x' || type == 'X' || type == 'b') {
+            using unsigned_type = std::make_unsigned_t<T>;
+            auto magnitude = static_cast<unsigned_type>(value);
+            uint32_t pos = 0;
+            if constexpr (std::is_signed_v<T>) {
+                if (value < 0) {
+                    magnitude = static_cast<unsigned_type>(unsigned_type {0} - magnitude);
+                    if (buffer_size == 0) {
+                        return 0;
+                    }
+                    buffer[pos++] = '-';
+                }
+            }
+            const uint32_t base = (type == 'b') ? 2 : 16;
+            return pos + radix_to_string(magnitude, base, buffer + pos, buffer_size - pos, type == 'X');
+        }
+    }
+    return formatter<T>::to_string(value, buffer, buffer_size);
+}
+
+/**
+ * @brief 表示幅を考慮して配置した文字列を追加
+ *
+ * @param is_text 文字列型の場合true（precisionによる切り詰めと左寄せが既定）
+ */
+inline void append_aligned(FixedStringRef result, std::string_view text, const FormatSpec& spec, bool is_text) noexcept {
+    if (is_text && spec.precision != UINT32_MAX) {
+        text = truncate_to_width(text, spec.precision);
+    }
+
+    const uint32_t columns = display_width(text);
+    const uint32_t padding = (spec.width > columns) ? spec.width - columns : 0;
+    const char align = (spec.align != '\0') ? spec.align : (is_text ? '<' : '>');
+
+    uint32_t left = 0;
+    if (align == '>') {
+        left = padding;
+    } else if (align == '^') {
+        left = padding / 2;
+    }
+
+    result.append(left, spec.fill);
+
+    if (!text.empty()) {
+        result.append(text);
+    }
+
+    result.append(padding - left, spec.fill);
+}
+
 /**
  * @brief 再帰終了
+ *
+ * format_impl は出力先を FixedStringRef で受け取るため、
+ * 結果の容量ごとではなく引数の型の組み合わせごとに1回だけインスタンス化される。
  */
-template <uint32_t Capacity>
-void format_impl(FixedString<Capacity>& result, std::string_view format_str, uint32_t& /*arg_index*/) noexcept {
+inline void format_impl(FixedStringRef result, std::string_view format_str, uint32_t& /*arg_index*/) noexcept {
     // 残りの文字列を追加
     uint32_t pos = 0;
     auto format_len = static_cast<uint32_t>(format_str.size());
@@ -544,9 +690,9 @@ void format_impl(FixedString<Capacity>& result, std::string_view format_str, uin
 /**
  * @brief フォーマット実装（可変長引数）
  */
-template <uint32_t Capacity, typename T, typename... Args>
+template <typename T, typename... Args>
 // NOLINTNEXTLINE(cppcoreguidelines-missing-std-forward)
-void format_impl(FixedString<Capacity>& result, std::string_view format_str, uint32_t& arg_index, T&& value, Args&&... args) noexcept {
+void format_impl(FixedStringRef result, std::string_view format_str, uint32_t& arg_index, T&& value, Args&&... args) noexcept {
     // フォーマット文字列を解析
     uint32_t pos = 0;
     auto format_len = static_cast<uint32_t>(format_str.size());
@@ -570,6 +716,37 @@ void format_impl(FixedString<Capacity>& result, std::string_view format_str, uin
                 return;
             }
 
+            if (pos + 1 < format_len && format_str[pos + 1] == ':') {
+                // 書式指定付きプレースホルダー '{:...}'
+                uint32_t close = pos + 2;
+                while (close < format_len && format_str[close] != '}') {
+                    ++close;
+                }
+
+                if (close < format_len) {
+                    const FormatSpec spec = parse_format_spec(std::string_view(format_str.data() + pos + 2, close - pos - 2));
+                    if (!spec.valid) {
+                        // 解釈できない書式指定はそのまま出力し、引数は次のプレースホルダーへ回す
+                        result.append(std::string_view(format_str.data() + pos, close + 1 - pos));
+                        pos = close + 1;
+                        continue;
+                    }
+
+                    using value_type = typename remove_cv_ref<T>::type;
+                    constexpr bool is_text = !std::is_arithmetic_v<value_type> || std::is_same_v<value_type, bool> || std::is_same_v<value_type, char>;
+
+                    char buffer[72] = {};
+                    const uint32_t len = to_string_with_type<value_type>(value, spec.type, buffer, sizeof(buffer));
+                    append_aligned(result, std::string_view(buffer, len), spec, is_text);
+
+                    // 次の引数へ
+                    ++arg_index;
+                    format_impl(result, std::string_view(format_str.data() + close + 1, format_len - close - 1), arg_index, args...);
+
+                    return;
+                }
+            }
+
             if (pos + 1 < format_len && format_str[pos + 1] == '{') {
                 // エスケープされた '{{' → '{'
                 result.append('{');
@@ -643,6 +820,9 @@ constexpr FixedString<Capacity> format(const char (&format_str)[N], Args&&... ar
  *
  * 文字列リテラルと引数の型から必要な容量を自動計算
  *
+ * @note 書式指定の幅（"{:>20}" など）と2進数表記（"{:b}"）の桁数は容量計算に含まれない。
+ *       これらを使う場合は format<Capacity>() で容量を明示すること。
+ *
  * 使用例:
  * @code
  * auto str = format("Hello, {}! Value: {}", "World", 42);
@@ -687,10 +867,9 @@ FixedString<Capacity> format_hex(T value, bool uppercase = false) noexcept {
 /**
  * @brief 文字列フォーマット（basic_format_string版）- 主要実装
  *
- * @tparam N 出力バッファの容量
  * @tparam FmtArgs フォーマット文字列が期待する型
  * @tparam Args 実際の引数の型
- * @param result 出力先のFixedString
+ * @param result 出力先（FixedString<N> から暗黙変換される）
  * @param format_str フォーマット文字列
  * @param args フォーマット引数
  * @return bool 常にtrue（将来の拡張用）
@@ -702,9 +881,9 @@ FixedString<Capacity> format_hex(T value, bool uppercase = false) noexcept {
  * format_to(str, fs, "Alice", 25);
  * @endcode
  */
-template <uint32_t N, typename... FmtArgs, typename... Args>
+template <typename... FmtArgs, typename... Args>
 // NOLINTNEXTLINE(cppcoreguidelines-missing-std-forward)
-constexpr bool format_to(FixedString<N>& result, const basic_format_string<FmtArgs...>& format_str, Args&&... args) noexcept {
+constexpr bool format_to(FixedStringRef result, const basic_format_string<FmtArgs...>& format_str, Args&&... args) noexcept {
     result.clear();
     uint32_t arg_index = 0;
     detail::format_impl(result, format_str.view(), arg_index, args...);
@@ -722,9 +901,9 @@ constexpr bool format_to(FixedString<N>& result, const basic_format_string<FmtAr
  * format_to(str, "Hello, {}! Value: {}", "World", 42);
  * @endcode
  */
-template <uint32_t N, uint32_t M, typename... Args>
+template <uint32_t M, typename... Args>
 // NOLINTNEXTLINE(cppcoreguidelines-missing-std-forward)
-constexpr bool format_to(FixedString<N>& result, const char (&format_str)[M], Args&&... args) noexcept {
+constexpr bool format_to(FixedStringRef result, const char (&format_str)[M], Args&&... args) noexcept {
     return format_to(result, basic_format_string<Args...>(format_str), args...);
 }
 
@@ -753,17 +932,17 @@ constexpr auto format_to(const char (&format_str)[N], Args&&... args) noexcept -
  *
  * 実行時に構築されたstd::string_viewから使用
  */
-template <uint32_t N, typename... Args>
+template <typename... Args>
 // NOLINTNEXTLINE(cppcoreguidelines-missing-std-forward)
-constexpr bool format_to(FixedString<N>& result, std::string_view format_str, Args&&... args) noexcept {
+constexpr bool format_to(FixedStringRef result, std::string_view format_str, Args&&... args) noexcept {
     return format_to(result, basic_format_string<Args...>(format_str), args...);
 }
 
 /**
  * @brief 16進数フォーマット（テンプレート引数隠蔽版）
  */
-template <uint32_t N, typename T>
-bool format_hex_to(FixedString<N>& result, T value, bool uppercase = false) noexcept {
+template <typename T>
+bool format_hex_to(FixedStringRef result, T value, bool uppercase = false) noexcept {
     result.clear();
     result.append("0x");
 
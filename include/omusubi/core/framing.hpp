@@ -0,0 +1,514 @@
+#pragma once
+
+#include <cstdint>
+#include <omusubi/core/crc.hpp>
+#include <omusubi/core/span.hpp>
+#include <omusubi/interface/writable.h>
+
+namespace omusubi {
+
+/**
+ * @brief フレームデコーダの統計情報
+ */
+struct FrameStats {
+    uint32_t frames;          ///< 正常に受信したフレーム数
+    uint32_t crc_errors;      ///< CRC不一致で破棄したフレーム数
+    uint32_t overflow_errors; ///< 最大フレーム長を超えて破棄したフレーム数
+    uint32_t format_errors;   ///< 符号化の誤り・短すぎるフレームで破棄した数
+};
+
+/**
+ * @brief フレームに付加するCRCのバイト数（CRC-16、ビッグエンディアン）
+ */
+inline constexpr uint32_t FRAME_CRC_SIZE = 2;
+
+// ========================================
+// COBS
+// ========================================
+
+/**
+ * @brief COBS（Consistent Overhead Byte Stuffing）ストリーミングエンコーダ
+ *
+ * ペイロードを任意の大きさのチャンクに分けて write() し、end() でフレームを閉じる。
+ * 0x00 を含まない符号列の後に区切りの 0x00 を送るため、受信側は 0x00 を待つだけで再同期できる。
+ * オーバーヘッドは254バイトごとに最大1バイト。
+ *
+ * - CRC-16 は符号化と同じ走査で計算し、end() でペイロードの後ろに付加する（2パス目なし）
+ * - 符号化したブロックは符号バイトとデータを writev() でそのまま出力する
+ * - 内部状態は254バイトのブロックバッファのみ
+ *
+ * @par 使用例
+ * @code
+ * CobsEncoder encoder(*serial);
+ * encoder.begin();
+ * encoder.write(header);
+ * encoder.write(payload);
+ * encoder.end();  // CRC + 区切り 0x00
+ * @endcode
+ */
+class CobsEncoder {
+public:
+    /** @brief 1ブロックの最大データ長 */
+    static constexpr uint32_t MAX_BLOCK = 254;
+
+    explicit CobsEncoder(ByteWritable& output) noexcept : output_(&output) {}
+
+    /**
+     * @brief フレームを開始
+     */
+    void begin() noexcept {
+        block_length_ = 0;
+        crc_.reset();
+        failed_ = false;
+    }
+
+    /**
+     * @brief ペイロードの一部を符号化して出力
+     *
+     * @return 出力が書き込みに失敗した場合false（以降 end() まで失敗のまま）
+     */
+    bool write(span<const uint8_t> chunk) noexcept {
+        crc_.update(chunk);
+        encode(chunk);
+        return !failed_;
+    }
+
+    /**
+     * @brief CRCと区切りを出力してフレームを閉じる
+     *
+     * @return フレーム全体を出力できた場合true
+     */
+    bool end() noexcept {
+        const uint16_t crc = crc_.value();
+        const uint8_t crc_bytes[FRAME_CRC_SIZE] = {static_cast<uint8_t>(crc >> 8), static_cast<uint8_t>(crc)};
+        encode(span<const uint8_t>(crc_bytes));
+
+        flush_block();
+        const uint8_t delimiter = 0x00;
+        emit(span<const uint8_t>(&delimiter, 1), span<const uint8_t>());
+        return !failed_;
+    }
+
+    /**
+     * @brief ペイロード全体を1フレームとして出力
+     */
+    bool write_frame(span<const uint8_t> payload) noexcept {
+        begin();
+        write(payload);
+        return end();
+    }
+
+private:
+    void encode(span<const uint8_t> data) noexcept {
+        for (uint8_t byte : data) {
+            if (byte == 0) {
+                flush_block();
+                continue;
+            }
+
+            block_[block_length_++] = byte;
+            if (block_length_ == MAX_BLOCK) {
+                flush_block();
+            }
+        }
+    }
+
+    /**
+     * @brief 符号バイト（データ長 + 1）とブロックを出力
+     */
+    void flush_block() noexcept {
+        const auto code = static_cast<uint8_t>(block_length_ + 1);
+        emit(span<const uint8_t>(&code, 1), span<const uint8_t>(block_, block_length_));
+        block_length_ = 0;
+    }
+
+    void emit(span<const uint8_t> first, span<const uint8_t> second) noexcept {
+        if (failed_) {
+            return;
+        }
+
+        const span<const uint8_t> parts[] = {first, second};
+        const size_t expected = first.size() + second.size();
+        if (output_->writev(span<const span<const uint8_t>>(parts, second.empty() ? 1 : 2)) != expected) {
+            failed_ = true;
+        }
+    }
+
+    ByteWritable* output_;
+    Crc16 crc_;
+    uint32_t block_length_ = 0;
+    bool failed_ = false;
+    uint8_t block_[MAX_BLOCK];
+};
+
+/**
+ * @brief COBS ストリーミングデコーダ
+ *
+ * 受信したチャンクを feed() するたびに、完成したフレームのペイロードを
+ * コールバックへ span<const uint8_t> として渡す（CRCは検証済みで取り除かれている）。
+ * 誤りのあるフレームは次の区切り 0x00 まで読み捨て、統計に記録する。
+ * CRCは復号と同じ走査で計算する。
+ *
+ * @tparam MaxFrameSize ペイロードの最大長（CRCを除く）
+ *
+ * @par 使用例
+ * @code
+ * static CobsDecoder<256> decoder;
+ *
+ * uint8_t rx[64];
+ * size_t n = serial->read(span<uint8_t>(rx));
+ * decoder.feed(span<const uint8_t>(rx, n), [](span<const uint8_t> frame) { handle(frame); });
+ * @endcode
+ */
+template <uint32_t MaxFrameSize>
+class CobsDecoder {
+public:
+    /**
+     * @brief 受信データを復号
+     *
+     * @param chunk 受信データ（任意の位置で分割されていてよい）
+     * @param on_frame 完成したフレームごとに呼ばれる関数オブジェクト（span<const uint8_t>）
+     * @return このチャンクで完成したフレーム数
+     */
+    template <typename F>
+    // NOLINTNEXTLINE(cppcoreguidelines-missing-std-forward)
+    uint32_t feed(span<const uint8_t> chunk, F&& on_frame) noexcept {
+        uint32_t completed = 0;
+
+        for (uint8_t byte : chunk) {
+            if (byte == 0) {
+                if (finish_frame()) {
+                    on_frame(span<const uint8_t>(frame_, length_ - FRAME_CRC_SIZE));
+                    ++completed;
+                }
+                reset();
+                continue;
+            }
+
+            if (dropping_) {
+                continue;
+            }
+
+            if (remaining_ == 0) {
+                // 直前のブロックが 0xFF 未満なら、その後ろに 0x00 があった
+                if (code_ != 0 && code_ != 0xFF) {
+                    append(0);
+                }
+                code_ = byte;
+                remaining_ = static_cast<uint8_t>(byte - 1);
+            } else {
+                append(byte);
+                --remaining_;
+            }
+        }
+
+        return completed;
+    }
+
+    /**
+     * @brief 受信途中のフレームを破棄
+     */
+    void reset() noexcept {
+        length_ = 0;
+        code_ = 0;
+        remaining_ = 0;
+        dropping_ = false;
+        crc_.reset();
+    }
+
+    /**
+     * @brief 統計情報を取得
+     */
+    [[nodiscard]] const FrameStats& get_stats() const noexcept { return stats_; }
+
+private:
+    void append(uint8_t byte) noexcept {
+        if (length_ >= sizeof(frame_)) {
+            ++stats_.overflow_errors;
+            dropping_ = true;
+            return;
+        }
+        frame_[length_++] = byte;
+        crc_.update(byte);
+    }
+
+    /**
+     * @brief 区切りを受信した時点でフレームを検証
+     */
+    bool finish_frame() noexcept {
+        if (dropping_) {
+            return false;
+        }
+        if (code_ == 0) {
+            return false; // 連続した区切り（空フレーム）は無視
+        }
+        if (remaining_ != 0 || length_ < FRAME_CRC_SIZE) {
+            ++stats_.format_errors;
+            return false;
+        }
+        if (crc_.value() != 0) {
+            ++stats_.crc_errors;
+            return false;
+        }
+
+        ++stats_.frames;
+        return true;
+    }
+
+    uint8_t frame_[MaxFrameSize + FRAME_CRC_SIZE];
+    uint32_t length_ = 0;
+    Crc16 crc_;
+    uint8_t code_ = 0;
+    uint8_t remaining_ = 0;
+    bool dropping_ = false;
+    FrameStats stats_ {};
+};
+
+// ========================================
+// SLIP
+// ========================================
+
+/**
+ * @brief SLIP（RFC 1055）の特殊バイト
+ */
+struct Slip {
+    static constexpr uint8_t END = 0xC0;
+    static constexpr uint8_t ESC = 0xDB;
+    static constexpr uint8_t ESC_END = 0xDC;
+    static constexpr uint8_t ESC_ESC = 0xDD;
+};
+
+/**
+ * @brief SLIP ストリーミングエンコーダ
+ *
+ * END（0xC0）と ESC（0xDB）をエスケープし、フレームの前後に END を送る。
+ * エスケープ不要な区間は入力チャンクを直接参照し、エスケープ列は定数を参照して
+ * writev() でまとめて出力するため、内部でのコピーは発生しない。
+ * CRC-16 は符号化と同じ走査で計算し、end() で付加する。
+ *
+ * @par 使用例
+ * @code
+ * SlipEncoder encoder(*serial);
+ * encoder.write_frame(payload);
+ * @endcode
+ */
+class SlipEncoder {
+public:
+    explicit SlipEncoder(ByteWritable& output) noexcept : output_(&output) {}
+
+    /**
+     * @brief フレームを開始（受信側の途中データを区切るため END を送る）
+     */
+    void begin() noexcept {
+        crc_.reset();
+        part_count_ = 0;
+        failed_ = false;
+        push(span<const uint8_t>(&END_BYTE, 1));
+    }
+
+    /**
+     * @brief ペイロードの一部を符号化して出力
+     *
+     * @return 出力が書き込みに失敗した場合false
+     */
+    bool write(span<const uint8_t> chunk) noexcept {
+        crc_.update(chunk);
+        encode(chunk);
+        flush();
+        return !failed_;
+    }
+
+    /**
+     * @brief CRCと END を出力してフレームを閉じる
+     */
+    bool end() noexcept {
+        const uint16_t crc = crc_.value();
+        crc_bytes_[0] = static_cast<uint8_t>(crc >> 8);
+        crc_bytes_[1] = static_cast<uint8_t>(crc);
+        encode(span<const uint8_t>(crc_bytes_));
+        push(span<const uint8_t>(&END_BYTE, 1));
+        flush();
+        return !failed_;
+    }
+
+    /**
+     * @brief ペイロード全体を1フレームとして出力
+     */
+    bool write_frame(span<const uint8_t> payload) noexcept {
+        begin();
+        write(payload);
+        return end();
+    }
+
+private:
+    static constexpr uint32_t MAX_PARTS = 16;
+    static constexpr uint8_t END_BYTE = Slip::END;
+    static constexpr uint8_t ESCAPED_END[2] = {Slip::ESC, Slip::ESC_END};
+    static constexpr uint8_t ESCAPED_ESC[2] = {Slip::ESC, Slip::ESC_ESC};
+
+    void encode(span<const uint8_t> data) noexcept {
+        size_t run_start = 0;
+
+        for (size_t i = 0; i < data.size(); ++i) {
+            const uint8_t byte = data[i];
+            if (byte != Slip::END && byte != Slip::ESC) {
+                continue;
+            }
+
+            if (i > run_start) {
+                push(data.subspan(run_start, i - run_start));
+            }
+            push(span<const uint8_t>((byte == Slip::END) ? ESCAPED_END : ESCAPED_ESC, 2));
+            run_start = i + 1;
+        }
+
+        if (data.size() > run_start) {
+            push(data.subspan(run_start, data.size() - run_start));
+        }
+    }
+
+    void push(span<const uint8_t> part) noexcept {
+        if (part_count_ == MAX_PARTS) {
+            flush();
+        }
+        parts_[part_count_++] = part;
+    }
+
+    /**
+     * @brief 溜めた区間を writev() で出力
+     *
+     * 区間は入力チャンクを参照しているため、write() から戻る前に必ず出力する。
+     */
+    void flush() noexcept {
+        if (part_count_ == 0) {
+            return;
+        }
+
+        size_t expected = 0;
+        for (uint32_t i = 0; i < part_count_; ++i) {
+            expected += parts_[i].size();
+        }
+
+        if (!failed_ && output_->writev(span<const span<const uint8_t>>(parts_, part_count_)) != expected) {
+            failed_ = true;
+        }
+        part_count_ = 0;
+    }
+
+    ByteWritable* output_;
+    Crc16 crc_;
+    span<const uint8_t> parts_[MAX_PARTS];
+    uint32_t part_count_ = 0;
+    uint8_t crc_bytes_[FRAME_CRC_SIZE] = {};
+    bool failed_ = false;
+};
+
+/**
+ * @brief SLIP ストリーミングデコーダ
+ *
+ * CobsDecoder と同じく、完成したフレームのペイロード（CRC検証済み）をコールバックへ渡す。
+ *
+ * @tparam MaxFrameSize ペイロードの最大長（CRCを除く）
+ */
+template <uint32_t MaxFrameSize>
+class SlipDecoder {
+public:
+    /**
+     * @brief 受信データを復号
+     *
+     * @return このチャンクで完成したフレーム数
+     */
+    template <typename F>
+    // NOLINTNEXTLINE(cppcoreguidelines-missing-std-forward)
+    uint32_t feed(span<const uint8_t> chunk, F&& on_frame) noexcept {
+        uint32_t completed = 0;
+
+        for (uint8_t byte : chunk) {
+            if (byte == Slip::END) {
+                if (finish_frame()) {
+                    on_frame(span<const uint8_t>(frame_, length_ - FRAME_CRC_SIZE));
+                    ++completed;
+                }
+                reset();
+                continue;
+            }
+
+            if (dropping_) {
+                continue;
+            }
+
+            if (escaped_) {
+                escaped_ = false;
+                if (byte == Slip::ESC_END) {
+                    append(Slip::END);
+                } else if (byte == Slip::ESC_ESC) {
+                    append(Slip::ESC);
+                } else {
+                    ++stats_.format_errors;
+                    dropping_ = true;
+                }
+            } else if (byte == Slip::ESC) {
+                escaped_ = true;
+            } else {
+                append(byte);
+            }
+        }
+
+        return completed;
+    }
+
+    /**
+     * @brief 受信途中のフレームを破棄
+     */
+    void reset() noexcept {
+        length_ = 0;
+        escaped_ = false;
+        dropping_ = false;
+        crc_.reset();
+    }
+
+    /**
+     * @brief 統計情報を取得
+     */
+    [[nodiscard]] const FrameStats& get_stats() const noexcept { return stats_; }
+
+private:
+    void append(uint8_t byte) noexcept {
+        if (length_ >= sizeof(frame_)) {
+            ++stats_.overflow_errors;
+            dropping_ = true;
+            return;
+        }
+        frame_[length_++] = byte;
+        crc_.update(byte);
+    }
+
+    bool finish_frame() noexcept {
+        if (dropping_) {
+            return false;
+        }
+        if (length_ == 0 && !escaped_) {
+            return false; // 連続した END（空フレーム）は無視
+        }
+        if (escaped_ || length_ < FRAME_CRC_SIZE) {
+            ++stats_.format_errors;
+            return false;
+        }
+        if (crc_.value() != 0) {
+            ++stats_.crc_errors;
+            return false;
+        }
+
+        ++stats_.frames;
+        return true;
+    }
+
+    uint8_t frame_[MaxFrameSize + FRAME_CRC_SIZE];
+    uint32_t length_ = 0;
+    Crc16 crc_;
+    bool escaped_ = false;
+    bool dropping_ = false;
+    FrameStats stats_ {};
+};
+
+} // namespace omusubi
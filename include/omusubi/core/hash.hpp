@@ -0,0 +1,75 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+
+namespace omusubi {
+
+/**
+ * @brief FNV-1a 32bitハッシュ（バイト列）
+ *
+ * 文字列キーのハッシュテーブルで共通に使用するハッシュ関数。
+ * constexprのため、文字列リテラルのハッシュはコンパイル時に計算できる。
+ */
+[[nodiscard]] constexpr uint32_t hash_bytes(const char* data, size_t length) noexcept {
+    uint32_t hash = 2166136261U;
+
+    for (size_t i = 0; i < length; ++i) {
+        hash ^= static_cast<uint8_t>(data[i]);
+        hash *= 16777619U;
+    }
+
+    return hash;
+}
+
+/**
+ * @brief std::string_view のハッシュ値を取得
+ */
+[[nodiscard]] constexpr uint32_t hash_string(std::string_view sv) noexcept {
+    return hash_bytes(sv.data(), sv.size());
+}
+
+/**
+ * @brief 32bit整数のハッシュ値を取得（murmur3 fmix32）
+ *
+ * 連番のキーをテーブル全体に分散させるために使用する。
+ */
+[[nodiscard]] constexpr uint32_t hash_u32(uint32_t value) noexcept {
+    value ^= value >> 16;
+    value *= 0x85EBCA6BU;
+    value ^= value >> 13;
+    value *= 0xC2B2AE35U;
+    value ^= value >> 16;
+    return value;
+}
+
+/**
+ * @brief ハッシュテーブル用のハッシュ関数オブジェクト
+ *
+ * - 整数・列挙型: hash_u32（64bit整数は上位と下位を畳み込む）
+ * - std::string_view: hash_string
+ * - hash() メンバ関数を持つ型（InternHandle など）: その戻り値
+ *
+ * 他の型を FixedMap のキーにする場合は特殊化を追加する。
+ */
+template <typename T, typename = void>
+struct Hash {
+    [[nodiscard]] constexpr uint32_t operator()(const T& value) const noexcept { return value.hash(); }
+};
+
+template <typename T>
+struct Hash<T, std::enable_if_t<std::is_integral_v<T> || std::is_enum_v<T>>> {
+    [[nodiscard]] constexpr uint32_t operator()(T value) const noexcept {
+        const auto bits = static_cast<uint64_t>(value);
+        return hash_u32(static_cast<uint32_t>(bits) ^ static_cast<uint32_t>(bits >> 32));
+    }
+};
+
+template <>
+struct Hash<std::string_view> {
+    [[nodiscard]] constexpr uint32_t operator()(std::string_view value) const noexcept { return hash_string(value); }
+};
+
+} // namespace omusubi
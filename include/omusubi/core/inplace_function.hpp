@@ -0,0 +1,144 @@
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <type_traits>
+
+namespace omusubi {
+
+template <typename Signature, std::size_t Capacity = 3 * sizeof(void*)>
+class InplaceFunction;
+
+/**
+ * @brief ヒープを使わない型消去された関数オブジェクト
+ *
+ * std::function と同様にラムダ・関数ポインタ・関数オブジェクトを保持するが、
+ * 保持先はオブジェクト内の Capacity バイトの領域のみ。収まらない関数オブジェクトはコンパイルエラーになる。
+ * 非同期I/Oの完了コールバックなど、登録してから後で呼ぶ関数の保持に使う。
+ *
+ * - 型ごとの操作（呼び出し・ムーブ・破棄）は静的な表1つへのポインタで持つ
+ * - トリビアルにコピーできる関数オブジェクト（ポインタを捕捉したラムダなど）のムーブは memcpy のみ
+ * - ムーブ専用（コピーできない関数オブジェクトも保持できる）
+ *
+ * @tparam R 戻り値の型
+ * @tparam Args 引数の型
+ * @tparam Capacity 関数オブジェクトを格納する領域の大きさ（既定はポインタ3つ分）
+ *
+ * @par 使用例
+ * @code
+ * InplaceFunction<void(uint32_t)> on_done = [this](uint32_t n) { received_ += n; };
+ * if (on_done) {
+ *     on_done(16);
+ * }
+ * @endcode
+ */
+template <typename R, typename... Args, std::size_t Capacity>
+class InplaceFunction<R(Args...), Capacity> {
+    static constexpr std::size_t ALIGNMENT = (alignof(double) > alignof(void*)) ? alignof(double) : alignof(void*);
+
+    struct Operations {
+        R (*invoke)(void* storage, Args&&... args);
+        void (*relocate)(void* destination, void* source) noexcept; ///< nullptr なら memcpy で移せる
+        void (*destroy)(void* storage) noexcept;                    ///< nullptr なら破棄は不要
+    };
+
+    template <typename F>
+    struct Callable {
+        static constexpr bool TRIVIAL = std::is_trivially_copyable_v<F> && std::is_trivially_destructible_v<F>;
+
+        static R invoke(void* storage, Args&&... args) { return (*static_cast<F*>(storage))(static_cast<Args&&>(args)...); }
+
+        static void relocate(void* destination, void* source) noexcept {
+            new (destination) F(static_cast<F&&>(*static_cast<F*>(source)));
+            static_cast<F*>(source)->~F();
+        }
+
+        static void destroy(void* storage) noexcept { static_cast<F*>(storage)->~F(); }
+
+        static constexpr Operations OPERATIONS = {&Callable::invoke, TRIVIAL ? nullptr : &Callable::relocate, TRIVIAL ? nullptr : &Callable::destroy};
+    };
+
+public:
+    /** @brief 関数オブジェクトを格納する領域の大きさ */
+    static constexpr std::size_t CAPACITY = Capacity;
+
+    /**
+     * @brief 空の関数を構築
+     */
+    InplaceFunction() noexcept = default;
+
+    InplaceFunction(std::nullptr_t) noexcept {} // NOLINT(google-explicit-constructor)
+
+    /**
+     * @brief 関数オブジェクトを格納して構築
+     */
+    template <typename F, typename D = std::decay_t<F>, typename = std::enable_if_t<!std::is_same_v<D, InplaceFunction> && std::is_invocable_r_v<R, D&, Args...>>>
+    InplaceFunction(F&& function) noexcept(std::is_nothrow_constructible_v<D, F&&>) { // NOLINT(google-explicit-constructor)
+        static_assert(sizeof(D) <= Capacity, "Callable does not fit in InplaceFunction; capture less or raise Capacity");
+        static_assert(alignof(D) <= ALIGNMENT, "Callable is over-aligned for InplaceFunction");
+        static_assert(std::is_nothrow_move_constructible_v<D>, "Callable must be nothrow move constructible");
+
+        new (storage_) D(static_cast<F&&>(function));
+        operations_ = &Callable<D>::OPERATIONS;
+    }
+
+    InplaceFunction(InplaceFunction&& other) noexcept { move_from(other); }
+
+    InplaceFunction& operator=(InplaceFunction&& other) noexcept {
+        if (this != &other) {
+            reset();
+            move_from(other);
+        }
+        return *this;
+    }
+
+    InplaceFunction& operator=(std::nullptr_t) noexcept {
+        reset();
+        return *this;
+    }
+
+    InplaceFunction(const InplaceFunction&) = delete;
+    InplaceFunction& operator=(const InplaceFunction&) = delete;
+
+    ~InplaceFunction() { reset(); }
+
+    /**
+     * @brief 保持している関数を呼び出す（空の場合は呼び出してはならない）
+     */
+    R operator()(Args... args) { return operations_->invoke(storage_, static_cast<Args&&>(args)...); }
+
+    /**
+     * @brief 関数を保持しているか
+     */
+    [[nodiscard]] explicit operator bool() const noexcept { return operations_ != nullptr; }
+
+    /**
+     * @brief 保持している関数を破棄して空にする
+     */
+    void reset() noexcept {
+        if (operations_ != nullptr && operations_->destroy != nullptr) {
+            operations_->destroy(storage_);
+        }
+        operations_ = nullptr;
+    }
+
+private:
+    void move_from(InplaceFunction& other) noexcept {
+        if (other.operations_ == nullptr) {
+            return;
+        }
+        if (other.operations_->relocate != nullptr) {
+            other.operations_->relocate(storage_, other.storage_);
+        } else {
+            std::memcpy(storage_, other.storage_, Capacity);
+        }
+        operations_ = other.operations_;
+        other.operations_ = nullptr;
+    }
+
+    alignas(ALIGNMENT) unsigned char storage_[Capacity];
+    const Operations* operations_ = nullptr;
+};
+
+} // namespace omusubi
@@ -0,0 +1,280 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <omusubi/core/hash.hpp>
+#include <omusubi/core/result.hpp>
+#include <string_view>
+
+namespace omusubi {
+
+/**
+ * @brief インターン済み文字列のハンドル
+ *
+ * InternPool内の文字列を指す小さな整数。
+ * 同じプールから得たハンドル同士は、整数比較だけで文字列の等価性を判定できる。
+ */
+class InternHandle {
+public:
+    /** @brief 無効なハンドルを表すインデックス */
+    static constexpr uint16_t INVALID_INDEX = 0xFFFF;
+
+    /**
+     * @brief デフォルトコンストラクタ（無効なハンドル）
+     */
+    constexpr InternHandle() noexcept : index_(INVALID_INDEX) {}
+
+    /**
+     * @brief インデックスから構築
+     */
+    constexpr explicit InternHandle(uint16_t index) noexcept : index_(index) {}
+
+    /**
+     * @brief プール内のインデックスを取得
+     */
+    [[nodiscard]] constexpr uint16_t index() const noexcept { return index_; }
+
+    /**
+     * @brief 有効なハンドルか判定
+     */
+    [[nodiscard]] constexpr bool is_valid() const noexcept { return index_ != INVALID_INDEX; }
+
+    /**
+     * @brief ハッシュ値を取得（O(1)、文字列を走査しない）
+     */
+    [[nodiscard]] constexpr uint32_t hash() const noexcept { return hash_u32(index_); }
+
+    [[nodiscard]] constexpr bool operator==(InternHandle other) const noexcept { return index_ == other.index_; }
+
+    [[nodiscard]] constexpr bool operator!=(InternHandle other) const noexcept { return index_ != other.index_; }
+
+private:
+    uint16_t index_;
+};
+
+/**
+ * @brief InternPoolの使用状況
+ */
+struct InternPoolStats {
+    uint32_t string_count;     ///< 登録済み文字列数
+    uint32_t string_capacity;  ///< 登録可能な最大文字列数
+    uint32_t bytes_used;       ///< アリーナ使用バイト数（null終端含む）
+    uint32_t bytes_capacity;   ///< アリーナ容量
+    uint32_t table_size;       ///< ハッシュテーブルのスロット数
+    uint32_t max_probe_length; ///< 登録時の最大プローブ長
+};
+
+/**
+ * @brief 固定容量の文字列インターンプール
+ *
+ * 文字列を静的アリーナに1回だけ格納し、InternHandleで参照する。
+ * - 重複登録はオープンアドレス法（線形探索）のハッシュテーブルで排除
+ * - ハンドルはプールが存在する限り安定（削除なし、clear()まで有効）
+ * - 格納した文字列はnull終端を保証
+ * - 動的メモリ確保なし
+ *
+ * @tparam ArenaSize 文字列アリーナのバイト数（null終端を含む）
+ * @tparam MaxEntries 登録可能な最大文字列数
+ *
+ * @par 使用例
+ * @code
+ * static InternPool<1024, 64> names;
+ *
+ * auto a = names.intern(scanner->get_found_name(0));
+ * auto b = names.intern(scanner->get_found_name(1));
+ * if (a.is_ok() && b.is_ok() && a.value() == b.value()) {
+ *     // 同じデバイス名
+ * }
+ * @endcode
+ */
+template <uint32_t ArenaSize, uint16_t MaxEntries>
+class InternPool {
+    static_assert(ArenaSize > 0, "ArenaSize must be greater than 0");
+    static_assert(MaxEntries > 0 && MaxEntries < InternHandle::INVALID_INDEX, "MaxEntries must be in [1, 65534]");
+
+    /**
+     * @brief 負荷率50%以下となる2のべき乗のテーブルサイズを計算
+     */
+    static constexpr uint32_t calculate_table_size() noexcept {
+        uint32_t size = 1;
+        while (size < static_cast<uint32_t>(MaxEntries) * 2) {
+            size <<= 1;
+        }
+        return size;
+    }
+
+public:
+    /** @brief ハッシュテーブルのスロット数（2のべき乗） */
+    static constexpr uint32_t TABLE_SIZE = calculate_table_size();
+
+    /**
+     * @brief デフォルトコンストラクタ
+     */
+    InternPool() noexcept : arena_used_(0), count_(0), max_probe_length_(0) {
+        for (uint32_t i = 0; i < TABLE_SIZE; ++i) {
+            slots_[i] = 0;
+        }
+    }
+
+    /**
+     * @brief 文字列を登録してハンドルを取得
+     *
+     * 既に登録済みの場合は既存のハンドルを返す（アリーナは消費しない）。
+     *
+     * @return 成功時はハンドル、エントリ数またはアリーナが不足した場合は Error::BUFFER_FULL
+     */
+    [[nodiscard]] Result<InternHandle> intern(std::string_view str) noexcept {
+        const uint32_t hash = hash_string(str);
+        uint32_t probe = 0;
+        uint32_t slot = find_slot(str, hash, probe);
+
+        if (slots_[slot] != 0) {
+            return Result<InternHandle>::ok(InternHandle(static_cast<uint16_t>(slots_[slot] - 1)));
+        }
+
+        const auto length = static_cast<uint32_t>(str.size());
+
+        if (count_ >= MaxEntries || length >= ArenaSize - arena_used_) {
+            return Result<InternHandle>::err(Error::BUFFER_FULL);
+        }
+
+        Entry& entry = entries_[count_];
+        entry.hash = hash;
+        entry.offset = arena_used_;
+        entry.length = length;
+
+        if (length > 0) {
+            std::memcpy(arena_ + arena_used_, str.data(), length);
+        }
+        arena_[arena_used_ + length] = '\0';
+        arena_used_ += length + 1;
+
+        slots_[slot] = static_cast<uint16_t>(count_ + 1);
+        ++count_;
+
+        if (probe > max_probe_length_) {
+            max_probe_length_ = probe;
+        }
+
+        return Result<InternHandle>::ok(InternHandle(static_cast<uint16_t>(count_ - 1)));
+    }
+
+    /**
+     * @brief 登録済みの文字列を検索
+     * @return 見つかった場合はハンドル、見つからない場合は無効なハンドル
+     */
+    [[nodiscard]] InternHandle find(std::string_view str) const noexcept {
+        uint32_t probe = 0;
+        const uint32_t slot = find_slot(str, hash_string(str), probe);
+
+        if (slots_[slot] == 0) {
+            return InternHandle {};
+        }
+
+        return InternHandle(static_cast<uint16_t>(slots_[slot] - 1));
+    }
+
+    /**
+     * @brief 文字列が登録済みか判定
+     */
+    [[nodiscard]] bool contains(std::string_view str) const noexcept { return find(str).is_valid(); }
+
+    /**
+     * @brief ハンドルが指す文字列を取得
+     * @return 文字列、無効なハンドルの場合は空文字列
+     */
+    [[nodiscard]] std::string_view view(InternHandle handle) const noexcept {
+        if (!owns(handle)) {
+            return std::string_view {};
+        }
+
+        const Entry& entry = entries_[handle.index()];
+        return std::string_view {arena_ + entry.offset, entry.length};
+    }
+
+    /**
+     * @brief ハンドルが指す文字列をC文字列として取得（null終端保証）
+     * @return C文字列、無効なハンドルの場合は空文字列
+     */
+    [[nodiscard]] const char* c_str(InternHandle handle) const noexcept {
+        if (!owns(handle)) {
+            return "";
+        }
+
+        return arena_ + entries_[handle.index()].offset;
+    }
+
+    /**
+     * @brief ハンドルがこのプールの登録済み文字列を指すか判定
+     */
+    [[nodiscard]] bool owns(InternHandle handle) const noexcept { return handle.is_valid() && handle.index() < count_; }
+
+    /**
+     * @brief 登録済み文字列数を取得
+     */
+    [[nodiscard]] uint32_t size() const noexcept { return count_; }
+
+    /**
+     * @brief 登録可能な最大文字列数を取得
+     */
+    [[nodiscard]] constexpr uint32_t capacity() const noexcept { return MaxEntries; }
+
+    /**
+     * @brief 使用状況を取得
+     */
+    [[nodiscard]] InternPoolStats get_stats() const noexcept { return InternPoolStats {count_, MaxEntries, arena_used_, ArenaSize, TABLE_SIZE, max_probe_length_}; }
+
+    /**
+     * @brief すべての文字列を破棄
+     *
+     * @warning 取得済みのハンドルはすべて無効になる
+     */
+    void clear() noexcept {
+        for (uint32_t i = 0; i < TABLE_SIZE; ++i) {
+            slots_[i] = 0;
+        }
+
+        arena_used_ = 0;
+        count_ = 0;
+        max_probe_length_ = 0;
+    }
+
+private:
+    struct Entry {
+        uint32_t hash;
+        uint32_t offset;
+        uint32_t length;
+    };
+
+    /**
+     * @brief 文字列に一致するスロット、または挿入先の空きスロットを探す
+     *
+     * 負荷率は常に50%以下のため、必ず空きスロットが見つかる。
+     */
+    [[nodiscard]] uint32_t find_slot(std::string_view str, uint32_t hash, uint32_t& probe) const noexcept {
+        const auto length = static_cast<uint32_t>(str.size());
+        uint32_t slot = hash & (TABLE_SIZE - 1);
+
+        while (slots_[slot] != 0) {
+            const Entry& entry = entries_[slots_[slot] - 1];
+
+            if (entry.hash == hash && entry.length == length && (length == 0 || std::memcmp(arena_ + entry.offset, str.data(), length) == 0)) {
+                break;
+            }
+
+            slot = (slot + 1) & (TABLE_SIZE - 1);
+            ++probe;
+        }
+
+        return slot;
+    }
+
+    char arena_[ArenaSize];
+    Entry entries_[MaxEntries];
+    uint16_t slots_[TABLE_SIZE]; // 0: 空き、それ以外: エントリインデックス + 1
+    uint32_t arena_used_;
+    uint32_t count_;
+    uint32_t max_probe_length_;
+};
+
+} // namespace omusubi
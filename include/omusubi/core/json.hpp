@@ -0,0 +1,1474 @@
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <omusubi/core/fixed_string_ref.hpp>
+#include <omusubi/core/parse.hpp>
+#include <omusubi/core/result.hpp>
+#include <omusubi/core/span.hpp>
+#include <omusubi/core/types.h>
+#include <omusubi/interface/writable.h>
+#include <string_view>
+#include <type_traits>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace omusubi {
+
+namespace detail {
+
+// ========================================
+// 構造文字の走査
+// ========================================
+
+/**
+ * @brief 文字列中でエスケープが必要な文字か判定（'"'、'\\'、制御文字）
+ */
+[[nodiscard]] constexpr bool json_is_special(char c) noexcept {
+    return c == '"' || c == '\\' || static_cast<uint8_t>(c) < 0x20;
+}
+
+/**
+ * @brief JSON の空白文字か判定
+ */
+[[nodiscard]] constexpr bool json_is_whitespace(char c) noexcept {
+    return c == ' ' || c == '\n' || c == '\r' || c == '\t';
+}
+
+/**
+ * @brief 最初の '"'、'\\'、制御文字を探す
+ *
+ * - SSE2: 16バイトずつ比較し、movemask で位置を得る
+ * - それ以外（リトルエンディアン）: 8バイトずつ SWAR で判定する
+ *
+ * @return 見つかった位置（ない場合 end）
+ */
+[[nodiscard]] inline const char* json_find_special(const char* p, const char* end) noexcept {
+#if defined(__SSE2__)
+    const __m128i quote = _mm_set1_epi8('"');
+    const __m128i backslash = _mm_set1_epi8('\\');
+    const __m128i control_max = _mm_set1_epi8(0x1F);
+
+    while (end - p >= 16) {
+        const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+        const __m128i is_quote = _mm_cmpeq_epi8(chunk, quote);
+        const __m128i is_backslash = _mm_cmpeq_epi8(chunk, backslash);
+        const __m128i is_control = _mm_cmpeq_epi8(_mm_max_epu8(chunk, control_max), control_max);
+        const auto mask = static_cast<uint32_t>(_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(is_quote, is_backslash), is_control)));
+        if (mask != 0) {
+            return p + __builtin_ctz(mask);
+        }
+        p += 16;
+    }
+#else
+    if constexpr (SWAR_PARSE_ENABLED) {
+        constexpr uint64_t ONES = 0x0101010101010101U;
+        constexpr uint64_t HIGHS = 0x8080808080808080U;
+
+        while (end - p >= 8) {
+            const uint64_t chunk = load_u64(p);
+            const uint64_t quote = chunk ^ (ONES * '"');
+            const uint64_t backslash = chunk ^ (ONES * '\\');
+            // 最下位の立っているビットは常に最初の該当バイトを指す（上位側の誤検出は無視される）
+            const uint64_t mask = (((quote - ONES) & ~quote) | ((backslash - ONES) & ~backslash) | ((chunk - (ONES * 0x20)) & ~chunk)) & HIGHS;
+            if (mask != 0) {
+#if defined(__GNUC__) || defined(__clang__)
+                return p + (__builtin_ctzll(mask) / 8);
+#else
+                break;
+#endif
+            }
+            p += 8;
+        }
+    }
+#endif
+
+    while (p < end && !json_is_special(*p)) {
+        ++p;
+    }
+    return p;
+}
+
+/**
+ * @brief 空白文字を読み飛ばす
+ *
+ * インデント付きの JSON では空白が長く続くため、SSE2 では16バイトずつ判定する。
+ */
+[[nodiscard]] inline const char* json_skip_whitespace(const char* p, const char* end) noexcept {
+#if defined(__SSE2__)
+    while (end - p >= 16 && json_is_whitespace(*p)) {
+        const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+        const __m128i space = _mm_or_si128(_mm_cmpeq_epi8(chunk, _mm_set1_epi8(' ')), _mm_cmpeq_epi8(chunk, _mm_set1_epi8('\n')));
+        const __m128i other = _mm_or_si128(_mm_cmpeq_epi8(chunk, _mm_set1_epi8('\r')), _mm_cmpeq_epi8(chunk, _mm_set1_epi8('\t')));
+        const auto mask = static_cast<uint32_t>(_mm_movemask_epi8(_mm_or_si128(space, other))) ^ 0xFFFFU;
+        if (mask != 0) {
+            return p + __builtin_ctz(mask);
+        }
+        p += 16;
+    }
+#endif
+
+    while (p < end && json_is_whitespace(*p)) {
+        ++p;
+    }
+    return p;
+}
+
+/**
+ * @brief 16進数字の値（16進数字でない場合 -1）
+ */
+[[nodiscard]] constexpr int32_t json_hex_value(char c) noexcept {
+    if (c >= '0' && c <= '9') {
+        return c - '0';
+    }
+    if (c >= 'a' && c <= 'f') {
+        return c - 'a' + 10;
+    }
+    if (c >= 'A' && c <= 'F') {
+        return c - 'A' + 10;
+    }
+    return -1;
+}
+
+/**
+ * @brief \\uXXXX の4桁を読む（不正な場合 -1）
+ */
+[[nodiscard]] constexpr int32_t json_read_hex4(const char* p) noexcept {
+    int32_t value = 0;
+    for (uint32_t i = 0; i < 4; ++i) {
+        const int32_t digit = json_hex_value(p[i]);
+        if (digit < 0) {
+            return -1;
+        }
+        value = (value << 4) | digit;
+    }
+    return value;
+}
+
+// ========================================
+// 数値の書式化
+// ========================================
+
+inline constexpr uint32_t JSON_MAX_FLOAT_DECIMALS = 9;
+
+/**
+ * @brief 符号なし整数を10進で書き込む
+ *
+ * @return 書き込んだ文字数
+ */
+inline uint32_t json_format_unsigned(uint64_t value, char* out) noexcept {
+    char digits[20];
+    uint32_t n = 0;
+    do {
+        digits[n++] = static_cast<char>('0' + (value % 10));
+        value /= 10;
+    } while (value != 0);
+
+    for (uint32_t i = 0; i < n; ++i) {
+        out[i] = digits[n - 1 - i];
+    }
+    return n;
+}
+
+/**
+ * @brief 0 以上の値を小数点以下 decimals 桁で丸めて書き込む（末尾の0は省く）
+ *
+ * @return 書き込んだ文字数
+ */
+inline uint32_t json_format_fixed(double value, uint32_t decimals, char* out) noexcept {
+    uint64_t scale = 1;
+    for (uint32_t i = 0; i < decimals; ++i) {
+        scale *= 10;
+    }
+
+    const auto rounded = static_cast<uint64_t>((value * static_cast<double>(scale)) + 0.5);
+    uint32_t n = json_format_unsigned(rounded / scale, out);
+
+    uint64_t fraction = rounded % scale;
+    if (fraction == 0) {
+        return n;
+    }
+
+    // 末尾の0を除いた桁数
+    uint32_t digits = decimals;
+    while (fraction % 10 == 0) {
+        fraction /= 10;
+        --digits;
+    }
+
+    out[n++] = '.';
+    for (uint32_t i = digits; i > 0; --i) {
+        out[n + i - 1] = static_cast<char>('0' + (fraction % 10));
+        fraction /= 10;
+    }
+    return n + digits;
+}
+
+/**
+ * @brief 浮動小数点数を JSON の数値として書き込む
+ *
+ * 小数点以下 decimals 桁に丸めた固定小数点表記。固定小数点では桁があふれる・0になってしまう
+ * 大きさの値は指数表記（仮数は小数点以下 decimals 桁）にする。
+ * JSON は NaN と無限大を表せないため null を書き込む。
+ *
+ * @param out 48文字以上のバッファ
+ * @return 書き込んだ文字数
+ */
+inline uint32_t json_format_double(double value, uint32_t decimals, char* out) noexcept {
+    if (!std::isfinite(value)) {
+        out[0] = 'n';
+        out[1] = 'u';
+        out[2] = 'l';
+        out[3] = 'l';
+        return 4;
+    }
+
+    if (decimals > JSON_MAX_FLOAT_DECIMALS) {
+        decimals = JSON_MAX_FLOAT_DECIMALS;
+    }
+
+    uint32_t n = 0;
+    if (std::signbit(value) && value != 0.0) {
+        out[n++] = '-';
+        value = -value;
+    }
+    if (value == 0.0) {
+        out[n++] = '0';
+        return n;
+    }
+
+    const double fixed_max = 1.0e18 / std::pow(10.0, static_cast<double>(decimals));
+    const double fixed_min = 0.5 / std::pow(10.0, static_cast<double>(decimals));
+
+    if (value < fixed_max && value >= fixed_min) {
+        return n + json_format_fixed(value, decimals, out + n);
+    }
+
+    // 非正規化数では 10^exponent が 0 にアンダーフローするため、2回に分けて割る
+    auto exponent = static_cast<int32_t>(std::floor(std::log10(value)));
+    const int32_t half = exponent / 2;
+    double mantissa = value / std::pow(10.0, static_cast<double>(half)) / std::pow(10.0, static_cast<double>(exponent - half));
+    if (mantissa >= 10.0) {
+        mantissa /= 10.0;
+        ++exponent;
+    } else if (mantissa < 1.0) {
+        mantissa *= 10.0;
+        --exponent;
+    }
+
+    // 丸めで 10.0 になる場合は桁を繰り上げる
+    const double limit = 10.0 - (0.5 / std::pow(10.0, static_cast<double>(decimals)));
+    if (mantissa >= limit) {
+        mantissa = 1.0;
+        ++exponent;
+    }
+
+    n += json_format_fixed(mantissa, decimals, out + n);
+    out[n++] = 'e';
+    if (exponent < 0) {
+        out[n++] = '-';
+        exponent = -exponent;
+    }
+    return n + json_format_unsigned(static_cast<uint64_t>(exponent), out + n);
+}
+
+// ========================================
+// 最短表記（Grisu2）
+// ========================================
+
+/**
+ * @brief 64bit 仮数と2進指数の組（f * 2^e）
+ */
+struct JsonDiyFp {
+    uint64_t f;
+    int32_t e;
+};
+
+/**
+ * @brief 積の上位64bit（最下位ビットで四捨五入）
+ */
+[[nodiscard]] inline JsonDiyFp json_diy_multiply(JsonDiyFp x, JsonDiyFp y) noexcept {
+    const Value128 product = full_multiplication(x.f, y.f);
+    return JsonDiyFp {product.high + (product.low >> 63), x.e + y.e + 64};
+}
+
+/**
+ * @brief 最上位ビットが立つまで左にずらす
+ */
+[[nodiscard]] inline JsonDiyFp json_diy_normalize(JsonDiyFp x) noexcept {
+    const int32_t shift = count_leading_zeros(x.f);
+    return JsonDiyFp {x.f << shift, x.e - shift};
+}
+
+/**
+ * @brief 値とその丸め境界（隣の浮動小数点数との中点）
+ *
+ * minus と plus は同じ指数にそろえる。
+ */
+struct JsonBoundaries {
+    JsonDiyFp w;
+    JsonDiyFp minus;
+    JsonDiyFp plus;
+};
+
+/**
+ * @brief 正の有限値の丸め境界を求める（float は float の精度で）
+ */
+template <typename T>
+[[nodiscard]] JsonBoundaries json_compute_boundaries(T value) noexcept {
+    using Format = FloatFormat<T>;
+    constexpr int32_t BIAS = -Format::MINIMUM_EXPONENT + Format::MANTISSA_BITS;
+    constexpr uint64_t HIDDEN_BIT = uint64_t {1} << Format::MANTISSA_BITS;
+
+    typename Format::Bits bits = 0;
+    std::memcpy(&bits, &value, sizeof(bits));
+    const auto biased_exponent = static_cast<int32_t>(bits >> Format::MANTISSA_BITS);
+    const uint64_t fraction = bits & (HIDDEN_BIT - 1);
+
+    // 非正規化数は隠れビットなし
+    const JsonDiyFp v = (biased_exponent == 0) ? JsonDiyFp {fraction, 1 - BIAS} : JsonDiyFp {fraction + HIDDEN_BIT, biased_exponent - BIAS};
+
+    // 仮数が2の累乗のときは下側の隣までの間隔が半分になる
+    const bool lower_closer = (fraction == 0 && biased_exponent > 1);
+    const JsonDiyFp plus = json_diy_normalize(JsonDiyFp {(v.f << 1) + 1, v.e - 1});
+    const JsonDiyFp minus = lower_closer ? JsonDiyFp {(v.f << 2) - 1, v.e - 2} : JsonDiyFp {(v.f << 1) - 1, v.e - 1};
+
+    return JsonBoundaries {json_diy_normalize(v), JsonDiyFp {minus.f << (minus.e - plus.e), plus.e}, plus};
+}
+
+/**
+ * @brief 10^k を64bit精度で取得（POWER_OF_FIVE_128 の上位128bitを丸める）
+ *
+ * 10^k = 5^k * 2^k なので、仮数は 5^k と同じで2進指数だけが異なる。
+ * 表の範囲を超える k（非正規化数で必要）は 10^(k-19) * 10^19 を192bitで計算する。
+ */
+[[nodiscard]] inline JsonDiyFp json_cached_power(int32_t k) noexcept {
+    constexpr int32_t EXTRA = 19;
+    const int32_t q = (k > LARGEST_POWER_OF_FIVE) ? k - EXTRA : k;
+    const auto index = static_cast<uint32_t>(2 * (q - SMALLEST_POWER_OF_FIVE));
+    uint64_t high = POWER_OF_FIVE_128[index];
+    uint64_t low = POWER_OF_FIVE_128[index + 1];
+    int32_t e = ((217706 * q) >> 16) - 63;
+
+    if (q != k) {
+        // 10^19 は64bitに正確に収まる（正規化して掛ける）
+        constexpr uint64_t TEN_19 = 10000000000000000000ULL;
+        const int32_t shift = count_leading_zeros(TEN_19);
+        const uint64_t multiplier = TEN_19 << shift;
+        const Value128 lower = full_multiplication(low, multiplier);
+        const Value128 upper = full_multiplication(high, multiplier);
+        const uint64_t middle = upper.low + lower.high;
+        uint64_t top = upper.high + (middle < upper.low ? 1 : 0);
+
+        // 積は [2^190, 2^192) なので正規化は高々1bit
+        int32_t normalize = 0;
+        if ((top >> 63) == 0) {
+            top = (top << 1) | (middle >> 63);
+            low = middle << 1;
+            normalize = 1;
+        } else {
+            low = middle;
+        }
+        high = top;
+        e += 64 - shift - normalize;
+    }
+
+    const uint64_t f = high + (low >> 63);
+    if (f < high) {
+        // 繰り上がりで桁があふれた
+        return JsonDiyFp {uint64_t {1} << 63, e + 1};
+    }
+    return JsonDiyFp {f, e};
+}
+
+/**
+ * @brief 最後の桁を w に近づける（Grisu2 の丸め）
+ */
+inline void json_grisu2_round(char* digits, uint32_t length, uint64_t dist, uint64_t delta, uint64_t rest, uint64_t ten_k) noexcept {
+    while (rest < dist && delta - rest >= ten_k && (rest + ten_k < dist || dist - rest > rest + ten_k - dist)) {
+        --digits[length - 1];
+        rest += ten_k;
+    }
+}
+
+/**
+ * @brief [minus, plus] の範囲で最も短い10進数字列を生成
+ *
+ * minus・w・plus の指数は [-60, -32]。結果は digits * 10^decimal_exponent。
+ *
+ * @return 桁数
+ */
+inline uint32_t json_grisu2_digits(char* digits, int32_t& decimal_exponent, JsonDiyFp minus, JsonDiyFp w, JsonDiyFp plus) noexcept {
+    uint64_t delta = plus.f - minus.f;
+    uint64_t dist = plus.f - w.f;
+
+    const auto shift = static_cast<uint32_t>(-plus.e);
+    const uint64_t one = uint64_t {1} << shift;
+    auto p1 = static_cast<uint32_t>(plus.f >> shift); // 整数部（32bitに収まる）
+    uint64_t p2 = plus.f & (one - 1);                 // 小数部
+
+    uint32_t pow10 = 1;
+    uint32_t remaining = 1;
+    while (remaining < 10 && p1 / pow10 >= 10) {
+        pow10 *= 10;
+        ++remaining;
+    }
+
+    uint32_t length = 0;
+    while (remaining > 0) {
+        digits[length++] = static_cast<char>('0' + p1 / pow10);
+        p1 %= pow10;
+        --remaining;
+
+        const uint64_t rest = (static_cast<uint64_t>(p1) << shift) + p2;
+        if (rest <= delta) {
+            decimal_exponent += static_cast<int32_t>(remaining);
+            json_grisu2_round(digits, length, dist, delta, rest, static_cast<uint64_t>(pow10) << shift);
+            return length;
+        }
+        pow10 /= 10;
+    }
+
+    int32_t fraction_digits = 0;
+    for (;;) {
+        p2 *= 10;
+        digits[length++] = static_cast<char>('0' + (p2 >> shift));
+        p2 &= one - 1;
+        ++fraction_digits;
+        delta *= 10;
+        dist *= 10;
+        if (p2 <= delta) {
+            break;
+        }
+    }
+
+    decimal_exponent -= fraction_digits;
+    json_grisu2_round(digits, length, dist, delta, p2, one);
+    return length;
+}
+
+/**
+ * @brief 浮動小数点数を読み戻すと同じ値になる最短の表記で書き込む
+ *
+ * Grisu2 で数字列を求め（ほぼ最短。まれに1桁長くなるが、読み戻しは常に一致する）、
+ * JavaScript の Number#toString() と同じ規則で配置する
+ * （10^-7 < |value| < 10^21 は固定小数点、それ以外は "1.5e-9" のような指数表記）。
+ * float は float の精度で最短になる（0.1F は "0.1"）。NaN と無限大は null。
+ *
+ * @param out 32文字以上のバッファ
+ * @return 書き込んだ文字数
+ */
+template <typename T>
+uint32_t json_format_shortest(T value, char* out) noexcept {
+    static_assert(std::is_same_v<T, float> || std::is_same_v<T, double>, "json_format_shortest: float or double");
+
+    if (!std::isfinite(value)) {
+        std::memcpy(out, "null", 4);
+        return 4;
+    }
+
+    uint32_t n = 0;
+    if (std::signbit(value) && value != 0) {
+        out[n++] = '-';
+        value = -value;
+    }
+    if (value == 0) {
+        out[n++] = '0';
+        return n;
+    }
+
+    // w * 10^k の2進指数が [-60, -32] に入る k を選ぶ
+    constexpr int32_t ALPHA = -60;
+    constexpr int32_t GAMMA = -32;
+    const JsonBoundaries boundaries = json_compute_boundaries(value);
+    const int32_t e = boundaries.plus.e;
+    int32_t k = static_cast<int32_t>(std::ceil((ALPHA - e - 1) * 0.30102999566398114));
+    while (json_cached_power(k).e + e + 64 < ALPHA) {
+        ++k;
+    }
+    while (json_cached_power(k).e + e + 64 > GAMMA) {
+        --k;
+    }
+
+    const JsonDiyFp c = json_cached_power(k);
+    const JsonDiyFp w = json_diy_multiply(boundaries.w, c);
+    const JsonDiyFp minus = json_diy_multiply(boundaries.minus, c);
+    const JsonDiyFp plus = json_diy_multiply(boundaries.plus, c);
+
+    // 乗算の誤差（各1単位）の分だけ範囲を内側に狭める
+    char digits[20];
+    int32_t exponent = -k;
+    const auto length = static_cast<int32_t>(json_grisu2_digits(digits, exponent, JsonDiyFp {minus.f + 1, minus.e}, w, JsonDiyFp {plus.f - 1, plus.e}));
+
+    // 小数点の位置（digits の先頭から point 桁目の後ろ）
+    const int32_t point = length + exponent;
+
+    if (length <= point && point <= 21) {
+        // 整数: 1234e2 → 123400
+        std::memcpy(out + n, digits, static_cast<size_t>(length));
+        n += static_cast<uint32_t>(length);
+        for (int32_t i = length; i < point; ++i) {
+            out[n++] = '0';
+        }
+        return n;
+    }
+
+    if (0 < point && point <= 21) {
+        // 1234e-2 → 12.34
+        std::memcpy(out + n, digits, static_cast<size_t>(point));
+        n += static_cast<uint32_t>(point);
+        out[n++] = '.';
+        std::memcpy(out + n, digits + point, static_cast<size_t>(length - point));
+        return n + static_cast<uint32_t>(length - point);
+    }
+
+    if (-6 < point && point <= 0) {
+        // 1234e-6 → 0.001234
+        out[n++] = '0';
+        out[n++] = '.';
+        for (int32_t i = point; i < 0; ++i) {
+            out[n++] = '0';
+        }
+        std::memcpy(out + n, digits, static_cast<size_t>(length));
+        return n + static_cast<uint32_t>(length);
+    }
+
+    // 指数表記: 1234e30 → 1.234e33
+    out[n++] = digits[0];
+    if (length > 1) {
+        out[n++] = '.';
+        std::memcpy(out + n, digits + 1, static_cast<size_t>(length - 1));
+        n += static_cast<uint32_t>(length - 1);
+    }
+    out[n++] = 'e';
+    int32_t scientific = point - 1;
+    if (scientific < 0) {
+        out[n++] = '-';
+        scientific = -scientific;
+    }
+    return n + json_format_unsigned(static_cast<uint64_t>(scientific), out + n);
+}
+
+// ========================================
+// 出力先
+// ========================================
+
+/**
+ * @brief FixedString に追加
+ */
+[[nodiscard]] inline Error json_emit(FixedStringRef sink, std::string_view text) noexcept {
+    return sink.append(text) ? Error::OK : Error::BUFFER_FULL;
+}
+
+/**
+ * @brief TextWritable に書き込む
+ */
+[[nodiscard]] inline Error json_emit(TextWritable& sink, std::string_view text) noexcept {
+    const size_t written = sink.write_text(span<const char>(text.data(), text.size()));
+    return (written == text.size()) ? Error::OK : Error::WRITE_FAILED;
+}
+
+} // namespace detail
+
+/**
+ * @brief ストリーミング JSON ライター
+ *
+ * FixedString<N> または TextWritable に直接書き込む。動的メモリ確保なし。
+ * カンマ・コロン・文字列のエスケープはライターが行い、構造の誤り（キーのない値、
+ * 対応しない end_*()、MaxDepth を超える入れ子）はエラーにする。
+ *
+ * | C++ の型 | JSON |
+ * |---|---|
+ * | bool | true / false |
+ * | 整数型 | 数値 |
+ * | float / double | 数値（読み戻すと同じ値になる最短の表記。NaN・無限大は null） |
+ * | std::string_view / 文字列リテラル | 文字列 |
+ * | std::nullptr_t | null |
+ * | span<const T> / Vector3 | 配列 |
+ *
+ * 書き込みに失敗すると以降の書き込みは無視され、finish() がエラーを返す。
+ *
+ * @tparam Sink FixedString<N> または TextWritable を継承した型
+ * @tparam MaxDepth 入れ子の最大の深さ（1〜64）
+ *
+ * @par 使用例
+ * @code
+ * FixedString<128> json;
+ * JsonWriter writer(json);
+ * writer.begin_object();
+ * writer.write("device", "omusubi-01");
+ * writer.write("uptime", get_uptime_ms());
+ * writer.write("accel", accelerometer.get_values());
+ * writer.end_object();
+ *
+ * if (writer.finish().is_ok()) {
+ *     serial->write_text(span<const char>(json.data(), json.byte_length()));
+ * }
+ * @endcode
+ */
+template <typename Sink, uint32_t MaxDepth = 8>
+class JsonWriter {
+    static_assert(MaxDepth > 0 && MaxDepth <= 64, "JsonWriter MaxDepth must be between 1 and 64");
+
+public:
+    /**
+     * @brief 出力先を指定して構築
+     */
+    explicit JsonWriter(Sink& sink) noexcept : sink_(&sink) {}
+
+    /**
+     * @brief オブジェクトを開始
+     */
+    bool begin_object() noexcept { return begin('{', true); }
+
+    /**
+     * @brief オブジェクトを終了
+     */
+    bool end_object() noexcept { return end('}', true); }
+
+    /**
+     * @brief 配列を開始
+     */
+    bool begin_array() noexcept { return begin('[', false); }
+
+    /**
+     * @brief 配列を終了
+     */
+    bool end_array() noexcept { return end(']', false); }
+
+    /**
+     * @brief オブジェクトのキーを書き込む（続けて値を書き込む）
+     */
+    bool key(std::string_view name) noexcept {
+        if (error_ != Error::OK) {
+            return false;
+        }
+        if (depth_ == 0 || !in_object() || after_key_) {
+            return fail(Error::INVALID_PARAMETER);
+        }
+
+        if (!separate()) {
+            return false;
+        }
+        after_key_ = true;
+        return write_string(name) && emit(":");
+    }
+
+    /**
+     * @brief 値を型に応じて書き込む
+     */
+    template <typename T>
+    bool write(const T& value) noexcept {
+        if constexpr (std::is_same_v<T, bool>) {
+            return write_scalar(value ? std::string_view("true") : std::string_view("false"));
+        } else if constexpr (std::is_integral_v<T>) {
+            char buffer[24];
+            uint32_t n = 0;
+            if constexpr (std::is_signed_v<T>) {
+                if (value < 0) {
+                    buffer[n++] = '-';
+                    n += detail::json_format_unsigned(~static_cast<uint64_t>(static_cast<int64_t>(value)) + 1, buffer + n);
+                    return write_scalar(std::string_view(buffer, n));
+                }
+            }
+            n = detail::json_format_unsigned(static_cast<uint64_t>(value), buffer);
+            return write_scalar(std::string_view(buffer, n));
+        } else if constexpr (std::is_same_v<T, float> || std::is_same_v<T, double>) {
+            // 読み戻すと同じ値になる最短の表記（精度を落とさない）
+            char buffer[32];
+            const uint32_t n = detail::json_format_shortest(value, buffer);
+            return write_scalar(std::string_view(buffer, n));
+        } else if constexpr (std::is_floating_point_v<T>) {
+            return write(static_cast<double>(value));
+        } else if constexpr (std::is_same_v<T, std::string_view>) {
+            return prepare_value() && write_string(value);
+        } else if constexpr (std::is_same_v<T, std::nullptr_t>) {
+            return write_null();
+        } else if constexpr (std::is_same_v<T, Vector3>) {
+            return begin_array() && write(value.x) && write(value.y) && write(value.z) && end_array();
+        } else {
+            static_assert(sizeof(T) == 0, "JsonWriter: unsupported type");
+            return false;
+        }
+    }
+
+    /**
+     * @brief 文字列リテラルを書き込む
+     */
+    template <size_t N>
+    bool write(const char (&str)[N]) noexcept {
+        return write(std::string_view(str, N - 1));
+    }
+
+    /**
+     * @brief span を配列として書き込む
+     */
+    template <typename T>
+    bool write(span<T> values) noexcept {
+        if (!begin_array()) {
+            return false;
+        }
+        for (const auto& value : values) {
+            if (!write(value)) {
+                return false;
+            }
+        }
+        return end_array();
+    }
+
+    /**
+     * @brief キーと値を書き込む
+     */
+    template <typename T>
+    bool write(std::string_view name, const T& value) noexcept {
+        return key(name) && write(value);
+    }
+
+    /**
+     * @brief 浮動小数点数を小数点以下の桁数を指定して書き込む
+     *
+     * write(value) は最短の往復可能な表記になる。桁数をそろえたい・送信量を減らしたい場合に使う。
+     *
+     * @param decimals 小数点以下の桁数（最大9、末尾の0は省く）
+     */
+    bool write_float(double value, uint32_t decimals) noexcept {
+        char buffer[48];
+        const uint32_t n = detail::json_format_double(value, decimals, buffer);
+        return write_scalar(std::string_view(buffer, n));
+    }
+
+    /**
+     * @brief null を書き込む
+     */
+    bool write_null() noexcept { return write_scalar("null"); }
+
+    /**
+     * @brief 現在の入れ子の深さを取得
+     */
+    [[nodiscard]] uint32_t depth() const noexcept { return depth_; }
+
+    /**
+     * @brief 書き込んだバイト数を取得
+     */
+    [[nodiscard]] uint32_t bytes_written() const noexcept { return bytes_written_; }
+
+    /**
+     * @brief 結果を取得
+     *
+     * @return 書き込んだバイト数（出力の失敗は Error::BUFFER_FULL / Error::WRITE_FAILED、
+     *         構造の誤りや閉じていないオブジェクト・配列は Error::INVALID_PARAMETER）
+     */
+    [[nodiscard]] Result<uint32_t> finish() const noexcept {
+        if (error_ != Error::OK) {
+            return Result<uint32_t>::err(error_);
+        }
+        if (depth_ != 0 || !complete_) {
+            return Result<uint32_t>::err(Error::INVALID_PARAMETER);
+        }
+        return Result<uint32_t>::ok(bytes_written_);
+    }
+
+private:
+    [[nodiscard]] bool in_object() const noexcept { return ((object_mask_ >> (depth_ - 1)) & 1U) != 0; }
+
+    bool fail(Error error) noexcept {
+        error_ = error;
+        return false;
+    }
+
+    bool emit(std::string_view text) noexcept {
+        if (error_ != Error::OK) {
+            return false;
+        }
+
+        const Error error = detail::json_emit(*sink_, text);
+        if (error != Error::OK) {
+            return fail(error);
+        }
+        bytes_written_ += static_cast<uint32_t>(text.size());
+        return true;
+    }
+
+    /**
+     * @brief 要素の区切りを書き込み、要素があることを記録する
+     */
+    bool separate() noexcept {
+        const uint64_t bit = uint64_t {1} << (depth_ - 1);
+        if ((items_mask_ & bit) != 0) {
+            return emit(",");
+        }
+        items_mask_ |= bit;
+        return true;
+    }
+
+    /**
+     * @brief 値を書き込める位置か確認し、必要なら区切りを書き込む
+     */
+    bool prepare_value() noexcept {
+        if (error_ != Error::OK) {
+            return false;
+        }
+
+        if (depth_ == 0) {
+            if (complete_) {
+                return fail(Error::INVALID_PARAMETER);
+            }
+            complete_ = true;
+            return true;
+        }
+
+        if (in_object()) {
+            if (!after_key_) {
+                return fail(Error::INVALID_PARAMETER);
+            }
+            after_key_ = false;
+            return true;
+        }
+        return separate();
+    }
+
+    bool write_scalar(std::string_view text) noexcept { return prepare_value() && emit(text); }
+
+    bool begin(char open, bool object) noexcept {
+        if (!prepare_value()) {
+            return false;
+        }
+        if (depth_ == MaxDepth) {
+            return fail(Error::BUFFER_FULL);
+        }
+
+        const uint64_t bit = uint64_t {1} << depth_;
+        object_mask_ = object ? (object_mask_ | bit) : (object_mask_ & ~bit);
+        items_mask_ &= ~bit;
+        ++depth_;
+        return emit(std::string_view(&open, 1));
+    }
+
+    bool end(char close, bool object) noexcept {
+        if (error_ != Error::OK) {
+            return false;
+        }
+        if (depth_ == 0 || in_object() != object || after_key_) {
+            return fail(Error::INVALID_PARAMETER);
+        }
+
+        --depth_;
+        return emit(std::string_view(&close, 1));
+    }
+
+    /**
+     * @brief 文字列を引用符で囲み、エスケープして書き込む
+     *
+     * エスケープ不要な部分はまとめて書き込む。
+     */
+    bool write_string(std::string_view text) noexcept {
+        if (!emit("\"")) {
+            return false;
+        }
+
+        const char* p = text.data();
+        const char* const last = p + text.size();
+        while (p < last) {
+            const char* special = detail::json_find_special(p, last);
+            if (special > p && !emit(std::string_view(p, static_cast<size_t>(special - p)))) {
+                return false;
+            }
+            if (special == last) {
+                break;
+            }
+
+            char escape[6] = {'\\', 'u', '0', '0', '0', '0'};
+            size_t length = 2;
+            switch (*special) {
+                case '"':
+                    escape[1] = '"';
+                    break;
+                case '\\':
+                    escape[1] = '\\';
+                    break;
+                case '\n':
+                    escape[1] = 'n';
+                    break;
+                case '\r':
+                    escape[1] = 'r';
+                    break;
+                case '\t':
+                    escape[1] = 't';
+                    break;
+                case '\b':
+                    escape[1] = 'b';
+                    break;
+                case '\f':
+                    escape[1] = 'f';
+                    break;
+                default: {
+                    const auto c = static_cast<uint8_t>(*special);
+                    escape[4] = static_cast<char>('0' + (c >> 4));
+                    escape[5] = "0123456789abcdef"[c & 0x0FU];
+                    length = 6;
+                    break;
+                }
+            }
+            if (!emit(std::string_view(escape, length))) {
+                return false;
+            }
+            p = special + 1;
+        }
+
+        return emit("\"");
+    }
+
+    Sink* sink_;
+    uint64_t object_mask_ = 0; ///< 深さごとのオブジェクト（1）/ 配列（0）
+    uint64_t items_mask_ = 0;  ///< 深さごとの要素の有無
+    uint32_t depth_ = 0;
+    uint32_t bytes_written_ = 0;
+    bool after_key_ = false;
+    bool complete_ = false;
+    Error error_ = Error::OK;
+};
+
+/**
+ * @brief JSON のトークンの種類
+ */
+enum class JsonTokenType : uint8_t {
+    BEGIN_OBJECT, ///< {
+    END_OBJECT,   ///< }
+    BEGIN_ARRAY,  ///< [
+    END_ARRAY,    ///< ]
+    KEY,          ///< オブジェクトのキー
+    STRING,       ///< 文字列
+    NUMBER,       ///< 数値
+    TRUE_VALUE,   ///< true
+    FALSE_VALUE,  ///< false
+    NULL_VALUE,   ///< null
+    END           ///< ドキュメントの終端
+};
+
+/**
+ * @brief JSON のトークン
+ */
+struct JsonToken {
+    JsonTokenType type = JsonTokenType::END;
+
+    /**
+     * @brief トークンの文字列（入力へのビュー）
+     *
+     * KEY / STRING は引用符を除いた中身（エスケープはそのまま）、NUMBER は数値の表記。
+     */
+    std::string_view text;
+
+    /** @brief KEY / STRING がエスケープを含むか（含む場合は json_unescape() で復元する） */
+    bool escaped = false;
+
+    /**
+     * @brief NUMBER を数値に変換
+     */
+    template <typename T>
+    [[nodiscard]] Result<T> as() const noexcept {
+        if (type != JsonTokenType::NUMBER) {
+            return Result<T>::err(Error::INVALID_DATA);
+        }
+        return parse<T>(text);
+    }
+};
+
+/**
+ * @brief エスケープを含む JSON 文字列の中身を復元
+ *
+ * \\uXXXX（サロゲートペアを含む）は UTF-8 に変換する。
+ *
+ * @param escaped JsonToken::text
+ * @param out 出力先
+ * @return 復元した文字列（out の先頭を参照。容量不足は Error::BUFFER_FULL、不正なエスケープは Error::INVALID_DATA）
+ */
+[[nodiscard]] inline Result<std::string_view> json_unescape(std::string_view escaped, span<char> out) noexcept {
+    size_t n = 0;
+    const char* p = escaped.data();
+    const char* const end = p + escaped.size();
+
+    const auto put = [&](char c) noexcept {
+        if (n >= out.size()) {
+            return false;
+        }
+        out[n++] = c;
+        return true;
+    };
+
+    while (p < end) {
+        if (*p != '\\') {
+            if (!put(*p)) {
+                return Result<std::string_view>::err(Error::BUFFER_FULL);
+            }
+            ++p;
+            continue;
+        }
+
+        if (end - p < 2) {
+            return Result<std::string_view>::err(Error::INVALID_DATA);
+        }
+
+        char c = p[1];
+        p += 2;
+        switch (c) {
+            case '"':
+            case '\\':
+            case '/':
+                break;
+            case 'b':
+                c = '\b';
+                break;
+            case 'f':
+                c = '\f';
+                break;
+            case 'n':
+                c = '\n';
+                break;
+            case 'r':
+                c = '\r';
+                break;
+            case 't':
+                c = '\t';
+                break;
+            case 'u': {
+                int32_t code = (end - p >= 4) ? detail::json_read_hex4(p) : -1;
+                if (code < 0) {
+                    return Result<std::string_view>::err(Error::INVALID_DATA);
+                }
+                p += 4;
+
+                if (code >= 0xD800 && code <= 0xDBFF) {
+                    // 上位サロゲートの後には \\u で下位サロゲートが続く
+                    const int32_t low = (end - p >= 6 && p[0] == '\\' && p[1] == 'u') ? detail::json_read_hex4(p + 2) : -1;
+                    if (low < 0xDC00 || low > 0xDFFF) {
+                        return Result<std::string_view>::err(Error::INVALID_DATA);
+                    }
+                    code = 0x10000 + ((code - 0xD800) << 10) + (low - 0xDC00);
+                    p += 6;
+                } else if (code >= 0xDC00 && code <= 0xDFFF) {
+                    return Result<std::string_view>::err(Error::INVALID_DATA);
+                }
+
+                char utf8[4];
+                uint32_t length = 0;
+                const auto cp = static_cast<uint32_t>(code);
+                if (cp < 0x80) {
+                    utf8[length++] = static_cast<char>(cp);
+                } else if (cp < 0x800) {
+                    utf8[length++] = static_cast<char>(0xC0U | (cp >> 6));
+                    utf8[length++] = static_cast<char>(0x80U | (cp & 0x3FU));
+                } else if (cp < 0x10000) {
+                    utf8[length++] = static_cast<char>(0xE0U | (cp >> 12));
+                    utf8[length++] = static_cast<char>(0x80U | ((cp >> 6) & 0x3FU));
+                    utf8[length++] = static_cast<char>(0x80U | (cp & 0x3FU));
+                } else {
+                    utf8[length++] = static_cast<char>(0xF0U | (cp >> 18));
+                    utf8[length++] = static_cast<char>(0x80U | ((cp >> 12) & 0x3FU));
+                    utf8[length++] = static_cast<char>(0x80U | ((cp >> 6) & 0x3FU));
+                    utf8[length++] = static_cast<char>(0x80U | (cp & 0x3FU));
+                }
+                for (uint32_t i = 0; i < length; ++i) {
+                    if (!put(utf8[i])) {
+                        return Result<std::string_view>::err(Error::BUFFER_FULL);
+                    }
+                }
+                continue;
+            }
+            default:
+                return Result<std::string_view>::err(Error::INVALID_DATA);
+        }
+
+        if (!put(c)) {
+            return Result<std::string_view>::err(Error::BUFFER_FULL);
+        }
+    }
+
+    return Result<std::string_view>::ok(std::string_view(out.data(), n));
+}
+
+/**
+ * @brief プル型の JSON パーサー（SAX 相当）
+ *
+ * std::string_view 上の JSON ドキュメントを next() で1トークンずつ読む。
+ * キー・文字列・数値は入力へのビューとして返し、コピーしない。動的メモリ確保なし。
+ * 入れ子の状態は MaxDepth ビットで保持し、それより深い入力は Error::BUFFER_FULL にする。
+ *
+ * - 文字列中の '"'・'\\'・制御文字の検索と空白の読み飛ばしは、x86-64 では SSE2 で16バイトずつ、
+ *   それ以外では SWAR で8バイトずつ行う
+ * - 入力が途中で終わっている: Error::BUFFER_EMPTY
+ * - 構文の誤り・ドキュメントの後の余分な文字: Error::INVALID_DATA
+ * - エラーの後は同じエラーを返し続ける
+ *
+ * 文字列の UTF-8 検証は行わない。
+ *
+ * @tparam MaxDepth 入れ子の最大の深さ（1〜64）
+ *
+ * @par 使用例
+ * @code
+ * JsonReader reader(config_text);
+ * for (auto token = reader.next(); token.is_ok() && token.value().type != JsonTokenType::END; token = reader.next()) {
+ *     if (token.value().type == JsonTokenType::KEY && token.value().text == "interval_ms") {
+ *         interval_ms = reader.next().value().as<uint32_t>().value_or(1000);
+ *     }
+ * }
+ * @endcode
+ */
+template <uint32_t MaxDepth = 16>
+class JsonReader {
+    static_assert(MaxDepth > 0 && MaxDepth <= 64, "JsonReader MaxDepth must be between 1 and 64");
+
+public:
+    /**
+     * @brief 入力を指定して構築
+     */
+    explicit JsonReader(std::string_view json) noexcept : begin_(json.data()), end_(json.data() + json.size()), p_(json.data()) {}
+
+    /**
+     * @brief 現在の入れ子の深さを取得
+     */
+    [[nodiscard]] uint32_t depth() const noexcept { return depth_; }
+
+    /**
+     * @brief 読み取り位置（入力先頭からのバイト数）を取得
+     */
+    [[nodiscard]] size_t position() const noexcept { return static_cast<size_t>(p_ - begin_); }
+
+    /**
+     * @brief 次のトークンを読む
+     */
+    [[nodiscard]] Result<JsonToken> next() noexcept {
+        if (error_ != Error::OK) {
+            return Result<JsonToken>::err(error_);
+        }
+
+        p_ = detail::json_skip_whitespace(p_, end_);
+
+        switch (state_) {
+            case State::DONE:
+                if (p_ != end_) {
+                    return fail(Error::INVALID_DATA);
+                }
+                return token(JsonTokenType::END);
+
+            case State::KEY_OR_END:
+                if (p_ < end_ && *p_ == '}') {
+                    return close(JsonTokenType::END_OBJECT);
+                }
+                return read_key();
+
+            case State::KEY:
+                return read_key();
+
+            case State::VALUE_OR_END:
+                if (p_ < end_ && *p_ == ']') {
+                    return close(JsonTokenType::END_ARRAY);
+                }
+                return read_value();
+
+            case State::VALUE:
+                return read_value();
+
+            case State::COMMA_OR_END:
+            default:
+                break;
+        }
+
+        if (p_ == end_) {
+            return fail(Error::BUFFER_EMPTY);
+        }
+
+        const char c = *p_;
+        if (c == ',') {
+            ++p_;
+            state_ = in_object() ? State::KEY : State::VALUE;
+            return next();
+        }
+        if (c == '}' && in_object()) {
+            return close(JsonTokenType::END_OBJECT);
+        }
+        if (c == ']' && !in_object()) {
+            return close(JsonTokenType::END_ARRAY);
+        }
+        return fail(Error::INVALID_DATA);
+    }
+
+    /**
+     * @brief 次の値を読み飛ばす（オブジェクト・配列は中身ごと）
+     *
+     * オブジェクトのキーの後や配列の要素の位置で呼ぶ。配列の2番目以降の要素では、前のカンマも読む。
+     * 値の位置でない場合（キーの位置・閉じ括弧の前・ドキュメントの後）は何も読まずに
+     * Error::INVALID_DATA を返す（その後も next() で読み続けられる）。
+     *
+     * @return 読み飛ばした値の JSON 表記（入力へのビュー、前後の空白とカンマを含まない）
+     */
+    [[nodiscard]] Result<std::string_view> skip() noexcept {
+        if (error_ != Error::OK) {
+            return Result<std::string_view>::err(error_);
+        }
+
+        p_ = detail::json_skip_whitespace(p_, end_);
+        if (state_ == State::COMMA_OR_END && !in_object() && p_ < end_ && *p_ == ',') {
+            ++p_;
+            state_ = State::VALUE;
+            p_ = detail::json_skip_whitespace(p_, end_);
+        }
+
+        const bool at_value = (state_ == State::VALUE) || (state_ == State::VALUE_OR_END && (p_ == end_ || *p_ != ']'));
+        if (!at_value) {
+            return Result<std::string_view>::err(Error::INVALID_DATA);
+        }
+
+        const char* start = p_;
+        const Result<JsonToken> first = next();
+        if (first.is_err()) {
+            return Result<std::string_view>::err(first.error());
+        }
+
+        const JsonTokenType type = first.value().type;
+        if (type == JsonTokenType::BEGIN_OBJECT || type == JsonTokenType::BEGIN_ARRAY) {
+            const uint32_t target = depth_ - 1;
+            while (depth_ > target) {
+                const Result<JsonToken> t = next();
+                if (t.is_err()) {
+                    return Result<std::string_view>::err(t.error());
+                }
+            }
+        }
+
+        return Result<std::string_view>::ok(std::string_view(start, static_cast<size_t>(p_ - start)));
+    }
+
+private:
+    enum class State : uint8_t {
+        VALUE,        ///< 値（ドキュメント先頭、コロン・配列のカンマの後）
+        VALUE_OR_END, ///< 値または ]（[ の後）
+        KEY,          ///< キー（オブジェクトのカンマの後）
+        KEY_OR_END,   ///< キーまたは }（{ の後）
+        COMMA_OR_END, ///< カンマまたは閉じ括弧（値の後）
+        DONE          ///< ドキュメントの後
+    };
+
+    [[nodiscard]] bool in_object() const noexcept { return ((object_mask_ >> (depth_ - 1)) & 1U) != 0; }
+
+    Result<JsonToken> fail(Error error) noexcept {
+        error_ = error;
+        return Result<JsonToken>::err(error);
+    }
+
+    static Result<JsonToken> token(JsonTokenType type, std::string_view text = std::string_view {}, bool escaped = false) noexcept {
+        JsonToken t;
+        t.type = type;
+        t.text = text;
+        t.escaped = escaped;
+        return Result<JsonToken>::ok(t);
+    }
+
+    void after_value() noexcept { state_ = (depth_ == 0) ? State::DONE : State::COMMA_OR_END; }
+
+    Result<JsonToken> open(JsonTokenType type, bool object) noexcept {
+        if (depth_ == MaxDepth) {
+            return fail(Error::BUFFER_FULL);
+        }
+
+        const uint64_t bit = uint64_t {1} << depth_;
+        object_mask_ = object ? (object_mask_ | bit) : (object_mask_ & ~bit);
+        ++depth_;
+        ++p_;
+        state_ = object ? State::KEY_OR_END : State::VALUE_OR_END;
+        return token(type);
+    }
+
+    Result<JsonToken> close(JsonTokenType type) noexcept {
+        --depth_;
+        ++p_;
+        after_value();
+        return token(type);
+    }
+
+    /**
+     * @brief 文字列を読む（p_ は開始の '"'）
+     */
+    Error scan_string(std::string_view& text, bool& escaped) noexcept {
+        const char* start = p_ + 1;
+        const char* p = start;
+        escaped = false;
+
+        for (;;) {
+            p = detail::json_find_special(p, end_);
+            if (p == end_) {
+                return Error::BUFFER_EMPTY;
+            }
+            if (*p == '"') {
+                break;
+            }
+            if (*p != '\\') {
+                // 制御文字はエスケープが必要
+                return Error::INVALID_DATA;
+            }
+
+            escaped = true;
+            if (end_ - p < 2) {
+                return Error::BUFFER_EMPTY;
+            }
+            const char c = p[1];
+            if (c == 'u') {
+                if (end_ - p < 6) {
+                    return Error::BUFFER_EMPTY;
+                }
+                if (detail::json_read_hex4(p + 2) < 0) {
+                    return Error::INVALID_DATA;
+                }
+                p += 6;
+            } else if (c == '"' || c == '\\' || c == '/' || c == 'b' || c == 'f' || c == 'n' || c == 'r' || c == 't') {
+                p += 2;
+            } else {
+                return Error::INVALID_DATA;
+            }
+        }
+
+        text = std::string_view(start, static_cast<size_t>(p - start));
+        p_ = p + 1;
+        return Error::OK;
+    }
+
+    Result<JsonToken> read_key() noexcept {
+        if (p_ == end_) {
+            return fail(Error::BUFFER_EMPTY);
+        }
+        if (*p_ != '"') {
+            return fail(Error::INVALID_DATA);
+        }
+
+        std::string_view text;
+        bool escaped = false;
+        const Error error = scan_string(text, escaped);
+        if (error != Error::OK) {
+            return fail(error);
+        }
+
+        p_ = detail::json_skip_whitespace(p_, end_);
+        if (p_ == end_) {
+            return fail(Error::BUFFER_EMPTY);
+        }
+        if (*p_ != ':') {
+            return fail(Error::INVALID_DATA);
+        }
+        ++p_;
+        state_ = State::VALUE;
+        return token(JsonTokenType::KEY, text, escaped);
+    }
+
+    /**
+     * @brief リテラル（true / false / null）を読む
+     */
+    Result<JsonToken> read_literal(std::string_view literal, JsonTokenType type) noexcept {
+        const auto available = static_cast<size_t>(end_ - p_);
+        const size_t n = (available < literal.size()) ? available : literal.size();
+        if (std::string_view(p_, n) != literal.substr(0, n)) {
+            return fail(Error::INVALID_DATA);
+        }
+        if (n < literal.size()) {
+            return fail(Error::BUFFER_EMPTY);
+        }
+
+        p_ += literal.size();
+        after_value();
+        return token(type, literal);
+    }
+
+    /**
+     * @brief 数値を読む（-?(0|[1-9][0-9]*)(.[0-9]+)?([eE][+-]?[0-9]+)?）
+     */
+    Result<JsonToken> read_number() noexcept {
+        const char* start = p_;
+        const char* p = p_;
+
+        const auto digits = [&]() noexcept {
+            const char* first = p;
+            while (p < end_ && detail::is_digit(*p)) {
+                ++p;
+            }
+            return p - first;
+        };
+        // 入力の終端で数値が終わっていない場合は途中で終わっている
+        const auto incomplete = [&]() noexcept { return fail((p == end_) ? Error::BUFFER_EMPTY : Error::INVALID_DATA); };
+
+        if (*p == '-') {
+            ++p;
+        }
+        if (p < end_ && *p == '0') {
+            ++p;
+        } else if (digits() == 0) {
+            return incomplete();
+        }
+
+        if (p < end_ && *p == '.') {
+            ++p;
+            if (digits() == 0) {
+                return incomplete();
+            }
+        }
+
+        if (p < end_ && (*p == 'e' || *p == 'E')) {
+            ++p;
+            if (p < end_ && (*p == '+' || *p == '-')) {
+                ++p;
+            }
+            if (digits() == 0) {
+                return incomplete();
+            }
+        }
+
+        p_ = p;
+        after_value();
+        return token(JsonTokenType::NUMBER, std::string_view(start, static_cast<size_t>(p - start)));
+    }
+
+    Result<JsonToken> read_value() noexcept {
+        if (p_ == end_) {
+            return fail(Error::BUFFER_EMPTY);
+        }
+
+        switch (*p_) {
+            case '{':
+                return open(JsonTokenType::BEGIN_OBJECT, true);
+            case '[':
+                return open(JsonTokenType::BEGIN_ARRAY, false);
+            case '"': {
+                std::string_view text;
+                bool escaped = false;
+                const Error error = scan_string(text, escaped);
+                if (error != Error::OK) {
+                    return fail(error);
+                }
+                after_value();
+                return token(JsonTokenType::STRING, text, escaped);
+            }
+            case 't':
+                return read_literal("true", JsonTokenType::TRUE_VALUE);
+            case 'f':
+                return read_literal("false", JsonTokenType::FALSE_VALUE);
+            case 'n':
+                return read_literal("null", JsonTokenType::NULL_VALUE);
+            default:
+                if (*p_ == '-' || detail::is_digit(*p_)) {
+                    return read_number();
+                }
+                return fail(Error::INVALID_DATA);
+        }
+    }
+
+    const char* begin_;
+    const char* end_;
+    const char* p_;
+    uint64_t object_mask_ = 0; ///< 深さごとのオブジェクト（1）/ 配列（0）
+    uint32_t depth_ = 0;
+    State state_ = State::VALUE;
+    Error error_ = Error::OK;
+};
+
+} // namespace omusubi
@@ -0,0 +1,278 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <omusubi/core/result.hpp>
+#include <omusubi/interface/readable.h>
+#include <string_view>
+
+namespace omusubi {
+
+/**
+ * @brief 最大行長を超えた行の扱い
+ */
+enum class LineOverflowPolicy : uint8_t {
+    DISCARD,  ///< 行全体を捨てる（次の改行まで読み飛ばす）
+    TRUNCATE, ///< 先頭の最大行長分だけを1行として返し、残りを捨てる
+    SPLIT     ///< 最大行長ごとに分割して複数行として返す
+};
+
+/**
+ * @brief ByteReadable をラップするバッファ付き行リーダー
+ *
+ * 任意の ByteReadable から `\n` または `\r\n` 区切りの行を取り出す。
+ * ドライバごとに1バイトずつ読む read_line() を実装する必要がなくなる。
+ *
+ * - 改行の検索は memchr（libc の実装によりワード単位・SIMDで走査される）
+ * - 行は std::string_view としてコピーなしで返す
+ *   - 内部バッファが空で、ソースの peek() 領域に行全体がある場合はその領域を直接参照する
+ *   - それ以外は内部バッファ上の行を参照する。未完了の行は必要なときだけバッファ先頭へ詰めるため、
+ *     行が途中で折り返すことはない
+ * - 返した std::string_view は次に read_line() を呼ぶまで有効
+ * - 最大行長を超えた行は LineOverflowPolicy に従って処理する
+ *
+ * @tparam BufferSize 内部バッファのバイト数（MaxLineLength + 2 以上）
+ * @tparam MaxLineLength 最大行長（改行文字を除く）
+ *
+ * @par 使用例
+ * @code
+ * static LineReader<256, 82> nmea(*serial);  // NMEA 0183 の最大文長は82文字
+ *
+ * void update() {
+ *     for (auto line = nmea.read_line(); line.is_ok(); line = nmea.read_line()) {
+ *         handle_sentence(line.value());
+ *     }
+ * }
+ * @endcode
+ */
+template <uint32_t BufferSize, uint32_t MaxLineLength = BufferSize - 2>
+class LineReader : public TextReadable {
+    static_assert(MaxLineLength > 0, "MaxLineLength must be greater than 0");
+    static_assert(BufferSize >= MaxLineLength + 2, "BufferSize must hold MaxLineLength plus CR LF");
+
+public:
+    /**
+     * @brief 読み取り元と超過時の扱いを指定して構築
+     */
+    explicit LineReader(ByteReadable& source, LineOverflowPolicy policy = LineOverflowPolicy::DISCARD) noexcept : source_(&source), policy_(policy) {}
+
+    ~LineReader() override = default;
+    LineReader(const LineReader&) = delete;
+    LineReader& operator=(const LineReader&) = delete;
+    LineReader(LineReader&&) = delete;
+    LineReader& operator=(LineReader&&) = delete;
+
+    /**
+     * @brief 最大行長を取得
+     */
+    [[nodiscard]] static constexpr uint32_t max_line_length() noexcept { return MaxLineLength; }
+
+    /**
+     * @brief 内部バッファに残っているバイト数を取得
+     */
+    [[nodiscard]] uint32_t buffered() const noexcept { return end_ - start_; }
+
+    /**
+     * @brief 最大行長を超えた行の数を取得
+     */
+    [[nodiscard]] uint32_t overflow_count() const noexcept { return overflow_count_; }
+
+    /**
+     * @brief 次の1行を取得（改行文字を除く）
+     *
+     * @return 行（完全な行がまだ届いていない場合は Error::BUFFER_EMPTY）
+     */
+    [[nodiscard]] Result<std::string_view> read_line() noexcept {
+        release_source();
+
+        for (;;) {
+            if (start_ < end_) {
+                const auto* newline = static_cast<const char*>(std::memchr(buffer_ + scan_, '\n', end_ - scan_));
+
+                if (newline != nullptr) {
+                    const auto line_end = static_cast<uint32_t>(newline - buffer_);
+                    const std::string_view line = strip_cr(std::string_view(buffer_ + start_, line_end - start_));
+
+                    if (discarding_) {
+                        discarding_ = false;
+                    } else if (line.size() > MaxLineLength) {
+                        if (policy_ == LineOverflowPolicy::SPLIT) {
+                            return Result<std::string_view>::ok(take_split());
+                        }
+                        ++overflow_count_;
+                        if (policy_ == LineOverflowPolicy::TRUNCATE) {
+                            start_ = scan_ = line_end + 1;
+                            return Result<std::string_view>::ok(line.substr(0, MaxLineLength));
+                        }
+                    } else {
+                        start_ = scan_ = line_end + 1;
+                        return Result<std::string_view>::ok(line);
+                    }
+
+                    start_ = scan_ = line_end + 1;
+                    continue;
+                }
+
+                scan_ = end_;
+
+                if (discarding_) {
+                    start_ = scan_ = end_;
+                } else if (end_ - start_ > MaxLineLength + 1) {
+                    // 改行が来る前に最大行長（+ CR）を超えた
+                    if (policy_ == LineOverflowPolicy::SPLIT) {
+                        return Result<std::string_view>::ok(take_split());
+                    }
+
+                    ++overflow_count_;
+                    discarding_ = true;
+                    const std::string_view head(buffer_ + start_, MaxLineLength);
+                    start_ = scan_ = end_;
+                    if (policy_ == LineOverflowPolicy::TRUNCATE) {
+                        return Result<std::string_view>::ok(head);
+                    }
+                }
+            }
+
+            if (start_ == end_ && !discarding_) {
+                const span<const uint8_t> region = source_->peek();
+                const std::string_view line = find_line_in(region);
+                if (line.data() != nullptr) {
+                    return Result<std::string_view>::ok(line);
+                }
+            }
+
+            if (!fill()) {
+                return Result<std::string_view>::err(Error::BUFFER_EMPTY);
+            }
+        }
+    }
+
+    /**
+     * @brief 次の1行をバッファへコピー（TextReadable）
+     *
+     * 行がバッファに収まらない場合は切り詰める。
+     *
+     * @return コピーしたバイト数（完全な行がない場合0）
+     */
+    size_t read_line(span<char> buffer) override {
+        const Result<std::string_view> line = read_line();
+        if (line.is_err()) {
+            return 0;
+        }
+
+        const std::string_view text = line.value();
+        const size_t n = (text.size() < buffer.size()) ? text.size() : buffer.size();
+        if (n > 0) {
+            std::memcpy(buffer.data(), text.data(), n);
+        }
+        return n;
+    }
+
+    /**
+     * @brief 内部バッファを破棄
+     */
+    void reset() noexcept {
+        release_source();
+        start_ = scan_ = end_ = 0;
+        discarding_ = false;
+    }
+
+private:
+    static std::string_view strip_cr(std::string_view line) noexcept {
+        if (!line.empty() && line.back() == '\r') {
+            line.remove_suffix(1);
+        }
+        return line;
+    }
+
+    /**
+     * @brief ソースの peek() 領域から行全体をコピーなしで取り出す
+     *
+     * @return 行（領域内に改行がない、または最大行長を超える場合は data() が nullptr）
+     */
+    std::string_view find_line_in(span<const uint8_t> region) noexcept {
+        if (region.empty()) {
+            return std::string_view {};
+        }
+
+        const auto* begin = reinterpret_cast<const char*>(region.data());
+        const auto* newline = static_cast<const char*>(std::memchr(begin, '\n', region.size()));
+        if (newline == nullptr) {
+            return std::string_view {};
+        }
+
+        const std::string_view line = strip_cr(std::string_view(begin, static_cast<size_t>(newline - begin)));
+        if (line.size() > MaxLineLength) {
+            return std::string_view {};
+        }
+
+        // 次の read_line() まで領域を保持し、そこで consume する
+        pending_consume_ = static_cast<size_t>(newline - begin) + 1;
+        return line;
+    }
+
+    /**
+     * @brief 先頭から最大行長分を1行として切り出す（SPLIT）
+     */
+    std::string_view take_split() noexcept {
+        const std::string_view chunk(buffer_ + start_, MaxLineLength);
+        start_ += MaxLineLength;
+        if (scan_ < start_) {
+            scan_ = start_;
+        }
+        return chunk;
+    }
+
+    /**
+     * @brief 前回ソースの領域を直接返した行を consume する
+     */
+    void release_source() noexcept {
+        if (pending_consume_ > 0) {
+            source_->consume(pending_consume_);
+            pending_consume_ = 0;
+        }
+    }
+
+    /**
+     * @brief ソースから内部バッファへ読み込む
+     *
+     * @return 1バイト以上読み込めた場合true
+     */
+    bool fill() noexcept {
+        if (start_ == end_) {
+            start_ = scan_ = end_ = 0;
+        } else if (end_ == BufferSize) {
+            std::memmove(buffer_, buffer_ + start_, end_ - start_);
+            end_ -= start_;
+            scan_ -= start_;
+            start_ = 0;
+        }
+
+        const uint32_t space = BufferSize - end_;
+        const span<const uint8_t> region = source_->peek();
+        size_t n = 0;
+
+        if (!region.empty()) {
+            n = (region.size() < space) ? region.size() : space;
+            std::memcpy(buffer_ + end_, region.data(), n);
+            source_->consume(n);
+        } else {
+            n = source_->read(span<uint8_t>(reinterpret_cast<uint8_t*>(buffer_ + end_), space));
+        }
+
+        end_ += static_cast<uint32_t>(n);
+        return n > 0;
+    }
+
+    ByteReadable* source_;
+    LineOverflowPolicy policy_;
+    bool discarding_ = false;
+    uint32_t start_ = 0; ///< 未返却データの先頭
+    uint32_t scan_ = 0;  ///< 改行を検索済みの位置
+    uint32_t end_ = 0;   ///< データの終端
+    uint32_t overflow_count_ = 0;
+    size_t pending_consume_ = 0;
+    char buffer_[BufferSize];
+};
+
+} // namespace omusubi
@@ -0,0 +1,515 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <omusubi/core/mcu_config.h>
+#include <omusubi/core/result.hpp>
+#include <omusubi/core/span.hpp>
+#include <omusubi/interface/writable.h>
+
+namespace omusubi {
+
+/**
+ * @brief 圧縮・復元の1回の呼び出しで進んだバイト数
+ */
+struct LzProgress {
+    uint32_t consumed; ///< 入力から読んだバイト数
+    uint32_t produced; ///< 出力へ書いたバイト数
+};
+
+namespace detail {
+
+// 符号列（LZF 形式）
+//   000LLLLL                        : 続く L + 1 バイトがリテラル（1〜32）
+//   LLLOOOOO [EEEEEEEE] OOOOOOOO    : 一致。長さ L + 2（L = 7 のときは拡張バイトを加える）、
+//                                     距離は13ビットの O + 1（1〜8192）
+inline constexpr uint32_t LZ_MIN_MATCH = 3;
+inline constexpr uint32_t LZ_MAX_MATCH = 7 + 255 + 2;
+inline constexpr uint32_t LZ_MAX_LITERALS = 32;
+inline constexpr uint32_t LZ_MAX_TOKEN = 3;
+
+/**
+ * @brief 一致の長さを数える（8バイト単位で比較）
+ */
+[[nodiscard]] inline uint32_t lz_match_length(const uint8_t* a, const uint8_t* b, uint32_t limit) noexcept {
+    uint32_t length = 0;
+    while (length + 8 <= limit) {
+        uint64_t x;
+        uint64_t y;
+        std::memcpy(&x, a + length, 8);
+        std::memcpy(&y, b + length, 8);
+        const uint64_t diff = x ^ y;
+        if (diff != 0) {
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+            return length + static_cast<uint32_t>(__builtin_ctzll(diff)) / 8;
+#else
+            break;
+#endif
+        }
+        length += 8;
+    }
+    while (length < limit && a[length] == b[length]) {
+        ++length;
+    }
+    return length;
+}
+
+} // namespace detail
+
+/**
+ * @brief 小さな窓の LZ 圧縮器（LZF 形式、ストリーミング）
+ *
+ * ログやテレメトリのブロックを、固定量のRAMだけで逐次圧縮する。入力と出力はどちらも任意の大きさの span で、
+ * 1回の compress() で入力を読めるだけ読み、出力に書けるだけ書く。入りきらなかった符号は内部に保持して次の呼び出しで出力する。
+ *
+ * - 使用RAM: 窓の2倍 + 264 バイトの入力バッファと 2^HashBits × 2 バイトのハッシュ表
+ * - HashBits = 0 ではハッシュ表を持たず窓全体を探索する（RAM最小）
+ * - flush = true で入力の残りをすべて符号化する。その後も同じ窓のまま続けて圧縮できる
+ *
+ * @tparam WindowBits 窓の大きさ（2^N バイト、8〜13）
+ * @tparam HashBits ハッシュ表の大きさ（2^N 要素、0 は表なし）
+ *
+ * @par 使用例
+ * @code
+ * LzCompressor<> lz;
+ * uint8_t out[64];
+ * while (input.size() > 0) {
+ *     auto step = lz.compress(input, span<uint8_t>(out), false);
+ *     send(out, step.produced);
+ *     input = input.subspan(step.consumed, input.size() - step.consumed);
+ * }
+ * do {
+ *     auto step = lz.compress(span<const uint8_t>(), span<uint8_t>(out), true);
+ *     send(out, step.produced);
+ * } while (lz.has_pending());
+ * @endcode
+ */
+template <uint32_t WindowBits = static_cast<uint32_t>(config::LZ_WINDOW_BITS), uint32_t HashBits = static_cast<uint32_t>(config::LZ_HASH_BITS)>
+class LzCompressor {
+    static_assert(WindowBits >= 8 && WindowBits <= 13, "LzCompressor: WindowBits must be 8..13");
+    static_assert(HashBits <= 16, "LzCompressor: HashBits must be 0..16");
+
+public:
+    /** @brief 窓の大きさ（最大の一致距離） */
+    static constexpr uint32_t WINDOW_SIZE = uint32_t {1} << WindowBits;
+
+    /** @brief 入力バッファの大きさ（窓 + 先読み + スライドの余裕） */
+    static constexpr uint32_t BUFFER_SIZE = WINDOW_SIZE * 2 + detail::LZ_MAX_MATCH;
+
+    LzCompressor() noexcept { reset(); }
+
+    /**
+     * @brief 新しいストリームを開始（窓を空にする）
+     */
+    void reset() noexcept {
+        fill_ = 0;
+        position_ = 0;
+        literal_count_ = 0;
+        stage_length_ = 0;
+        stage_position_ = 0;
+        if constexpr (HashBits > 0) {
+            std::memset(hash_, 0, sizeof(hash_));
+        }
+    }
+
+    /**
+     * @brief 入力を圧縮して出力に書く
+     *
+     * @param input 圧縮するデータ（読めた分は consumed で返す）
+     * @param output 出力先（書いた分は produced で返す）
+     * @param flush true の場合、入力をすべて読んだ後に先読み中のデータとリテラルも符号化する
+     */
+    LzProgress compress(span<const uint8_t> input, span<uint8_t> output, bool flush) noexcept {
+        LzProgress progress {0, 0};
+
+        while (true) {
+            drain(output, progress);
+            if (stage_position_ < stage_length_) {
+                break;
+            }
+
+            if (fill_ - position_ < detail::LZ_MAX_MATCH && progress.consumed < input.size()) {
+                progress.consumed += load(input.subspan(progress.consumed, input.size() - progress.consumed));
+                continue;
+            }
+
+            if (fill_ - position_ >= detail::LZ_MAX_MATCH || (flush && position_ < fill_)) {
+                step();
+            } else if (flush && literal_count_ > 0) {
+                stage_literals();
+            } else {
+                break;
+            }
+        }
+        return progress;
+    }
+
+    /**
+     * @brief 符号化していない入力または出力していない符号が残っているか
+     */
+    [[nodiscard]] bool has_pending() const noexcept {
+        return position_ < fill_ || literal_count_ > 0 || stage_position_ < stage_length_;
+    }
+
+private:
+    /**
+     * @brief 入力をバッファに読み込む（満杯なら窓の外に出た部分を捨てる）
+     */
+    uint32_t load(span<const uint8_t> input) noexcept {
+        if (fill_ == BUFFER_SIZE) {
+            slide();
+        }
+
+        const uint32_t room = BUFFER_SIZE - fill_;
+        const uint32_t n = (input.size() < room) ? static_cast<uint32_t>(input.size()) : room;
+        std::memcpy(buffer_ + fill_, input.data(), n);
+        fill_ += n;
+        return n;
+    }
+
+    void slide() noexcept {
+        // 先読みが足りないときだけ呼ばれるため position_ > WINDOW_SIZE
+        const uint32_t shift = position_ - WINDOW_SIZE;
+        std::memmove(buffer_, buffer_ + shift, fill_ - shift);
+        fill_ -= shift;
+        position_ -= shift;
+
+        if constexpr (HashBits > 0) {
+            for (uint16_t& entry : hash_) {
+                entry = (entry > shift) ? static_cast<uint16_t>(entry - shift) : 0;
+            }
+        }
+    }
+
+    /**
+     * @brief 現在位置で一致を探し、一致またはリテラル1バイトを符号化する
+     */
+    void step() noexcept {
+        const uint32_t available = fill_ - position_;
+        const uint32_t limit = (available < detail::LZ_MAX_MATCH) ? available : detail::LZ_MAX_MATCH;
+
+        uint32_t best_length = 0;
+        uint32_t best_distance = 0;
+        if (limit >= detail::LZ_MIN_MATCH) {
+            find_match(limit, best_length, best_distance);
+        }
+
+        if (best_length < detail::LZ_MIN_MATCH) {
+            insert(position_);
+            literals_[literal_count_++] = buffer_[position_++];
+            if (literal_count_ == detail::LZ_MAX_LITERALS) {
+                stage_literals();
+            }
+            return;
+        }
+
+        if (literal_count_ > 0) {
+            stage_literals();
+        }
+        stage_match(best_length, best_distance);
+
+        // ハッシュ表には一致の先頭と末尾付近だけ登録する（速度優先）
+        insert(position_);
+        insert(position_ + best_length - 2);
+        position_ += best_length;
+    }
+
+    void find_match(uint32_t limit, uint32_t& best_length, uint32_t& best_distance) const noexcept {
+        const uint8_t* current = buffer_ + position_;
+        const uint32_t max_distance = (position_ < WINDOW_SIZE) ? position_ : WINDOW_SIZE;
+
+        if constexpr (HashBits > 0) {
+            const uint32_t entry = hash_[hash(current)];
+            if (entry == 0) {
+                return;
+            }
+            const uint32_t candidate = entry - 1;
+            const uint32_t distance = position_ - candidate;
+            if (candidate < position_ && distance <= max_distance) {
+                const uint32_t length = detail::lz_match_length(buffer_ + candidate, current, limit);
+                if (length >= detail::LZ_MIN_MATCH) {
+                    best_length = length;
+                    best_distance = distance;
+                }
+            }
+        } else {
+            for (uint32_t distance = 1; distance <= max_distance; ++distance) {
+                const uint8_t* candidate = current - distance;
+                if (candidate[best_length] != current[best_length] || candidate[0] != current[0]) {
+                    continue;
+                }
+                const uint32_t length = detail::lz_match_length(candidate, current, limit);
+                if (length > best_length) {
+                    best_length = length;
+                    best_distance = distance;
+                    if (length == limit) {
+                        break;
+                    }
+                }
+            }
+        }
+    }
+
+    static uint32_t hash(const uint8_t* p) noexcept {
+        const uint32_t value = p[0] | (static_cast<uint32_t>(p[1]) << 8) | (static_cast<uint32_t>(p[2]) << 16);
+        return (value * 2654435761U) >> (32 - HashBits);
+    }
+
+    void insert(uint32_t index) noexcept {
+        if constexpr (HashBits > 0) {
+            if (fill_ - index >= detail::LZ_MIN_MATCH) {
+                hash_[hash(buffer_ + index)] = static_cast<uint16_t>(index + 1);
+            }
+        } else {
+            (void)index;
+        }
+    }
+
+    void stage_literals() noexcept {
+        stage_[stage_length_++] = static_cast<uint8_t>(literal_count_ - 1);
+        std::memcpy(stage_ + stage_length_, literals_, literal_count_);
+        stage_length_ += literal_count_;
+        literal_count_ = 0;
+    }
+
+    void stage_match(uint32_t length, uint32_t distance) noexcept {
+        const uint32_t code = length - 2;
+        const uint32_t offset = distance - 1;
+        const uint32_t short_length = (code < 7) ? code : 7;
+        stage_[stage_length_++] = static_cast<uint8_t>((short_length << 5) | (offset >> 8));
+        if (short_length == 7) {
+            stage_[stage_length_++] = static_cast<uint8_t>(code - 7);
+        }
+        stage_[stage_length_++] = static_cast<uint8_t>(offset);
+    }
+
+    void drain(span<uint8_t> output, LzProgress& progress) noexcept {
+        const uint32_t pending = stage_length_ - stage_position_;
+        const uint32_t room = static_cast<uint32_t>(output.size()) - progress.produced;
+        const uint32_t n = (pending < room) ? pending : room;
+        if (n == 0) {
+            return;
+        }
+        std::memcpy(output.data() + progress.produced, stage_ + stage_position_, n);
+        progress.produced += n;
+        stage_position_ += n;
+        if (stage_position_ == stage_length_) {
+            stage_length_ = 0;
+            stage_position_ = 0;
+        }
+    }
+
+    static constexpr uint32_t HASH_SIZE = (HashBits > 0) ? (uint32_t {1} << HashBits) : 1;
+
+    uint8_t buffer_[BUFFER_SIZE];
+    uint16_t hash_[HASH_SIZE]; ///< バッファ内の位置 + 1（0 は空）
+    uint8_t literals_[detail::LZ_MAX_LITERALS];
+    uint8_t stage_[1 + detail::LZ_MAX_LITERALS + detail::LZ_MAX_TOKEN];
+    uint32_t fill_;
+    uint32_t position_;
+    uint32_t literal_count_;
+    uint32_t stage_length_;
+    uint32_t stage_position_;
+};
+
+/**
+ * @brief LzCompressor の出力を復元する伸張器（ストリーミング）
+ *
+ * 符号列を任意の位置で分割して渡せる。使用RAMは窓と同じ大きさの履歴のみ。
+ * 履歴より遠い距離を参照する入力は Error::INVALID_DATA を返す（以降は reset() まで同じエラー）。
+ *
+ * @tparam WindowBits 圧縮側と同じ窓の大きさ
+ */
+template <uint32_t WindowBits = static_cast<uint32_t>(config::LZ_WINDOW_BITS)>
+class LzDecompressor {
+    static_assert(WindowBits >= 8 && WindowBits <= 13, "LzDecompressor: WindowBits must be 8..13");
+
+public:
+    static constexpr uint32_t WINDOW_SIZE = uint32_t {1} << WindowBits;
+
+    /**
+     * @brief 新しいストリームを開始
+     */
+    void reset() noexcept {
+        state_ = State::CONTROL;
+        head_ = 0;
+        history_length_ = 0;
+        remaining_ = 0;
+    }
+
+    /**
+     * @brief 符号列を復元して出力に書く
+     */
+    [[nodiscard]] Result<LzProgress> decompress(span<const uint8_t> input, span<uint8_t> output) noexcept {
+        LzProgress progress {0, 0};
+        const auto in_size = static_cast<uint32_t>(input.size());
+        const auto out_size = static_cast<uint32_t>(output.size());
+
+        while (true) {
+            switch (state_) {
+                case State::CONTROL: {
+                    if (progress.consumed == in_size) {
+                        return Result<LzProgress>::ok(progress);
+                    }
+                    const uint8_t control = input[progress.consumed++];
+                    if (control < detail::LZ_MAX_LITERALS) {
+                        remaining_ = control + 1U;
+                        state_ = State::LITERAL;
+                    } else {
+                        remaining_ = control >> 5;
+                        distance_ = static_cast<uint32_t>(control & 0x1F) << 8;
+                        state_ = (remaining_ == 7) ? State::LENGTH : State::OFFSET;
+                    }
+                    break;
+                }
+                case State::LENGTH:
+                    if (progress.consumed == in_size) {
+                        return Result<LzProgress>::ok(progress);
+                    }
+                    remaining_ += input[progress.consumed++];
+                    state_ = State::OFFSET;
+                    break;
+                case State::OFFSET:
+                    if (progress.consumed == in_size) {
+                        return Result<LzProgress>::ok(progress);
+                    }
+                    distance_ = (distance_ | input[progress.consumed++]) + 1;
+                    if (distance_ > history_length_) {
+                        state_ = State::FAILED;
+                        break;
+                    }
+                    remaining_ += 2;
+                    state_ = State::COPY;
+                    break;
+                case State::LITERAL: {
+                    const uint32_t n = min3(remaining_, in_size - progress.consumed, out_size - progress.produced);
+                    if (n == 0) {
+                        return Result<LzProgress>::ok(progress);
+                    }
+                    for (uint32_t i = 0; i < n; ++i) {
+                        const uint8_t byte = input[progress.consumed + i];
+                        output[progress.produced + i] = byte;
+                        push(byte);
+                    }
+                    progress.consumed += n;
+                    progress.produced += n;
+                    remaining_ -= n;
+                    if (remaining_ == 0) {
+                        state_ = State::CONTROL;
+                    }
+                    break;
+                }
+                case State::COPY: {
+                    const uint32_t room = out_size - progress.produced;
+                    const uint32_t n = (remaining_ < room) ? remaining_ : room;
+                    if (n == 0) {
+                        return Result<LzProgress>::ok(progress);
+                    }
+                    for (uint32_t i = 0; i < n; ++i) {
+                        const uint8_t byte = history_[(head_ - distance_) & (WINDOW_SIZE - 1)];
+                        output[progress.produced + i] = byte;
+                        push(byte);
+                    }
+                    progress.produced += n;
+                    remaining_ -= n;
+                    if (remaining_ == 0) {
+                        state_ = State::CONTROL;
+                    }
+                    break;
+                }
+                case State::FAILED:
+                default:
+                    return Result<LzProgress>::err(Error::INVALID_DATA);
+            }
+        }
+    }
+
+    /**
+     * @brief 符号の途中でないか（ストリームの区切りで true）
+     */
+    [[nodiscard]] bool is_complete() const noexcept { return state_ == State::CONTROL; }
+
+private:
+    enum class State : uint8_t { CONTROL, LENGTH, OFFSET, LITERAL, COPY, FAILED };
+
+    static uint32_t min3(uint32_t a, uint32_t b, uint32_t c) noexcept {
+        const uint32_t ab = (a < b) ? a : b;
+        return (ab < c) ? ab : c;
+    }
+
+    void push(uint8_t byte) noexcept {
+        history_[head_] = byte;
+        head_ = (head_ + 1) & (WINDOW_SIZE - 1);
+        if (history_length_ < WINDOW_SIZE) {
+            ++history_length_;
+        }
+    }
+
+    uint8_t history_[WINDOW_SIZE];
+    State state_ = State::CONTROL;
+    uint32_t head_ = 0;
+    uint32_t history_length_ = 0;
+    uint32_t remaining_ = 0;
+    uint32_t distance_ = 0;
+};
+
+/**
+ * @brief 書き込んだデータを圧縮して ByteWritable へ送るステージ
+ *
+ * 任意の ByteWritable（シリアル、ファイル、COBS エンコーダの前段など）の前に置く。
+ * 圧縮した符号は ChunkSize バイトずつ出力へ書く。flush() で入力の残りを符号化して送り切る。
+ *
+ * @par 使用例
+ * @code
+ * LzWriter<> compressed(*serial);
+ * logger_output.write(...);  // compressed.write(...)
+ * compressed.flush();
+ * @endcode
+ */
+template <uint32_t WindowBits = static_cast<uint32_t>(config::LZ_WINDOW_BITS), uint32_t HashBits = static_cast<uint32_t>(config::LZ_HASH_BITS), uint32_t ChunkSize = 64>
+class LzWriter : public ByteWritable {
+public:
+    explicit LzWriter(ByteWritable& output) noexcept : output_(&output) {}
+
+    /**
+     * @brief データを圧縮して出力
+     *
+     * @return 受け付けたバイト数（出力が書き込みに失敗した場合は以降0）
+     */
+    size_t write(span<const uint8_t> data) override {
+        size_t accepted = 0;
+        while (!failed_ && accepted < data.size()) {
+            const auto step = compressor_.compress(data.subspan(accepted, data.size() - accepted), span<uint8_t>(chunk_), false);
+            accepted += step.consumed;
+            forward(step.produced);
+        }
+        return failed_ ? 0 : accepted;
+    }
+
+    /**
+     * @brief 受け付けたデータをすべて符号化して出力
+     *
+     * @return すべて出力できた場合true
+     */
+    bool flush() noexcept {
+        while (!failed_ && compressor_.has_pending()) {
+            const auto step = compressor_.compress(span<const uint8_t>(), span<uint8_t>(chunk_), true);
+            forward(step.produced);
+        }
+        return !failed_;
+    }
+
+private:
+    void forward(uint32_t size) noexcept {
+        if (size > 0 && output_->write(span<const uint8_t>(chunk_, size)) != size) {
+            failed_ = true;
+        }
+    }
+
+    ByteWritable* output_;
+    LzCompressor<WindowBits, HashBits> compressor_;
+    uint8_t chunk_[ChunkSize];
+    bool failed_ = false;
+};
+
+} // namespace omusubi
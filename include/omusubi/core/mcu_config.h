@@ -26,6 +26,14 @@ inline constexpr std::size_t MAX_STRING_LENGTH = 256;
  */
 inline constexpr std::size_t MAX_BUFFER_SIZE = 1024;
 
+/**
+ * @brief CRC計算に使うテーブルの枚数（1 または 8）
+ *
+ * 8 の場合は slice-by-8（1バイトあたり約1/8のテーブル参照回数）で計算する。
+ * テーブルは CRC-32 で 8KB になるため、フラッシュの少ないMCUでは 1（1KB）にする。
+ */
+inline constexpr std::size_t CRC_TABLE_SLICES = 8;
+
 // ========================================
 // デバッグビルドの判定
 // ========================================
@@ -74,4 +82,23 @@ constexpr bool is_platform_generic() {
     return !is_platform_esp() && !is_platform_arduino();
 }
 
+// ========================================
+// プラットフォーム別の調整
+// ========================================
+
+/**
+ * @brief LZ圧縮の窓の大きさ（2^N バイト、8〜13）
+ *
+ * 窓が大きいほど遠くの繰り返しを参照できる。圧縮側は窓の約2倍、復元側は窓と同じ大きさのRAMを使う。
+ * ホストでは最大の 13（8KB）、MCUでは最小の 8（256バイト）にする。
+ */
+inline constexpr std::size_t LZ_WINDOW_BITS = is_platform_generic() ? 13 : 8;
+
+/**
+ * @brief LZ圧縮の一致探索に使うハッシュ表の大きさ（2^N 要素、0 は表なし）
+ *
+ * 表は1要素2バイト。0 の場合は窓全体を順に探索する（RAM最小、低速）。
+ */
+inline constexpr std::size_t LZ_HASH_BITS = is_platform_generic() ? 13 : 0;
+
 } // namespace omusubi::config
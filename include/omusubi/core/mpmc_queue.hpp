@@ -0,0 +1,221 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <omusubi/core/result.hpp>
+#include <omusubi/core/span.hpp>
+
+namespace omusubi {
+
+/**
+ * @brief 固定長MPMCキュー（ロックフリー）
+ *
+ * Dmitry Vyukov の bounded MPMC queue に基づく実装。
+ * 複数の生産者スレッドと複数の消費者スレッドから同時に使用できる。
+ *
+ * - 各スロットがシーケンス番号を持ち、スロットの状態（空き・格納済み）を表す
+ * - 生産者・消費者はそれぞれの位置をCASで確保し、確保後はスロットへの書き込みだけで完了する
+ * - 生産者位置と消費者位置は別のキャッシュラインに配置し、偽共有を避ける
+ * - 動的メモリ確保なし
+ *
+ * @tparam T 要素の型（デフォルト構築・コピー代入可能であること）
+ * @tparam N 容量（2の累乗、2以上）
+ *
+ * @note 主にホスト（Linuxゲートウェイなど）のマルチスレッド処理向け。
+ *       ISRとメインループ間の受け渡しには RingBuffer<T, N> を使用すること。
+ *
+ * @par 使用例
+ * @code
+ * static MpmcQueue<Frame, 1024> queue;
+ *
+ * // 受信スレッド（複数）
+ * if (!queue.try_push(frame)) { ++dropped; }
+ *
+ * // 処理スレッド（複数）
+ * auto result = queue.try_pop();
+ * if (result.is_ok()) { process(result.value()); }
+ * @endcode
+ */
+template <typename T, uint32_t N>
+class MpmcQueue {
+    static_assert(N >= 2 && (N & (N - 1)) == 0, "MpmcQueue capacity must be a power of two (>= 2)");
+
+public:
+    /**
+     * @brief キャッシュラインサイズ（位置カウンタの配置単位）
+     */
+    static constexpr size_t CACHE_LINE_SIZE = 64;
+
+    MpmcQueue() noexcept {
+        for (uint32_t i = 0; i < N; ++i) {
+            slots_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    ~MpmcQueue() noexcept = default;
+    MpmcQueue(const MpmcQueue&) = delete;
+    MpmcQueue& operator=(const MpmcQueue&) = delete;
+    MpmcQueue(MpmcQueue&&) = delete;
+    MpmcQueue& operator=(MpmcQueue&&) = delete;
+
+    /**
+     * @brief 容量を取得
+     */
+    [[nodiscard]] static constexpr uint32_t capacity() noexcept { return N; }
+
+    /**
+     * @brief 格納されている要素数の概算を取得
+     *
+     * 他スレッドが操作中の場合、呼び出し時点の正確な値とは限らない。
+     */
+    [[nodiscard]] uint32_t size_approx() const noexcept {
+        const uint32_t dequeue = dequeue_pos_.load(std::memory_order_relaxed);
+        const uint32_t enqueue = enqueue_pos_.load(std::memory_order_relaxed);
+        const auto diff = static_cast<int32_t>(enqueue - dequeue);
+
+        if (diff <= 0) {
+            return 0;
+        }
+        return (static_cast<uint32_t>(diff) < N) ? static_cast<uint32_t>(diff) : N;
+    }
+
+    /**
+     * @brief 1要素追加
+     *
+     * @return 満杯の場合false
+     */
+    bool try_push(const T& value) noexcept { return push(span<const T>(&value, 1)) == 1; }
+
+    /**
+     * @brief 1要素取り出し
+     *
+     * @return 取り出した要素（空の場合は Error::BUFFER_EMPTY）
+     */
+    [[nodiscard]] Result<T> try_pop() noexcept {
+        T value {};
+        if (pop(span<T>(&value, 1)) == 0) {
+            return Result<T>::err(Error::BUFFER_EMPTY);
+        }
+        return Result<T>::ok(value);
+    }
+
+    /**
+     * @brief 1要素取り出し（出力引数版）
+     *
+     * @return 空の場合false
+     */
+    bool try_pop(T& value) noexcept { return pop(span<T>(&value, 1)) == 1; }
+
+    /**
+     * @brief 複数要素をまとめて追加
+     *
+     * 先頭から連続して空いているスロットを1回のCASでまとめて確保する。
+     * 空きが足りない場合は確保できた分だけ追加する。
+     *
+     * @return 追加した要素数（満杯の場合0）
+     */
+    uint32_t push(span<const T> values) noexcept {
+        const auto requested = static_cast<uint32_t>(values.size());
+        if (requested == 0) {
+            return 0;
+        }
+
+        uint32_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+
+        for (;;) {
+            const uint32_t count = count_ready(pos, 0, requested);
+
+            if (count == 0) {
+                const uint32_t current = enqueue_pos_.load(std::memory_order_relaxed);
+                if (current == pos) {
+                    return 0; // 満杯
+                }
+                pos = current;
+                continue;
+            }
+
+            if (enqueue_pos_.compare_exchange_weak(pos, pos + count, std::memory_order_relaxed)) {
+                for (uint32_t i = 0; i < count; ++i) {
+                    Slot& slot = slots_[(pos + i) & MASK];
+                    slot.value = values[i];
+                    slot.sequence.store(pos + i + 1, std::memory_order_release);
+                }
+                return count;
+            }
+        }
+    }
+
+    /**
+     * @brief 複数要素をまとめて取り出し
+     *
+     * 先頭から連続して格納済みのスロットを1回のCASでまとめて確保する。
+     *
+     * @return 取り出した要素数（空の場合0）
+     */
+    uint32_t pop(span<T> out) noexcept {
+        const auto requested = static_cast<uint32_t>(out.size());
+        if (requested == 0) {
+            return 0;
+        }
+
+        uint32_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+
+        for (;;) {
+            const uint32_t count = count_ready(pos, 1, requested);
+
+            if (count == 0) {
+                const uint32_t current = dequeue_pos_.load(std::memory_order_relaxed);
+                if (current == pos) {
+                    return 0; // 空
+                }
+                pos = current;
+                continue;
+            }
+
+            if (dequeue_pos_.compare_exchange_weak(pos, pos + count, std::memory_order_relaxed)) {
+                for (uint32_t i = 0; i < count; ++i) {
+                    Slot& slot = slots_[(pos + i) & MASK];
+                    out[i] = slot.value;
+                    slot.sequence.store(pos + i + N, std::memory_order_release);
+                }
+                return count;
+            }
+        }
+    }
+
+private:
+    static constexpr uint32_t MASK = N - 1;
+
+    struct Slot {
+        std::atomic<uint32_t> sequence;
+        T value {};
+    };
+
+    /**
+     * @brief pos から連続して操作可能なスロット数を数える
+     *
+     * スロットのシーケンス番号が pos + i + offset と一致すれば操作可能
+     * （生産者: offset = 0 で空き、消費者: offset = 1 で格納済み）。
+     */
+    uint32_t count_ready(uint32_t pos, uint32_t offset, uint32_t limit) const noexcept {
+        uint32_t count = 0;
+
+        while (count < limit && count < N) {
+            const uint32_t sequence = slots_[(pos + count) & MASK].sequence.load(std::memory_order_acquire);
+            if (sequence != pos + count + offset) {
+                break;
+            }
+            ++count;
+        }
+
+        return count;
+    }
+
+    Slot slots_[N];
+    alignas(CACHE_LINE_SIZE) std::atomic<uint32_t> enqueue_pos_ {0};
+    alignas(CACHE_LINE_SIZE) std::atomic<uint32_t> dequeue_pos_ {0};
+    char padding_[CACHE_LINE_SIZE - sizeof(std::atomic<uint32_t>)] {};
+};
+
+} // namespace omusubi
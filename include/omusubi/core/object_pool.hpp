@@ -0,0 +1,430 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+namespace omusubi {
+
+/**
+ * @brief オブジェクトプールの統計情報
+ */
+struct ObjectPoolStats {
+    uint32_t capacity;           ///< 総スロット数
+    uint32_t in_use;             ///< 使用中のスロット数
+    uint32_t high_water_mark;    ///< 使用中スロット数の最大値
+    uint32_t total_allocations;  ///< 確保に成功した回数
+    uint32_t failed_allocations; ///< 満杯で確保に失敗した回数
+};
+
+/**
+ * @brief プールから確保したオブジェクトの所有ハンドル（RAII）
+ *
+ * スコープを抜けると、オブジェクトを破棄してプールへ返却する。
+ * scope_exit と同様に release() で所有権を手放すと、自動返却は行わない。
+ *
+ * @tparam Pool ObjectPool<T, N> または LockFreeObjectPool<T, N>
+ */
+template <typename Pool>
+class PoolHandle {
+public:
+    using value_type = typename Pool::value_type;
+
+    /**
+     * @brief 空のハンドルを構築
+     */
+    constexpr PoolHandle() noexcept : pool_(nullptr), object_(nullptr) {}
+
+    /**
+     * @brief 確保済みオブジェクトの所有権を引き受けて構築
+     */
+    PoolHandle(Pool* pool, value_type* object) noexcept : pool_(pool), object_(object) {}
+
+    ~PoolHandle() noexcept { reset(); }
+
+    PoolHandle(const PoolHandle&) = delete;
+    PoolHandle& operator=(const PoolHandle&) = delete;
+
+    /**
+     * @brief ムーブコンストラクタ
+     */
+    PoolHandle(PoolHandle&& other) noexcept : pool_(other.pool_), object_(other.object_) { other.object_ = nullptr; }
+
+    /**
+     * @brief ムーブ代入
+     */
+    PoolHandle& operator=(PoolHandle&& other) noexcept {
+        if (this != &other) {
+            reset();
+            pool_ = other.pool_;
+            object_ = other.object_;
+            other.object_ = nullptr;
+        }
+        return *this;
+    }
+
+    /**
+     * @brief オブジェクトへのポインタを取得
+     */
+    [[nodiscard]] value_type* get() const noexcept { return object_; }
+
+    value_type* operator->() const noexcept { return object_; }
+
+    value_type& operator*() const noexcept { return *object_; }
+
+    /**
+     * @brief オブジェクトを保持しているか判定
+     */
+    [[nodiscard]] explicit operator bool() const noexcept { return object_ != nullptr; }
+
+    /**
+     * @brief 所有権を手放す（自動返却を行わない）
+     *
+     * @return オブジェクトへのポインタ（以後は Pool::destroy() で返却すること）
+     */
+    value_type* release() noexcept {
+        value_type* object = object_;
+        object_ = nullptr;
+        return object;
+    }
+
+    /**
+     * @brief オブジェクトを破棄してプールへ返却
+     */
+    void reset() noexcept {
+        if (object_ != nullptr) {
+            pool_->destroy(object_);
+            object_ = nullptr;
+        }
+    }
+
+private:
+    Pool* pool_;
+    value_type* object_;
+};
+
+/**
+ * @brief 固定長オブジェクトプール
+ *
+ * 最大 N 個の T を静的に確保し、O(1) で生成・破棄する。
+ * 空きスロットは、スロット自身の領域に次の空きスロットへのポインタを格納する
+ * 侵入型フリーリストで管理するため、管理用の追加メモリは不要。
+ *
+ * @tparam T オブジェクトの型
+ * @tparam N 最大オブジェクト数
+ *
+ * @note スレッドセーフではない。複数スレッドから使用する場合は LockFreeObjectPool を使用すること。
+ *
+ * @par 使用例
+ * @code
+ * static ObjectPool<Session, 8> sessions;
+ *
+ * auto session = sessions.make(peer_address);  // PoolHandle
+ * if (!session) {
+ *     return Error::BUFFER_FULL;
+ * }
+ * session->start();
+ * // スコープ終了時に自動で破棄・返却される
+ * @endcode
+ */
+template <typename T, uint32_t N>
+class ObjectPool {
+    static_assert(N > 0, "ObjectPool capacity must be greater than 0");
+
+public:
+    using value_type = T;
+    using Handle = PoolHandle<ObjectPool>;
+
+    ObjectPool() noexcept {
+        for (uint32_t i = 0; i + 1 < N; ++i) {
+            slots_[i].next = &slots_[i + 1];
+        }
+        slots_[N - 1].next = nullptr;
+        free_list_ = &slots_[0];
+    }
+
+    ~ObjectPool() noexcept = default;
+    ObjectPool(const ObjectPool&) = delete;
+    ObjectPool& operator=(const ObjectPool&) = delete;
+    ObjectPool(ObjectPool&&) = delete;
+    ObjectPool& operator=(ObjectPool&&) = delete;
+
+    /**
+     * @brief 容量を取得
+     */
+    [[nodiscard]] static constexpr uint32_t capacity() noexcept { return N; }
+
+    /**
+     * @brief 使用中のオブジェクト数を取得
+     */
+    [[nodiscard]] uint32_t size() const noexcept { return in_use_; }
+
+    /**
+     * @brief 空きスロット数を取得
+     */
+    [[nodiscard]] uint32_t available() const noexcept { return N - in_use_; }
+
+    /**
+     * @brief オブジェクトを生成
+     *
+     * @return 生成したオブジェクト（満杯の場合nullptr）
+     */
+    template <typename... Args>
+    [[nodiscard]] T* create(Args&&... args) noexcept {
+        Slot* slot = free_list_;
+        if (slot == nullptr) {
+            ++failed_allocations_;
+            return nullptr;
+        }
+
+        free_list_ = slot->next;
+        ++in_use_;
+        ++total_allocations_;
+        if (in_use_ > high_water_mark_) {
+            high_water_mark_ = in_use_;
+        }
+
+        return new (slot->storage) T(static_cast<Args&&>(args)...);
+    }
+
+    /**
+     * @brief オブジェクトを生成してハンドルで返す
+     *
+     * @return 所有ハンドル（満杯の場合は空のハンドル）
+     */
+    template <typename... Args>
+    [[nodiscard]] Handle make(Args&&... args) noexcept {
+        return Handle(this, create(static_cast<Args&&>(args)...));
+    }
+
+    /**
+     * @brief オブジェクトを破棄してスロットを返却
+     *
+     * @param object create() で生成したオブジェクト（nullptrは無視）
+     */
+    void destroy(T* object) noexcept {
+        if (object == nullptr) {
+            return;
+        }
+
+        object->~T();
+
+        Slot* slot = reinterpret_cast<Slot*>(object);
+        slot->next = free_list_;
+        free_list_ = slot;
+        --in_use_;
+    }
+
+    /**
+     * @brief このプールのスロットを指すポインタか判定
+     */
+    [[nodiscard]] bool owns(const T* object) const noexcept {
+        const auto* ptr = reinterpret_cast<const unsigned char*>(object);
+        const auto* begin = reinterpret_cast<const unsigned char*>(slots_);
+        const auto* end = reinterpret_cast<const unsigned char*>(slots_ + N);
+
+        return ptr >= begin && ptr < end && (static_cast<size_t>(ptr - begin) % sizeof(Slot)) == 0;
+    }
+
+    /**
+     * @brief 統計情報を取得
+     */
+    [[nodiscard]] ObjectPoolStats get_stats() const noexcept { return ObjectPoolStats {N, in_use_, high_water_mark_, total_allocations_, failed_allocations_}; }
+
+    /**
+     * @brief 最大使用数と確保回数をリセット（使用中の数は維持）
+     */
+    void reset_stats() noexcept {
+        high_water_mark_ = in_use_;
+        total_allocations_ = 0;
+        failed_allocations_ = 0;
+    }
+
+private:
+    union Slot {
+        Slot* next;
+        alignas(T) unsigned char storage[sizeof(T)];
+    };
+
+    Slot slots_[N];
+    Slot* free_list_ = nullptr;
+    uint32_t in_use_ = 0;
+    uint32_t high_water_mark_ = 0;
+    uint32_t total_allocations_ = 0;
+    uint32_t failed_allocations_ = 0;
+};
+
+/**
+ * @brief スレッドセーフな固定長オブジェクトプール（ロックフリー）
+ *
+ * ObjectPool と同じインターフェースを、複数スレッドから同時に使用できるようにしたもの。
+ * 空きスロットはタグ付きインデックスのスタック（Treiberスタック）で管理し、
+ * 16ビットのタグでABA問題を回避する。
+ *
+ * @tparam T オブジェクトの型
+ * @tparam N 最大オブジェクト数（65535未満）
+ *
+ * @note 次の空きスロットのインデックスはスロットの外に持つ
+ *       （確保直後のオブジェクト領域を他スレッドが読まないようにするため）。
+ */
+template <typename T, uint32_t N>
+class LockFreeObjectPool {
+    static_assert(N > 0 && N < 0xFFFF, "LockFreeObjectPool capacity must be in [1, 65534]");
+
+public:
+    using value_type = T;
+    using Handle = PoolHandle<LockFreeObjectPool>;
+
+    LockFreeObjectPool() noexcept {
+        for (uint32_t i = 0; i < N; ++i) {
+            next_[i].store(static_cast<uint16_t>((i + 1 < N) ? i + 1 : NIL), std::memory_order_relaxed);
+        }
+        head_.store(0, std::memory_order_relaxed);
+    }
+
+    ~LockFreeObjectPool() noexcept = default;
+    LockFreeObjectPool(const LockFreeObjectPool&) = delete;
+    LockFreeObjectPool& operator=(const LockFreeObjectPool&) = delete;
+    LockFreeObjectPool(LockFreeObjectPool&&) = delete;
+    LockFreeObjectPool& operator=(LockFreeObjectPool&&) = delete;
+
+    /**
+     * @brief 容量を取得
+     */
+    [[nodiscard]] static constexpr uint32_t capacity() noexcept { return N; }
+
+    /**
+     * @brief 使用中のオブジェクト数を取得
+     */
+    [[nodiscard]] uint32_t size() const noexcept { return in_use_.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief 空きスロット数を取得
+     */
+    [[nodiscard]] uint32_t available() const noexcept { return N - size(); }
+
+    /**
+     * @brief オブジェクトを生成
+     *
+     * @return 生成したオブジェクト（満杯の場合nullptr）
+     */
+    template <typename... Args>
+    [[nodiscard]] T* create(Args&&... args) noexcept {
+        uint32_t head = head_.load(std::memory_order_acquire);
+
+        for (;;) {
+            const uint32_t index = head & INDEX_MASK;
+            if (index == NIL) {
+                failed_allocations_.fetch_add(1, std::memory_order_relaxed);
+                return nullptr;
+            }
+
+            const uint32_t next = next_[index].load(std::memory_order_relaxed);
+            const uint32_t tag = (head >> 16) + 1;
+
+            if (head_.compare_exchange_weak(head, (tag << 16) | next, std::memory_order_acquire, std::memory_order_acquire)) {
+                update_usage();
+                return new (storage_[index].bytes) T(static_cast<Args&&>(args)...);
+            }
+        }
+    }
+
+    /**
+     * @brief オブジェクトを生成してハンドルで返す
+     *
+     * @return 所有ハンドル（満杯の場合は空のハンドル）
+     */
+    template <typename... Args>
+    [[nodiscard]] Handle make(Args&&... args) noexcept {
+        return Handle(this, create(static_cast<Args&&>(args)...));
+    }
+
+    /**
+     * @brief オブジェクトを破棄してスロットを返却
+     *
+     * @param object create() で生成したオブジェクト（nullptrは無視）
+     */
+    void destroy(T* object) noexcept {
+        if (object == nullptr) {
+            return;
+        }
+
+        object->~T();
+
+        // スロットを返却する前に減らす（返却直後に他スレッドが確保しても容量を超えて数えない）
+        in_use_.fetch_sub(1, std::memory_order_relaxed);
+
+        const auto index = static_cast<uint32_t>(reinterpret_cast<Storage*>(object) - storage_);
+        uint32_t head = head_.load(std::memory_order_relaxed);
+
+        for (;;) {
+            next_[index].store(static_cast<uint16_t>(head & INDEX_MASK), std::memory_order_relaxed);
+            const uint32_t tag = (head >> 16) + 1;
+
+            if (head_.compare_exchange_weak(head, (tag << 16) | index, std::memory_order_release, std::memory_order_relaxed)) {
+                break;
+            }
+        }
+    }
+
+    /**
+     * @brief このプールのスロットを指すポインタか判定
+     */
+    [[nodiscard]] bool owns(const T* object) const noexcept {
+        const auto* ptr = reinterpret_cast<const unsigned char*>(object);
+        const auto* begin = reinterpret_cast<const unsigned char*>(storage_);
+        const auto* end = reinterpret_cast<const unsigned char*>(storage_ + N);
+
+        return ptr >= begin && ptr < end && (static_cast<size_t>(ptr - begin) % sizeof(Storage)) == 0;
+    }
+
+    /**
+     * @brief 統計情報を取得
+     *
+     * 各値は個別に読み取るため、他スレッドが操作中の場合は相互に一貫しないことがある。
+     */
+    [[nodiscard]] ObjectPoolStats get_stats() const noexcept {
+        return ObjectPoolStats {N,
+                                in_use_.load(std::memory_order_relaxed),
+                                high_water_mark_.load(std::memory_order_relaxed),
+                                total_allocations_.load(std::memory_order_relaxed),
+                                failed_allocations_.load(std::memory_order_relaxed)};
+    }
+
+    /**
+     * @brief 最大使用数と確保回数をリセット（使用中の数は維持）
+     */
+    void reset_stats() noexcept {
+        high_water_mark_.store(in_use_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        total_allocations_.store(0, std::memory_order_relaxed);
+        failed_allocations_.store(0, std::memory_order_relaxed);
+    }
+
+private:
+    static constexpr uint32_t INDEX_MASK = 0xFFFF;
+    static constexpr uint32_t NIL = 0xFFFF;
+
+    struct Storage {
+        alignas(T) unsigned char bytes[sizeof(T)];
+    };
+
+    void update_usage() noexcept {
+        const uint32_t in_use = in_use_.fetch_add(1, std::memory_order_relaxed) + 1;
+        total_allocations_.fetch_add(1, std::memory_order_relaxed);
+
+        uint32_t peak = high_water_mark_.load(std::memory_order_relaxed);
+        while (in_use > peak && !high_water_mark_.compare_exchange_weak(peak, in_use, std::memory_order_relaxed)) {
+        }
+    }
+
+    Storage storage_[N];
+    std::atomic<uint16_t> next_[N];
+    std::atomic<uint32_t> head_ {NIL}; ///< 上位16ビット: タグ、下位16ビット: 先頭の空きスロット
+    std::atomic<uint32_t> in_use_ {0};
+    std::atomic<uint32_t> high_water_mark_ {0};
+    std::atomic<uint32_t> total_allocations_ {0};
+    std::atomic<uint32_t> failed_allocations_ {0};
+};
+
+} // namespace omusubi
@@ -0,0 +1,371 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <omusubi/core/result.hpp>
+#include <omusubi/core/span.hpp>
+#include <omusubi/core/types.h>
+#include <type_traits>
+
+namespace omusubi {
+
+/**
+ * @brief ワイヤ上のバイト順
+ */
+enum class ByteOrder : uint8_t {
+    LITTLE, ///< リトルエンディアン（BLE、USB、多くのMCU）
+    BIG     ///< ビッグエンディアン（ネットワークバイトオーダー）
+};
+
+/**
+ * @brief 直列化するフィールド（メンバポインタ）の並び
+ *
+ * @tparam Members メンバポインタ（ワイヤ上の順）
+ */
+template <auto... Members>
+struct FieldList {};
+
+/**
+ * @brief 構造体のフィールド記述子
+ *
+ * PackedCodec で直列化する構造体ごとに特殊化し、FieldList を継承する。
+ *
+ * @code
+ * struct SensorPacket {
+ *     uint16_t id;
+ *     int32_t temperature;
+ *     Vector3 accel;
+ *     uint8_t flags[2];
+ * };
+ *
+ * template <>
+ * struct StructFields<SensorPacket> : FieldList<&SensorPacket::id, &SensorPacket::temperature, &SensorPacket::accel, &SensorPacket::flags> {};
+ * @endcode
+ */
+template <typename T>
+struct StructFields;
+
+/**
+ * @brief Vector3 のフィールド記述子（x, y, z）
+ */
+template <>
+struct StructFields<Vector3> : FieldList<&Vector3::x, &Vector3::y, &Vector3::z> {};
+
+namespace detail {
+
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+inline constexpr bool HOST_BYTE_ORDER_KNOWN = true;
+inline constexpr ByteOrder HOST_BYTE_ORDER = ByteOrder::LITTLE;
+#elif defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+inline constexpr bool HOST_BYTE_ORDER_KNOWN = true;
+inline constexpr ByteOrder HOST_BYTE_ORDER = ByteOrder::BIG;
+#else
+inline constexpr bool HOST_BYTE_ORDER_KNOWN = false;
+inline constexpr ByteOrder HOST_BYTE_ORDER = ByteOrder::LITTLE;
+#endif
+
+/**
+ * @brief メンバポインタからクラスとメンバの型を取り出す
+ */
+template <auto Member>
+struct MemberTraits;
+
+template <typename C, typename F, F C::*Member>
+struct MemberTraits<Member> {
+    using Class = C;
+    using Type = F;
+};
+
+template <typename T, typename = void>
+struct HasStructFields : std::false_type {};
+
+template <typename T>
+struct HasStructFields<T, std::void_t<decltype(sizeof(StructFields<T>))>> : std::true_type {};
+
+/**
+ * @brief ワイヤ上でそのまま整数・浮動小数点数として符号化する型
+ */
+template <typename F>
+inline constexpr bool IS_PACKED_SCALAR = std::is_integral_v<F> || std::is_enum_v<F> || std::is_floating_point_v<F>;
+
+/**
+ * @brief スカラーと同じ大きさの符号なし整数型
+ */
+template <size_t Size>
+struct UnsignedOfSize;
+
+template <>
+struct UnsignedOfSize<1> {
+    using type = uint8_t;
+};
+
+template <>
+struct UnsignedOfSize<2> {
+    using type = uint16_t;
+};
+
+template <>
+struct UnsignedOfSize<4> {
+    using type = uint32_t;
+};
+
+template <>
+struct UnsignedOfSize<8> {
+    using type = uint64_t;
+};
+
+/**
+ * @brief 型ごとの直列化（スカラー・配列・StructFields を持つ構造体）
+ */
+template <typename F, ByteOrder Order, typename = void>
+struct PackedType {
+    static_assert(sizeof(F) == 0, "PackedCodec: field type needs a StructFields specialization");
+};
+
+/**
+ * @brief スカラー（整数・bool・列挙型・浮動小数点数）
+ */
+template <typename F, ByteOrder Order>
+struct PackedType<F, Order, std::enable_if_t<IS_PACKED_SCALAR<F>>> {
+    static_assert(!std::is_floating_point_v<F> || std::numeric_limits<F>::is_iec559, "PackedCodec: floating point must be IEEE 754");
+
+    using Bits = typename UnsignedOfSize<sizeof(F)>::type;
+
+    static constexpr uint32_t SIZE = sizeof(F);
+
+    /** @brief ホストのメモリ表現がワイヤ上の表現と同じか（bool は 0/1 以外の入力を許すため除く） */
+    static constexpr bool BULK_COPYABLE = !std::is_same_v<F, bool> && HOST_BYTE_ORDER_KNOWN && (SIZE == 1 || Order == HOST_BYTE_ORDER);
+
+    static void encode(const F& value, uint8_t* out) noexcept {
+        Bits bits = 0;
+        if constexpr (std::is_same_v<F, bool>) {
+            bits = value ? 1 : 0;
+        } else {
+            std::memcpy(&bits, &value, SIZE);
+        }
+
+        if constexpr (HOST_BYTE_ORDER_KNOWN && (SIZE == 1 || Order == HOST_BYTE_ORDER)) {
+            std::memcpy(out, &bits, SIZE);
+        } else {
+            for (uint32_t i = 0; i < SIZE; ++i) {
+                const uint32_t shift = (Order == ByteOrder::LITTLE) ? (8 * i) : (8 * (SIZE - 1 - i));
+                out[i] = static_cast<uint8_t>(bits >> shift);
+            }
+        }
+    }
+
+    static void decode(F& value, const uint8_t* in) noexcept {
+        Bits bits = 0;
+        if constexpr (HOST_BYTE_ORDER_KNOWN && (SIZE == 1 || Order == HOST_BYTE_ORDER)) {
+            std::memcpy(&bits, in, SIZE);
+        } else {
+            for (uint32_t i = 0; i < SIZE; ++i) {
+                const uint32_t shift = (Order == ByteOrder::LITTLE) ? (8 * i) : (8 * (SIZE - 1 - i));
+                bits = static_cast<Bits>(bits | (static_cast<Bits>(in[i]) << shift));
+            }
+        }
+
+        if constexpr (std::is_same_v<F, bool>) {
+            value = (bits != 0);
+        } else {
+            std::memcpy(&value, &bits, SIZE);
+        }
+    }
+
+    static bool layout_matches(const F& /*value*/) noexcept { return BULK_COPYABLE; }
+};
+
+/**
+ * @brief 配列（要素を順に詰める）
+ */
+template <typename E, size_t N, ByteOrder Order>
+struct PackedType<E[N], Order> {
+    using Element = PackedType<E, Order>;
+
+    static constexpr uint32_t SIZE = Element::SIZE * static_cast<uint32_t>(N);
+
+    static constexpr bool BULK_COPYABLE = Element::BULK_COPYABLE;
+
+    static void encode(const E (&value)[N], uint8_t* out) noexcept {
+        for (size_t i = 0; i < N; ++i) {
+            Element::encode(value[i], out + (i * Element::SIZE));
+        }
+    }
+
+    static void decode(E (&value)[N], const uint8_t* in) noexcept {
+        for (size_t i = 0; i < N; ++i) {
+            Element::decode(value[i], in + (i * Element::SIZE));
+        }
+    }
+
+    static bool layout_matches(const E (&value)[N]) noexcept { return BULK_COPYABLE && Element::layout_matches(value[0]); }
+};
+
+/**
+ * @brief StructFields を持つ構造体（フィールドを記述子の順に詰める）
+ */
+template <typename T, ByteOrder Order>
+struct PackedType<T, Order, std::enable_if_t<!IS_PACKED_SCALAR<T> && HasStructFields<T>::value>> {
+    template <auto Member>
+    using Field = PackedType<typename MemberTraits<Member>::Type, Order>;
+
+    template <auto... Members>
+    static constexpr uint32_t size_of(FieldList<Members...> /*fields*/) noexcept {
+        return (Field<Members>::SIZE + ... + 0U);
+    }
+
+    template <auto... Members>
+    static constexpr bool bulk_copyable(FieldList<Members...> /*fields*/) noexcept {
+        return (Field<Members>::BULK_COPYABLE && ... && true);
+    }
+
+    static constexpr uint32_t SIZE = size_of(StructFields<T> {});
+
+    /** @brief 詰め物がなく、全フィールドがそのままコピーできる（フィールドの順序は layout_matches() で確認する） */
+    static constexpr bool BULK_COPYABLE = std::is_trivially_copyable_v<T> && SIZE == sizeof(T) && bulk_copyable(StructFields<T> {});
+
+    static void encode(const T& value, uint8_t* out) noexcept { encode_fields(value, out, StructFields<T> {}); }
+
+    static void decode(T& value, const uint8_t* in) noexcept { decode_fields(value, in, StructFields<T> {}); }
+
+    /**
+     * @brief メモリ上の配置がワイヤ上の配置と一致するか
+     *
+     * 各フィールドのオフセットが記述子の順に詰めた位置と一致することを確認する。
+     * オフセットは定数なので、最適化により定数に畳み込まれる。
+     */
+    static bool layout_matches(const T& value) noexcept {
+        if constexpr (BULK_COPYABLE) {
+            return offsets_match(value, StructFields<T> {});
+        } else {
+            return false;
+        }
+    }
+
+private:
+    template <auto... Members>
+    static void encode_fields(const T& value, uint8_t* out, FieldList<Members...> /*fields*/) noexcept {
+        uint32_t offset = 0;
+        ((Field<Members>::encode(value.*Members, out + offset), offset += Field<Members>::SIZE), ...);
+    }
+
+    template <auto... Members>
+    static void decode_fields(T& value, const uint8_t* in, FieldList<Members...> /*fields*/) noexcept {
+        uint32_t offset = 0;
+        ((Field<Members>::decode(value.*Members, in + offset), offset += Field<Members>::SIZE), ...);
+    }
+
+    template <auto Member>
+    static bool field_at(const T& value, uint32_t& offset) noexcept {
+        const auto* base = reinterpret_cast<const unsigned char*>(&value);
+        const auto* field = reinterpret_cast<const unsigned char*>(&(value.*Member));
+        const bool matches = (field - base) == static_cast<std::ptrdiff_t>(offset) && Field<Member>::layout_matches(value.*Member);
+        offset += Field<Member>::SIZE;
+        return matches;
+    }
+
+    template <auto... Members>
+    static bool offsets_match(const T& value, FieldList<Members...> /*fields*/) noexcept {
+        uint32_t offset = 0;
+        return (field_at<Members>(value, offset) && ... && true);
+    }
+};
+
+} // namespace detail
+
+/**
+ * @brief 固定レイアウトの構造体をバイト列へ詰めて直列化する
+ *
+ * StructFields<T> に並べたフィールドを、詰め物なし・指定したバイト順で符号化・復号する。
+ * センサーパケットや BLE キャラクタリスティックの値のような固定長メッセージ向け。
+ *
+ * - 対応するフィールドの型: 整数・bool（1バイト）・列挙型（基底型）・float / double（IEEE 754）・
+ *   それらの配列・StructFields を持つ構造体（入れ子）
+ * - 符号化後のサイズ SIZE はコンパイル時定数
+ * - 構造体に詰め物がなく、フィールドが宣言順でワイヤと同じバイト順の場合は、構造体全体を memcpy する
+ *   （is_bulk_copy()）。それ以外はフィールドごとにバイト順を変換する
+ *
+ * @tparam T 構造体の型（StructFields<T> の特殊化が必要）
+ * @tparam Order ワイヤ上のバイト順
+ *
+ * @par 使用例
+ * @code
+ * using PacketCodec = PackedCodec<SensorPacket, ByteOrder::LITTLE>;
+ *
+ * uint8_t payload[PacketCodec::SIZE];
+ * PacketCodec::encode(packet, span<uint8_t>(payload));
+ * characteristic->write(span<const uint8_t>(payload));
+ *
+ * auto received = PacketCodec::decode(span<const uint8_t>(rx, n));  // 短い入力は Error::BUFFER_EMPTY
+ * @endcode
+ */
+template <typename T, ByteOrder Order = ByteOrder::LITTLE>
+class PackedCodec {
+    using Type = detail::PackedType<T, Order>;
+
+public:
+    /** @brief 符号化後のバイト数 */
+    static constexpr uint32_t SIZE = Type::SIZE;
+
+    /**
+     * @brief 構造体全体を memcpy で符号化・復号できるか
+     */
+    [[nodiscard]] static bool is_bulk_copy(const T& value = T {}) noexcept { return Type::layout_matches(value); }
+
+    /**
+     * @brief 符号化
+     *
+     * @return 書き込んだバイト数（SIZE。出力が短い場合 Error::BUFFER_FULL）
+     */
+    [[nodiscard]] static Result<uint32_t> encode(const T& value, span<uint8_t> out) noexcept {
+        if (out.size() < SIZE) {
+            return Result<uint32_t>::err(Error::BUFFER_FULL);
+        }
+
+        if constexpr (Type::BULK_COPYABLE) {
+            if (Type::layout_matches(value)) {
+                std::memcpy(out.data(), &value, SIZE);
+                return Result<uint32_t>::ok(SIZE);
+            }
+        }
+        Type::encode(value, out.data());
+        return Result<uint32_t>::ok(SIZE);
+    }
+
+    /**
+     * @brief 既存のオブジェクトへ復号
+     *
+     * @return 読み込んだバイト数（SIZE。入力が短い場合 Error::BUFFER_EMPTY）
+     */
+    [[nodiscard]] static Result<uint32_t> decode(span<const uint8_t> in, T& out) noexcept {
+        if (in.size() < SIZE) {
+            return Result<uint32_t>::err(Error::BUFFER_EMPTY);
+        }
+
+        if constexpr (Type::BULK_COPYABLE) {
+            if (Type::layout_matches(out)) {
+                std::memcpy(&out, in.data(), SIZE);
+                return Result<uint32_t>::ok(SIZE);
+            }
+        }
+        Type::decode(out, in.data());
+        return Result<uint32_t>::ok(SIZE);
+    }
+
+    /**
+     * @brief 復号
+     *
+     * @return 復号した値（入力が短い場合 Error::BUFFER_EMPTY）
+     */
+    [[nodiscard]] static Result<T> decode(span<const uint8_t> in) noexcept {
+        T value {};
+        const Result<uint32_t> read = decode(in, value);
+        if (read.is_err()) {
+            return Result<T>::err(read.error());
+        }
+        return Result<T>::ok(value);
+    }
+};
+
+} // namespace omusubi
@@ -0,0 +1,852 @@
+#pragma once
+
+/**
+ * @file parse.hpp
+ * @brief 動的メモリ確保なしの数値パース
+ *
+ * std::string_view から整数・浮動小数点数を読み取る。
+ * strtol / strtof と異なり、ロケールに依存せず、errnoも使用しない。
+ *
+ * - 整数: 8桁単位のSWAR（SIMD within a register）で変換
+ * - 浮動小数点数: Clingerの高速パス → Eisel-Lemire → 多倍長比較の3段構成で、
+ *   常に最近接偶数丸め（IEEE 754）の結果を返す
+ *
+ * 書式（文字列全体が一致する必要がある。前後の空白は受け付けない）:
+ * - 整数: [+-]?[0-9]+
+ * - 浮動小数点数: [+-]?([0-9]+(\.[0-9]*)?|\.[0-9]+)([eE][+-]?[0-9]+)? または inf / infinity / nan（大文字小文字を区別しない）
+ *
+ * 書式不正・範囲外はいずれも Error::INVALID_DATA を返す。
+ * 浮動小数点数のアンダーフローは0（または非正規化数）に丸められ、エラーにはならない。
+ */
+
+#include <cassert>
+#include <cfloat>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <omusubi/core/power_of_five_table.hpp>
+#include <omusubi/core/result.hpp>
+#include <string_view>
+#include <type_traits>
+
+namespace omusubi::detail {
+
+// ========================================
+// 共通ヘルパー
+// ========================================
+
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+inline constexpr bool SWAR_PARSE_ENABLED = true;
+#else
+inline constexpr bool SWAR_PARSE_ENABLED = false;
+#endif
+
+#if defined(FLT_EVAL_METHOD) && (FLT_EVAL_METHOD == 0)
+inline constexpr bool CLINGER_FAST_PATH_ENABLED = true;
+#else
+inline constexpr bool CLINGER_FAST_PATH_ENABLED = false;
+#endif
+
+/**
+ * @brief 10進数字か判定
+ */
+[[nodiscard]] constexpr bool is_digit(char c) noexcept {
+    return static_cast<uint8_t>(c - '0') < 10;
+}
+
+/**
+ * @brief 8バイトをリトルエンディアンの64bit整数として読み込む
+ */
+[[nodiscard]] inline uint64_t load_u64(const char* p) noexcept {
+    uint64_t value = 0;
+    std::memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+/**
+ * @brief 8バイトがすべて10進数字か判定（SWAR）
+ */
+[[nodiscard]] constexpr bool is_eight_digits(uint64_t chunk) noexcept {
+    return ((chunk & 0xF0F0F0F0F0F0F0F0U) | (((chunk + 0x0606060606060606U) & 0xF0F0F0F0F0F0F0F0U) >> 4)) == 0x3333333333333333U;
+}
+
+/**
+ * @brief 8桁の10進数字を整数に変換（SWAR）
+ *
+ * 隣接する桁を2桁→4桁→8桁とまとめることで、乗算3回で変換する。
+ * 先頭の文字が最下位バイトにあること（リトルエンディアン）が前提。
+ */
+[[nodiscard]] constexpr uint32_t parse_eight_digits(uint64_t chunk) noexcept {
+    constexpr uint64_t MASK = 0x000000FF000000FFU;
+    constexpr uint64_t MUL1 = 0x000F424000000064U; // 100 + (1000000 << 32)
+    constexpr uint64_t MUL2 = 0x0000271000000001U; // 1 + (10000 << 32)
+
+    chunk -= 0x3030303030303030U;
+    chunk = (chunk * 10) + (chunk >> 8);
+    chunk = (((chunk & MASK) * MUL1) + (((chunk >> 16) & MASK) * MUL2)) >> 32;
+
+    return static_cast<uint32_t>(chunk);
+}
+
+/**
+ * @brief value = value * Scale + digits をオーバーフロー検出付きで計算
+ * @return オーバーフローした場合false
+ */
+template <typename Acc, Acc Scale>
+[[nodiscard]] constexpr bool accumulate_digits(Acc& value, Acc digits) noexcept {
+    constexpr Acc LIMIT = std::numeric_limits<Acc>::max() / Scale;
+    constexpr Acc LIMIT_DIGITS = std::numeric_limits<Acc>::max() % Scale;
+
+    if (value > LIMIT || (value == LIMIT && digits > LIMIT_DIGITS)) {
+        return false;
+    }
+
+    value = value * Scale + digits;
+    return true;
+}
+
+/**
+ * @brief 大文字小文字を区別せずに前方一致を判定
+ */
+[[nodiscard]] constexpr bool starts_with_ignore_case(const char* p, const char* end, std::string_view lower) noexcept {
+    if (static_cast<size_t>(end - p) < lower.size()) {
+        return false;
+    }
+
+    for (size_t i = 0; i < lower.size(); ++i) {
+        if ((p[i] | 0x20) != lower[i]) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// ========================================
+// 整数
+// ========================================
+
+/**
+ * @brief 整数パース実装
+ */
+template <typename T>
+[[nodiscard]] Result<T> parse_integer(std::string_view str) noexcept {
+    // 32bit以下の型は32bitで累積（32bit MCUで64bit演算を避ける）
+    using Acc = std::conditional_t<(sizeof(T) <= sizeof(uint32_t)), uint32_t, uint64_t>;
+
+    const char* p = str.data();
+    const char* const end = p + str.size();
+    bool negative = false;
+
+    if (p != end && (*p == '-' || *p == '+')) {
+        negative = (*p == '-');
+        ++p;
+    }
+
+    if (p == end) {
+        return Result<T>::err(Error::INVALID_DATA);
+    }
+
+    if constexpr (!std::is_signed_v<T>) {
+        if (negative) {
+            return Result<T>::err(Error::INVALID_DATA);
+        }
+    }
+
+    Acc value = 0;
+
+    if constexpr (SWAR_PARSE_ENABLED) {
+        while (end - p >= 8) {
+            const uint64_t chunk = load_u64(p);
+
+            if (!is_eight_digits(chunk)) {
+                break;
+            }
+
+            if (!accumulate_digits<Acc, 100000000>(value, parse_eight_digits(chunk))) {
+                return Result<T>::err(Error::INVALID_DATA);
+            }
+
+            p += 8;
+        }
+    }
+
+    while (p != end) {
+        const auto digit = static_cast<uint8_t>(*p - '0');
+
+        if (digit > 9 || !accumulate_digits<Acc, 10>(value, digit)) {
+            return Result<T>::err(Error::INVALID_DATA);
+        }
+
+        ++p;
+    }
+
+    constexpr auto MAX_POSITIVE = static_cast<Acc>(std::numeric_limits<T>::max());
+
+    if constexpr (std::is_signed_v<T>) {
+        if (negative) {
+            if (value > MAX_POSITIVE + 1) {
+                return Result<T>::err(Error::INVALID_DATA);
+            }
+
+            // 2の補数表現での符号反転（MIN値も正しく変換される）
+            return Result<T>::ok(static_cast<T>(static_cast<Acc>(0) - value));
+        }
+    }
+
+    if (value > MAX_POSITIVE) {
+        return Result<T>::err(Error::INVALID_DATA);
+    }
+
+    return Result<T>::ok(static_cast<T>(value));
+}
+
+// ========================================
+// 浮動小数点数
+// ========================================
+
+/**
+ * @brief IEEE 754 形式ごとのパラメータ
+ */
+template <typename T>
+struct FloatFormat;
+
+template <>
+struct FloatFormat<double> {
+    using Bits = uint64_t;
+    static constexpr int32_t MANTISSA_BITS = 52;
+    static constexpr int32_t MINIMUM_EXPONENT = -1023;
+    static constexpr int32_t INFINITE_POWER = 0x7FF;
+    static constexpr int32_t SMALLEST_POWER_OF_TEN = -342;
+    static constexpr int32_t LARGEST_POWER_OF_TEN = 308;
+    static constexpr int32_t MIN_EXPONENT_ROUND_TO_EVEN = -4;
+    static constexpr int32_t MAX_EXPONENT_ROUND_TO_EVEN = 23;
+    static constexpr int32_t MAX_EXPONENT_FAST_PATH = 22;
+    static constexpr uint64_t MAX_MANTISSA_FAST_PATH = uint64_t {2} << MANTISSA_BITS;
+    static constexpr uint32_t MAX_DIGITS = 769;  ///< 中間値の表現に必要な最大有効桁数 + 2
+    static constexpr uint32_t BIGINT_LIMBS = 96; ///< 多倍長比較に必要な32bitリム数
+
+    static constexpr double POWERS_OF_TEN[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+                                               1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+};
+
+template <>
+struct FloatFormat<float> {
+    using Bits = uint32_t;
+    static constexpr int32_t MANTISSA_BITS = 23;
+    static constexpr int32_t MINIMUM_EXPONENT = -127;
+    static constexpr int32_t INFINITE_POWER = 0xFF;
+    static constexpr int32_t SMALLEST_POWER_OF_TEN = -64;
+    static constexpr int32_t LARGEST_POWER_OF_TEN = 38;
+    static constexpr int32_t MIN_EXPONENT_ROUND_TO_EVEN = -17;
+    static constexpr int32_t MAX_EXPONENT_ROUND_TO_EVEN = 10;
+    static constexpr int32_t MAX_EXPONENT_FAST_PATH = 10;
+    static constexpr uint64_t MAX_MANTISSA_FAST_PATH = uint64_t {2} << MANTISSA_BITS;
+    static constexpr uint32_t MAX_DIGITS = 114;
+    static constexpr uint32_t BIGINT_LIMBS = 20;
+
+    static constexpr float POWERS_OF_TEN[] = {1e0F, 1e1F, 1e2F, 1e3F, 1e4F, 1e5F, 1e6F, 1e7F, 1e8F, 1e9F, 1e10F};
+};
+
+/**
+ * @brief 2進の仮数部と指数部（IEEE 754 のビット表現と同じ区切り）
+ */
+struct AdjustedMantissa {
+    uint64_t mantissa;
+    int32_t power2;
+
+    [[nodiscard]] constexpr bool operator==(const AdjustedMantissa& other) const noexcept { return mantissa == other.mantissa && power2 == other.power2; }
+
+    [[nodiscard]] constexpr bool operator!=(const AdjustedMantissa& other) const noexcept { return !(*this == other); }
+};
+
+/**
+ * @brief 字句解析済みの10進数
+ *
+ * value = mantissa * 10^exponent（too_many_digitsの場合は先頭19桁で切り捨て済み）
+ */
+struct DecimalNumber {
+    uint64_t mantissa;
+    int64_t exponent;
+    int64_t explicit_exponent;
+    const char* integer_begin;
+    const char* integer_end;
+    const char* fraction_begin;
+    const char* fraction_end;
+    bool too_many_digits;
+};
+
+/**
+ * @brief 64bit x 64bit → 128bit 乗算
+ */
+struct Value128 {
+    uint64_t low;
+    uint64_t high;
+};
+
+[[nodiscard]] inline Value128 full_multiplication(uint64_t a, uint64_t b) noexcept {
+#if defined(__SIZEOF_INT128__)
+    __extension__ using uint128_t = unsigned __int128;
+    const uint128_t product = static_cast<uint128_t>(a) * b;
+    return Value128 {static_cast<uint64_t>(product), static_cast<uint64_t>(product >> 64)};
+#else
+    const uint64_t a_lo = a & 0xFFFFFFFFU;
+    const uint64_t a_hi = a >> 32;
+    const uint64_t b_lo = b & 0xFFFFFFFFU;
+    const uint64_t b_hi = b >> 32;
+
+    const uint64_t lo_lo = a_lo * b_lo;
+    const uint64_t hi_lo = a_hi * b_lo;
+    const uint64_t lo_hi = a_lo * b_hi;
+    const uint64_t hi_hi = a_hi * b_hi;
+
+    const uint64_t cross = (lo_lo >> 32) + (hi_lo & 0xFFFFFFFFU) + lo_hi;
+    return Value128 {(cross << 32) | (lo_lo & 0xFFFFFFFFU), (hi_lo >> 32) + (cross >> 32) + hi_hi};
+#endif
+}
+
+/**
+ * @brief 先頭の0ビット数（value != 0）
+ */
+[[nodiscard]] inline int32_t count_leading_zeros(uint64_t value) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_clzll(value);
+#else
+    int32_t count = 0;
+    while ((value & (uint64_t {1} << 63)) == 0) {
+        value <<= 1;
+        ++count;
+    }
+    return count;
+#endif
+}
+
+/**
+ * @brief 10進数字列を字句解析
+ * @return 書式が正しい場合true
+ */
+[[nodiscard]] inline bool parse_decimal(const char* p, const char* end, DecimalNumber& number) noexcept {
+    constexpr uint64_t MIN_19_DIGIT_INTEGER = 1000000000000000000U;
+
+    uint64_t mantissa = 0;
+
+    number.integer_begin = p;
+    while (p != end && is_digit(*p)) {
+        mantissa = mantissa * 10 + static_cast<uint64_t>(*p - '0'); // 桁数超過時のラップは後で再計算
+        ++p;
+    }
+    number.integer_end = p;
+
+    int64_t exponent = 0;
+    number.fraction_begin = p;
+    number.fraction_end = p;
+
+    if (p != end && *p == '.') {
+        ++p;
+        number.fraction_begin = p;
+
+        if constexpr (SWAR_PARSE_ENABLED) {
+            while (end - p >= 8) {
+                const uint64_t chunk = load_u64(p);
+
+                if (!is_eight_digits(chunk)) {
+                    break;
+                }
+
+                mantissa = mantissa * 100000000 + parse_eight_digits(chunk);
+                p += 8;
+            }
+        }
+
+        while (p != end && is_digit(*p)) {
+            mantissa = mantissa * 10 + static_cast<uint64_t>(*p - '0');
+            ++p;
+        }
+
+        number.fraction_end = p;
+        exponent = -(number.fraction_end - number.fraction_begin);
+    }
+
+    int64_t digit_count = (number.integer_end - number.integer_begin) + (number.fraction_end - number.fraction_begin);
+
+    if (digit_count == 0) {
+        return false;
+    }
+
+    int64_t explicit_exponent = 0;
+
+    if (p != end && (*p | 0x20) == 'e') {
+        ++p;
+        bool negative_exponent = false;
+
+        if (p != end && (*p == '-' || *p == '+')) {
+            negative_exponent = (*p == '-');
+            ++p;
+        }
+
+        if (p == end || !is_digit(*p)) {
+            return false;
+        }
+
+        while (p != end && is_digit(*p)) {
+            // 巨大な指数は飽和させる（結果は0または無限大に確定する）
+            if (explicit_exponent < 0x10000) {
+                explicit_exponent = explicit_exponent * 10 + (*p - '0');
+            }
+            ++p;
+        }
+
+        if (negative_exponent) {
+            explicit_exponent = -explicit_exponent;
+        }
+    }
+
+    if (p != end) {
+        return false;
+    }
+
+    number.explicit_exponent = explicit_exponent;
+    number.too_many_digits = false;
+
+    if (digit_count > 19) {
+        // 先頭の0は有効桁に数えない
+        const char* scan = number.integer_begin;
+        const char* const scan_end = number.fraction_end;
+
+        while (scan != scan_end && (*scan == '0' || *scan == '.')) {
+            if (*scan == '0') {
+                --digit_count;
+            }
+            ++scan;
+        }
+
+        if (digit_count > 19) {
+            // 先頭19桁で切り捨て、残りは多倍長比較で扱う
+            number.too_many_digits = true;
+            mantissa = 0;
+
+            const char* q = number.integer_begin;
+            while (mantissa < MIN_19_DIGIT_INTEGER && q != number.integer_end) {
+                mantissa = mantissa * 10 + static_cast<uint64_t>(*q - '0');
+                ++q;
+            }
+
+            if (mantissa >= MIN_19_DIGIT_INTEGER) {
+                exponent = number.integer_end - q;
+            } else {
+                q = number.fraction_begin;
+                while (mantissa < MIN_19_DIGIT_INTEGER && q != number.fraction_end) {
+                    mantissa = mantissa * 10 + static_cast<uint64_t>(*q - '0');
+                    ++q;
+                }
+                exponent = number.fraction_begin - q;
+            }
+        }
+    }
+
+    number.mantissa = mantissa;
+    number.exponent = exponent + explicit_exponent;
+
+    return true;
+}
+
+/**
+ * @brief Eisel-Lemire アルゴリズム
+ *
+ * w * 10^q（wは19桁以下の整数）を最近接偶数丸めした2進表現を求める。
+ * 128bit精度の 5^q テーブルとの乗算1〜2回で結果が確定する。
+ *
+ * @see Daniel Lemire, "Number Parsing at a Gigabyte per Second" (2021)
+ */
+template <typename T>
+[[nodiscard]] inline AdjustedMantissa compute_float(int64_t q, uint64_t w) noexcept {
+    using Format = FloatFormat<T>;
+
+    if (w == 0 || q < Format::SMALLEST_POWER_OF_TEN) {
+        return AdjustedMantissa {0, 0};
+    }
+
+    if (q > Format::LARGEST_POWER_OF_TEN) {
+        return AdjustedMantissa {0, Format::INFINITE_POWER};
+    }
+
+    const int32_t lz = count_leading_zeros(w);
+    w <<= lz;
+
+    // 仮数部 + 3bit の精度が得られれば1回の乗算で十分
+    constexpr uint64_t PRECISION_MASK = 0xFFFFFFFFFFFFFFFFU >> (Format::MANTISSA_BITS + 3);
+    const auto index = static_cast<size_t>(2 * (q - SMALLEST_POWER_OF_FIVE));
+
+    Value128 product = full_multiplication(w, POWER_OF_FIVE_128[index]);
+    if ((product.high & PRECISION_MASK) == PRECISION_MASK) {
+        const Value128 second = full_multiplication(w, POWER_OF_FIVE_128[index + 1]);
+        product.low += second.high;
+        if (second.high > product.low) {
+            ++product.high;
+        }
+    }
+
+    const auto upper_bit = static_cast<int32_t>(product.high >> 63);
+    const int32_t shift = upper_bit + 64 - Format::MANTISSA_BITS - 3;
+
+    AdjustedMantissa answer {product.high >> shift, 0};
+    // floor(log2(10^q)) + 63 の近似: (217706 * q) >> 16
+    const auto power = static_cast<int32_t>(((152170 + 65536) * q) >> 16) + 63;
+    answer.power2 = power + upper_bit - lz - Format::MINIMUM_EXPONENT;
+
+    if (answer.power2 <= 0) {
+        // 非正規化数
+        if (-answer.power2 + 1 >= 64) {
+            return AdjustedMantissa {0, 0};
+        }
+
+        answer.mantissa >>= -answer.power2 + 1;
+        answer.mantissa += (answer.mantissa & 1);
+        answer.mantissa >>= 1;
+        answer.power2 = (answer.mantissa < (uint64_t {1} << Format::MANTISSA_BITS)) ? 0 : 1;
+        return answer;
+    }
+
+    // ちょうど中間値の場合は偶数側へ丸める
+    if (product.low <= 1 && q >= Format::MIN_EXPONENT_ROUND_TO_EVEN && q <= Format::MAX_EXPONENT_ROUND_TO_EVEN && (answer.mantissa & 3) == 1) {
+        if ((answer.mantissa << shift) == product.high) {
+            answer.mantissa &= ~uint64_t {1};
+        }
+    }
+
+    answer.mantissa += (answer.mantissa & 1);
+    answer.mantissa >>= 1;
+
+    if (answer.mantissa >= (uint64_t {2} << Format::MANTISSA_BITS)) {
+        answer.mantissa = uint64_t {1} << Format::MANTISSA_BITS;
+        ++answer.power2;
+    }
+
+    answer.mantissa &= ~(uint64_t {1} << Format::MANTISSA_BITS);
+
+    if (answer.power2 >= Format::INFINITE_POWER) {
+        return AdjustedMantissa {0, Format::INFINITE_POWER};
+    }
+
+    return answer;
+}
+
+/**
+ * @brief 固定容量の多倍長符号なし整数（32bitリム、リトルエンディアン）
+ */
+template <uint32_t Limbs>
+class BigInt {
+public:
+    explicit BigInt(uint64_t value) noexcept : size_(0) {
+        while (value != 0) {
+            limbs_[size_++] = static_cast<uint32_t>(value);
+            value >>= 32;
+        }
+    }
+
+    void mul_small(uint32_t multiplier) noexcept {
+        uint64_t carry = 0;
+        for (uint32_t i = 0; i < size_; ++i) {
+            const uint64_t product = static_cast<uint64_t>(limbs_[i]) * multiplier + carry;
+            limbs_[i] = static_cast<uint32_t>(product);
+            carry = product >> 32;
+        }
+        push(static_cast<uint32_t>(carry));
+    }
+
+    void add_small(uint32_t addend) noexcept {
+        uint64_t carry = addend;
+        for (uint32_t i = 0; i < size_ && carry != 0; ++i) {
+            const uint64_t sum = static_cast<uint64_t>(limbs_[i]) + carry;
+            limbs_[i] = static_cast<uint32_t>(sum);
+            carry = sum >> 32;
+        }
+        push(static_cast<uint32_t>(carry));
+    }
+
+    void mul_pow5(uint32_t exponent) noexcept {
+        constexpr uint32_t POW5_13 = 1220703125U;
+        constexpr uint32_t SMALL_POW5[] = {1, 5, 25, 125, 625, 3125, 15625, 78125, 390625, 1953125, 9765625, 48828125, 244140625};
+
+        while (exponent >= 13) {
+            mul_small(POW5_13);
+            exponent -= 13;
+        }
+
+        if (exponent > 0) {
+            mul_small(SMALL_POW5[exponent]);
+        }
+    }
+
+    void shift_left(uint32_t bits) noexcept {
+        if (size_ == 0) {
+            return;
+        }
+
+        const uint32_t limb_shift = bits / 32;
+        const uint32_t bit_shift = bits % 32;
+
+        assert(size_ + limb_shift + 1 <= Limbs);
+
+        limbs_[size_ + limb_shift] = 0;
+        for (uint32_t i = size_; i-- > 0;) {
+            if (bit_shift != 0) {
+                limbs_[i + limb_shift + 1] |= limbs_[i] >> (32 - bit_shift);
+            }
+            limbs_[i + limb_shift] = limbs_[i] << bit_shift;
+        }
+
+        for (uint32_t i = 0; i < limb_shift; ++i) {
+            limbs_[i] = 0;
+        }
+
+        size_ += limb_shift + 1;
+        while (size_ > 0 && limbs_[size_ - 1] == 0) {
+            --size_;
+        }
+    }
+
+    [[nodiscard]] int32_t compare(const BigInt& other) const noexcept {
+        if (size_ != other.size_) {
+            return (size_ > other.size_) ? 1 : -1;
+        }
+
+        for (uint32_t i = size_; i-- > 0;) {
+            if (limbs_[i] != other.limbs_[i]) {
+                return (limbs_[i] > other.limbs_[i]) ? 1 : -1;
+            }
+        }
+
+        return 0;
+    }
+
+private:
+    void push(uint32_t limb) noexcept {
+        if (limb != 0) {
+            assert(size_ < Limbs);
+            limbs_[size_++] = limb;
+        }
+    }
+
+    uint32_t limbs_[Limbs];
+    uint32_t size_;
+};
+
+/**
+ * @brief 多倍長比較による丸め方向の確定
+ *
+ * 有効桁数が19桁を超え、切り捨てた仮数部では丸め方向が決まらない場合の低速パス。
+ * 10進数の正確な値と、lower とその次の表現可能値との中間値を比較する。
+ */
+template <typename T>
+[[nodiscard]] inline AdjustedMantissa round_by_comparison(const DecimalNumber& number, AdjustedMantissa lower) noexcept {
+    using Format = FloatFormat<T>;
+    using Big = BigInt<Format::BIGINT_LIMBS>;
+
+    // 10進数字列 → 多倍長整数（先頭MAX_DIGITS桁、以降は非0かどうかのみ保持）
+    Big digits(0);
+    int64_t decimal_exponent = 0;
+    uint32_t digit_count = 0;
+    bool truncated_nonzero = false;
+    uint32_t chunk = 0;
+    uint32_t chunk_digits = 0;
+
+    constexpr uint32_t POW10[] = {1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000};
+
+    auto consume = [&](const char* begin, const char* end, bool is_integer) {
+        for (const char* p = begin; p != end; ++p) {
+            if (digit_count == 0 && *p == '0') {
+                continue;
+            }
+
+            if (digit_count >= Format::MAX_DIGITS) {
+                truncated_nonzero = truncated_nonzero || (*p != '0');
+                continue;
+            }
+
+            chunk = chunk * 10 + static_cast<uint32_t>(*p - '0');
+            ++chunk_digits;
+            ++digit_count;
+
+            // 最後に取り込んだ桁の重み
+            decimal_exponent = is_integer ? (end - p - 1) : -(p - begin + 1);
+
+            if (chunk_digits == 9) {
+                digits.mul_small(POW10[9]);
+                digits.add_small(chunk);
+                chunk = 0;
+                chunk_digits = 0;
+            }
+        }
+    };
+
+    consume(number.integer_begin, number.integer_end, true);
+    consume(number.fraction_begin, number.fraction_end, false);
+
+    if (chunk_digits > 0) {
+        digits.mul_small(POW10[chunk_digits]);
+        digits.add_small(chunk);
+    }
+
+    decimal_exponent += number.explicit_exponent;
+
+    // lower と次の値の中間値 = (2M + 1) * 2^(e2 - 1)
+    uint64_t significand = lower.mantissa;
+    int64_t binary_exponent = 1 + Format::MINIMUM_EXPONENT - Format::MANTISSA_BITS;
+    if (lower.power2 > 0) {
+        significand |= uint64_t {1} << Format::MANTISSA_BITS;
+        binary_exponent = lower.power2 + Format::MINIMUM_EXPONENT - Format::MANTISSA_BITS;
+    }
+
+    Big halfway(2 * significand + 1);
+    const int64_t halfway_exponent = binary_exponent - 1;
+
+    if (decimal_exponent >= 0) {
+        // digits * 5^E * 2^E  vs  halfway * 2^h
+        digits.mul_pow5(static_cast<uint32_t>(decimal_exponent));
+        if (decimal_exponent >= halfway_exponent) {
+            digits.shift_left(static_cast<uint32_t>(decimal_exponent - halfway_exponent));
+        } else {
+            halfway.shift_left(static_cast<uint32_t>(halfway_exponent - decimal_exponent));
+        }
+    } else {
+        // digits  vs  halfway * 5^-E * 2^(h - E)
+        halfway.mul_pow5(static_cast<uint32_t>(-decimal_exponent));
+        const int64_t shift = halfway_exponent - decimal_exponent;
+        if (shift >= 0) {
+            halfway.shift_left(static_cast<uint32_t>(shift));
+        } else {
+            digits.shift_left(static_cast<uint32_t>(-shift));
+        }
+    }
+
+    int32_t order = digits.compare(halfway);
+    if (order == 0 && truncated_nonzero) {
+        order = 1;
+    }
+
+    if (order > 0 || (order == 0 && (lower.mantissa & 1) != 0)) {
+        ++lower.mantissa;
+        if (lower.mantissa == (uint64_t {1} << Format::MANTISSA_BITS)) {
+            lower.mantissa = 0;
+            ++lower.power2;
+        }
+    }
+
+    return lower;
+}
+
+/**
+ * @brief 2進表現から浮動小数点数を構築
+ */
+template <typename T>
+[[nodiscard]] inline T to_float(bool negative, AdjustedMantissa am) noexcept {
+    using Bits = typename FloatFormat<T>::Bits;
+
+    auto bits = static_cast<Bits>(am.mantissa | (static_cast<uint64_t>(am.power2) << FloatFormat<T>::MANTISSA_BITS));
+    if (negative) {
+        bits |= Bits {1} << (sizeof(Bits) * 8 - 1);
+    }
+
+    T value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+/**
+ * @brief 浮動小数点数パース実装
+ */
+template <typename T>
+[[nodiscard]] Result<T> parse_float(std::string_view str) noexcept {
+    using Format = FloatFormat<T>;
+
+    const char* p = str.data();
+    const char* const end = p + str.size();
+    bool negative = false;
+
+    if (p != end && (*p == '-' || *p == '+')) {
+        negative = (*p == '-');
+        ++p;
+    }
+
+    if (p != end && !is_digit(*p) && *p != '.') {
+        if ((end - p == 3 && starts_with_ignore_case(p, end, "inf")) || (end - p == 8 && starts_with_ignore_case(p, end, "infinity"))) {
+            return Result<T>::ok(negative ? -std::numeric_limits<T>::infinity() : std::numeric_limits<T>::infinity());
+        }
+
+        if (end - p == 3 && starts_with_ignore_case(p, end, "nan")) {
+            return Result<T>::ok(negative ? -std::numeric_limits<T>::quiet_NaN() : std::numeric_limits<T>::quiet_NaN());
+        }
+
+        return Result<T>::err(Error::INVALID_DATA);
+    }
+
+    DecimalNumber number {};
+    if (!parse_decimal(p, end, number)) {
+        return Result<T>::err(Error::INVALID_DATA);
+    }
+
+    // Clingerの高速パス: 仮数部と10のべき乗がどちらも正確に表現できれば、1回の乗除算で正しく丸められる
+    if constexpr (CLINGER_FAST_PATH_ENABLED) {
+        if (!number.too_many_digits && number.exponent >= -Format::MAX_EXPONENT_FAST_PATH && number.exponent <= Format::MAX_EXPONENT_FAST_PATH &&
+            number.mantissa <= Format::MAX_MANTISSA_FAST_PATH) {
+            auto value = static_cast<T>(number.mantissa);
+            if (number.exponent < 0) {
+                value /= Format::POWERS_OF_TEN[-number.exponent];
+            } else {
+                value *= Format::POWERS_OF_TEN[number.exponent];
+            }
+            return Result<T>::ok(negative ? -value : value);
+        }
+    }
+
+    AdjustedMantissa am = compute_float<T>(number.exponent, number.mantissa);
+
+    // 切り捨てた仮数部 w と w+1 で結果が異なる場合のみ低速パス
+    if (number.too_many_digits && am != compute_float<T>(number.exponent, number.mantissa + 1)) {
+        am = round_by_comparison<T>(number, am);
+    }
+
+    if (am.power2 == Format::INFINITE_POWER) {
+        return Result<T>::err(Error::INVALID_DATA);
+    }
+
+    return Result<T>::ok(to_float<T>(negative, am));
+}
+
+} // namespace omusubi::detail
+
+namespace omusubi {
+
+/**
+ * @brief 文字列を数値に変換
+ *
+ * @tparam T 整数型（bool以外）、float、double
+ * @param str 変換する文字列（全体が数値である必要がある）
+ * @return 成功時は値、書式不正・範囲外の場合は Error::INVALID_DATA
+ *
+ * @par 使用例
+ * @code
+ * char line[32];
+ * size_t n = serial->read_line(span<char>(line, sizeof(line)));
+ *
+ * auto interval = parse<uint32_t>(std::string_view(line, n));
+ * if (interval.is_ok()) {
+ *     set_interval(interval.value());
+ * }
+ *
+ * float threshold = parse<float>("0.25"sv).value_or(0.5F);
+ * @endcode
+ */
+template <typename T>
+[[nodiscard]] Result<T> parse(std::string_view str) noexcept {
+    static_assert((std::is_integral_v<T> && !std::is_same_v<T, bool>) || std::is_same_v<T, float> || std::is_same_v<T, double>, "parse<T> supports integer types, float and double");
+
+    if constexpr (std::is_integral_v<T>) {
+        return detail::parse_integer<T>(str);
+    } else {
+        return detail::parse_float<T>(str);
+    }
+}
+
+} // namespace omusubi
@@ -0,0 +1,223 @@
+#pragma once
+
+#include <cstdint>
+#include <omusubi/core/fixed_vector.hpp>
+
+namespace omusubi {
+
+/**
+ * @brief operator< による比較（PriorityQueue のデフォルト）
+ */
+struct Less {
+    template <typename T>
+    [[nodiscard]] constexpr bool operator()(const T& a, const T& b) const noexcept {
+        return a < b;
+    }
+};
+
+/**
+ * @brief 固定容量の優先度付きキュー（d分ヒープ）
+ *
+ * Compare(a, b) が true の要素ほど先に取り出される（デフォルトは最小値が先頭）。
+ * 各ノードが Arity 個の子を持つため、2分ヒープより木が浅く、
+ * push のシフトアップが短くなる。子ノードは配列上で連続しているため、
+ * pop のシフトダウンでの比較もキャッシュ効率が良い。
+ *
+ * - push / pop: O(log_Arity N)
+ * - top: O(1)
+ * - 動的メモリ確保なし（要素は FixedVector<T, N> に保持）
+ *
+ * @tparam T 要素の型
+ * @tparam N 最大要素数
+ * @tparam Compare 優先度の比較関数オブジェクト
+ * @tparam Arity 子ノード数（2以上）
+ *
+ * @par 使用例
+ * @code
+ * struct Deadline {
+ *     uint32_t at_ms;
+ *     uint16_t request_id;
+ * };
+ *
+ * struct Earlier {
+ *     bool operator()(const Deadline& a, const Deadline& b) const { return is_time_before(a.at_ms, b.at_ms); }
+ * };
+ *
+ * PriorityQueue<Deadline, 32, Earlier> deadlines;
+ * deadlines.push(Deadline {now + 250, id});
+ *
+ * while (const Deadline* next = deadlines.top()) {
+ *     if (is_time_before(now, next->at_ms)) break;
+ *     handle_timeout(next->request_id);
+ *     deadlines.pop();
+ * }
+ * @endcode
+ */
+template <typename T, uint32_t N, typename Compare = Less, uint32_t Arity = 4>
+class PriorityQueue {
+    static_assert(Arity >= 2, "PriorityQueue arity must be at least 2");
+
+public:
+    /**
+     * @brief デフォルトコンストラクタ
+     */
+    PriorityQueue() noexcept = default;
+
+    /**
+     * @brief 比較関数オブジェクトを指定して構築
+     */
+    explicit PriorityQueue(const Compare& compare) noexcept : compare_(compare) {}
+
+    /**
+     * @brief 容量を取得
+     */
+    [[nodiscard]] static constexpr uint32_t capacity() noexcept { return N; }
+
+    /**
+     * @brief 要素数を取得
+     */
+    [[nodiscard]] uint32_t size() const noexcept { return heap_.size(); }
+
+    /**
+     * @brief 空か判定
+     */
+    [[nodiscard]] bool is_empty() const noexcept { return heap_.is_empty(); }
+
+    /**
+     * @brief 満杯か判定
+     */
+    [[nodiscard]] bool is_full() const noexcept { return heap_.is_full(); }
+
+    /**
+     * @brief 最も優先度の高い要素を取得
+     *
+     * @return 先頭要素へのポインタ（空の場合nullptr）
+     */
+    [[nodiscard]] const T* top() const noexcept { return heap_.at(0); }
+
+    /**
+     * @brief 要素を追加
+     *
+     * @return 満杯の場合false
+     */
+    bool push(const T& value) noexcept {
+        if (heap_.push_back(value).is_err()) {
+            return false;
+        }
+        sift_up(heap_.size() - 1);
+        return true;
+    }
+
+    /**
+     * @brief 要素を追加（ムーブ）
+     *
+     * @return 満杯の場合false
+     */
+    bool push(T&& value) noexcept {
+        if (heap_.push_back(static_cast<T&&>(value)).is_err()) {
+            return false;
+        }
+        sift_up(heap_.size() - 1);
+        return true;
+    }
+
+    /**
+     * @brief 先頭要素を削除
+     *
+     * @return 空の場合false
+     */
+    bool pop() noexcept {
+        if (heap_.is_empty()) {
+            return false;
+        }
+
+        const uint32_t last = heap_.size() - 1;
+        if (last > 0) {
+            heap_[0] = static_cast<T&&>(heap_[last]);
+        }
+        heap_.pop_back();
+
+        if (!heap_.is_empty()) {
+            sift_down(0);
+        }
+        return true;
+    }
+
+    /**
+     * @brief 先頭要素を取り出す
+     *
+     * @return 空の場合false
+     */
+    bool pop(T& out) noexcept {
+        if (heap_.is_empty()) {
+            return false;
+        }
+        out = static_cast<T&&>(heap_[0]);
+        return pop();
+    }
+
+    /**
+     * @brief 全要素を削除
+     */
+    void clear() noexcept { heap_.clear(); }
+
+    /**
+     * @brief 内部配列（ヒープ順）を参照
+     *
+     * 全要素を走査する場合に使用する。先頭要素以外の順序は不定。
+     */
+    [[nodiscard]] span<const T> as_span() const noexcept { return heap_.as_span(); }
+
+private:
+    void sift_up(uint32_t index) noexcept {
+        if (index == 0) {
+            return;
+        }
+
+        T value = static_cast<T&&>(heap_[index]);
+
+        while (index > 0) {
+            const uint32_t parent = (index - 1) / Arity;
+            if (!compare_(value, heap_[parent])) {
+                break;
+            }
+            heap_[index] = static_cast<T&&>(heap_[parent]);
+            index = parent;
+        }
+
+        heap_[index] = static_cast<T&&>(value);
+    }
+
+    void sift_down(uint32_t index) noexcept {
+        const uint32_t count = heap_.size();
+        T value = static_cast<T&&>(heap_[index]);
+
+        for (;;) {
+            const uint32_t first_child = (index * Arity) + 1;
+            if (first_child >= count) {
+                break;
+            }
+
+            const uint32_t last_child = (first_child + Arity < count) ? first_child + Arity : count;
+            uint32_t best = first_child;
+            for (uint32_t child = first_child + 1; child < last_child; ++child) {
+                if (compare_(heap_[child], heap_[best])) {
+                    best = child;
+                }
+            }
+
+            if (!compare_(heap_[best], value)) {
+                break;
+            }
+            heap_[index] = static_cast<T&&>(heap_[best]);
+            index = best;
+        }
+
+        heap_[index] = static_cast<T&&>(value);
+    }
+
+    FixedVector<T, N> heap_;
+    Compare compare_ {};
+};
+
+} // namespace omusubi
@@ -0,0 +1,297 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <omusubi/core/span.hpp>
+
+namespace omusubi {
+
+/**
+ * @brief 固定長リングバッファ（SPSCロックフリー）
+ *
+ * 1つの生産者（ISRまたはスレッド）と1つの消費者が、ロックなしで共有できる。
+ * UARTの受信FIFOなど、ByteReadable::available() / read() の実装の
+ * 標準的なバッファとして使用する。
+ *
+ * - 容量は2の累乗（インデックスはマスクで折り返す）
+ * - 書き込み位置・読み取り位置はそれぞれ一方の側だけが更新する
+ * - データの公開は release ストア、取得は acquire ロードで同期する
+ *
+ * 生産者側: push(), write_region() / commit()
+ * 消費者側: pop(), read_region() / consume(), clear()
+ * どちらからでも: size(), is_empty(), is_full(), free_space()
+ *
+ * @tparam T 要素の型
+ * @tparam N 容量（2の累乗）
+ *
+ * @par 使用例
+ * @code
+ * RingBuffer<uint8_t, 256> rx;
+ *
+ * // UART受信割り込み（生産者）
+ * void on_uart_rx(uint8_t byte) { rx.push(byte); }
+ *
+ * // ByteReadable 実装（消費者）
+ * size_t available() const override { return rx.size(); }
+ * size_t read(span<uint8_t> buffer) override { return rx.pop(buffer); }
+ * @endcode
+ */
+template <typename T, uint32_t N>
+class RingBuffer {
+    static_assert(N > 0 && (N & (N - 1)) == 0, "RingBuffer capacity must be a power of two");
+
+public:
+    RingBuffer() noexcept = default;
+    ~RingBuffer() noexcept = default;
+    RingBuffer(const RingBuffer&) = delete;
+    RingBuffer& operator=(const RingBuffer&) = delete;
+    RingBuffer(RingBuffer&&) = delete;
+    RingBuffer& operator=(RingBuffer&&) = delete;
+
+    /**
+     * @brief 容量を取得
+     */
+    [[nodiscard]] static constexpr uint32_t capacity() noexcept { return N; }
+
+    /**
+     * @brief 格納されている要素数を取得
+     */
+    [[nodiscard]] uint32_t size() const noexcept {
+        // tail を先に読むことで head - tail が負にならないようにする
+        const uint32_t tail = tail_.load(std::memory_order_acquire);
+        const uint32_t stored = head_.load(std::memory_order_acquire) - tail;
+        return (stored < N) ? stored : N;
+    }
+
+    /**
+     * @brief 空き要素数を取得
+     */
+    [[nodiscard]] uint32_t free_space() const noexcept { return N - size(); }
+
+    /**
+     * @brief 空か判定
+     */
+    [[nodiscard]] bool is_empty() const noexcept { return size() == 0; }
+
+    /**
+     * @brief 満杯か判定
+     */
+    [[nodiscard]] bool is_full() const noexcept { return size() == N; }
+
+    // ========================================
+    // 生産者側
+    // ========================================
+
+    /**
+     * @brief 1要素追加
+     *
+     * @return 満杯の場合false
+     */
+    bool push(const T& value) noexcept {
+        const uint32_t head = head_.load(std::memory_order_relaxed);
+
+        if (head - tail_.load(std::memory_order_acquire) == N) {
+            return false;
+        }
+
+        buffer_[head & MASK] = value;
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief 複数要素をまとめて追加
+     *
+     * 空きが足りない場合は入る分だけ追加する。
+     * インデックスの公開は1回だけ行う。
+     *
+     * @return 追加した要素数
+     */
+    uint32_t push(span<const T> values) noexcept {
+        const uint32_t head = head_.load(std::memory_order_relaxed);
+        const uint32_t space = N - (head - tail_.load(std::memory_order_acquire));
+        const auto requested = static_cast<uint32_t>(values.size());
+        const uint32_t count = (requested < space) ? requested : space;
+
+        const uint32_t offset = head & MASK;
+        const uint32_t first = (count < N - offset) ? count : N - offset;
+
+        for (uint32_t i = 0; i < first; ++i) {
+            buffer_[offset + i] = values[i];
+        }
+        for (uint32_t i = first; i < count; ++i) {
+            buffer_[i - first] = values[i];
+        }
+
+        head_.store(head + count, std::memory_order_release);
+        return count;
+    }
+
+    /**
+     * @brief 書き込み可能な連続領域を取得
+     *
+     * 折り返し位置までの空き領域を返す。書き込んだ後に commit() で公開する。
+     * DMAの転送先やドライバからの直接書き込みに使用する。
+     */
+    [[nodiscard]] span<T> write_region() noexcept {
+        const uint32_t head = head_.load(std::memory_order_relaxed);
+        const uint32_t space = N - (head - tail_.load(std::memory_order_acquire));
+        const uint32_t offset = head & MASK;
+        const uint32_t contiguous = N - offset;
+
+        return span<T>(buffer_ + offset, (space < contiguous) ? space : contiguous);
+    }
+
+    /**
+     * @brief write_region() に書き込んだ要素を公開
+     *
+     * @param count 書き込んだ要素数（write_region() のサイズ以下）
+     */
+    void commit(uint32_t count) noexcept {
+        const uint32_t head = head_.load(std::memory_order_relaxed);
+        head_.store(head + count, std::memory_order_release);
+    }
+
+    // ========================================
+    // 消費者側
+    // ========================================
+
+    /**
+     * @brief 1要素取り出し
+     *
+     * @return 空の場合false
+     */
+    bool pop(T& value) noexcept {
+        const uint32_t tail = tail_.load(std::memory_order_relaxed);
+
+        if (head_.load(std::memory_order_acquire) == tail) {
+            return false;
+        }
+
+        value = buffer_[tail & MASK];
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief 複数要素をまとめて取り出し
+     *
+     * @return 取り出した要素数
+     */
+    uint32_t pop(span<T> out) noexcept {
+        const uint32_t tail = tail_.load(std::memory_order_relaxed);
+        const uint32_t stored = head_.load(std::memory_order_acquire) - tail;
+        const auto requested = static_cast<uint32_t>(out.size());
+        const uint32_t count = (requested < stored) ? requested : stored;
+
+        const uint32_t offset = tail & MASK;
+        const uint32_t first = (count < N - offset) ? count : N - offset;
+
+        for (uint32_t i = 0; i < first; ++i) {
+            out[i] = buffer_[offset + i];
+        }
+        for (uint32_t i = first; i < count; ++i) {
+            out[i] = buffer_[i - first];
+        }
+
+        tail_.store(tail + count, std::memory_order_release);
+        return count;
+    }
+
+    /**
+     * @brief 先頭から複数要素を取り出さずにコピー
+     *
+     * 折り返し位置をまたいでもコピーする。区切り文字を探してから consume() する場合などに使用する。
+     *
+     * @return コピーした要素数
+     */
+    uint32_t peek(span<T> out) const noexcept {
+        const uint32_t tail = tail_.load(std::memory_order_relaxed);
+        const uint32_t stored = head_.load(std::memory_order_acquire) - tail;
+        const auto requested = static_cast<uint32_t>(out.size());
+        const uint32_t count = (requested < stored) ? requested : stored;
+
+        const uint32_t offset = tail & MASK;
+        const uint32_t first = (count < N - offset) ? count : N - offset;
+
+        for (uint32_t i = 0; i < first; ++i) {
+            out[i] = buffer_[offset + i];
+        }
+        for (uint32_t i = first; i < count; ++i) {
+            out[i] = buffer_[i - first];
+        }
+        return count;
+    }
+
+    /**
+     * @brief 読み取り可能な連続領域を取得
+     *
+     * 折り返し位置までの格納済み領域をコピーせずに返す。読み取った後に consume() で解放する。
+     */
+    [[nodiscard]] span<const T> read_region() const noexcept {
+        const uint32_t tail = tail_.load(std::memory_order_relaxed);
+        const uint32_t stored = head_.load(std::memory_order_acquire) - tail;
+        const uint32_t offset = tail & MASK;
+        const uint32_t contiguous = N - offset;
+
+        return span<const T>(buffer_ + offset, (stored < contiguous) ? stored : contiguous);
+    }
+
+    /**
+     * @brief read_region() で読み取った要素を解放
+     *
+     * @param count 解放する要素数（size() 以下）
+     */
+    void consume(uint32_t count) noexcept {
+        const uint32_t tail = tail_.load(std::memory_order_relaxed);
+        tail_.store(tail + count, std::memory_order_release);
+    }
+
+    /**
+     * @brief 格納されている要素をすべて破棄（消費者側から呼ぶ）
+     */
+    void clear() noexcept { tail_.store(head_.load(std::memory_order_acquire), std::memory_order_release); }
+
+private:
+    static constexpr uint32_t MASK = N - 1;
+
+    T buffer_[N] {};
+    std::atomic<uint32_t> head_ {0}; ///< 書き込み位置（生産者のみ更新、単調増加）
+    std::atomic<uint32_t> tail_ {0}; ///< 読み取り位置（消費者のみ更新、単調増加）
+};
+
+/**
+ * @brief ring_read_line() の結果
+ */
+struct RingLine {
+    uint32_t length;   ///< buffer に書いた行の長さ（改行を除く）。行がまだない場合0
+    uint32_t consumed; ///< 消費すべき要素数（改行を含む）。行がまだない場合0
+};
+
+/**
+ * @brief 受信リングの先頭から1行を取り出す（TextReadable::read_line() の実装用）
+ *
+ * 先頭 limit バイトの中から改行（\n、直前の \r も除く）を探し、そこまでを buffer にコピーする。
+ * 改行がない場合は何も消費しないが、buffer が一杯になったとき、またはリングが一杯で
+ * それ以上受信できないときは、そこで区切って返す（改行を待ち続けて受信が止まらないように）。
+ * リングは読み取らないので、呼び出し側が consumed だけ consume() する。
+ *
+ * @param limit 読んでよいバイト数（受信済みのバイト数）
+ */
+template <uint32_t N>
+RingLine ring_read_line(const RingBuffer<uint8_t, N>& ring, span<char> buffer, uint32_t limit) noexcept {
+    const uint32_t count = (buffer.size() < limit) ? static_cast<uint32_t>(buffer.size()) : limit;
+    const uint32_t copied = ring.peek(span<uint8_t>(reinterpret_cast<uint8_t*>(buffer.data()), count));
+    for (uint32_t i = 0; i < copied; ++i) {
+        if (buffer[i] == '\n') {
+            return RingLine {(i > 0 && buffer[i - 1] == '\r') ? i - 1 : i, i + 1};
+        }
+    }
+
+    if (copied > 0 && (copied == buffer.size() || copied == N)) {
+        return RingLine {copied, copied};
+    }
+    return RingLine {0, 0};
+}
+
+} // namespace omusubi
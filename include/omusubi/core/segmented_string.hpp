@@ -0,0 +1,430 @@
+#pragma once
+
+#include <omusubi/core/string_view.h>
+
+#include <cstdint>
+#include <cstring>
+#include <omusubi/core/span.hpp>
+#include <omusubi/interface/writable.h>
+#include <string_view>
+
+namespace omusubi {
+
+/**
+ * @brief SegmentedString を構成する固定長セグメント
+ */
+template <uint32_t SegmentSize>
+struct StringSegment {
+    char data[SegmentSize];
+    uint32_t length;
+    StringSegment* next;
+};
+
+/**
+ * @brief 固定長セグメントのフリーリスト
+ *
+ * SegmentPool<SegmentSize, SegmentCount> の共通部分。
+ * SegmentedString はセグメント数に依存せず、この型を通してセグメントを取得・返却する。
+ */
+template <uint32_t SegmentSize>
+class SegmentAllocator {
+public:
+    using Segment = StringSegment<SegmentSize>;
+
+    SegmentAllocator(const SegmentAllocator&) = delete;
+    SegmentAllocator& operator=(const SegmentAllocator&) = delete;
+    SegmentAllocator(SegmentAllocator&&) = delete;
+    SegmentAllocator& operator=(SegmentAllocator&&) = delete;
+
+    /**
+     * @brief セグメントサイズ（バイト）を取得
+     */
+    [[nodiscard]] static constexpr uint32_t segment_size() noexcept { return SegmentSize; }
+
+    /**
+     * @brief 総セグメント数を取得
+     */
+    [[nodiscard]] uint32_t capacity() const noexcept { return capacity_; }
+
+    /**
+     * @brief 未使用セグメント数を取得
+     */
+    [[nodiscard]] uint32_t available() const noexcept { return available_; }
+
+    /**
+     * @brief セグメントを1つ取得
+     *
+     * @return セグメント（枯渇時はnullptr）
+     */
+    [[nodiscard]] Segment* acquire() noexcept {
+        Segment* segment = free_list_;
+        if (segment == nullptr) {
+            return nullptr;
+        }
+
+        free_list_ = segment->next;
+        --available_;
+        segment->length = 0;
+        segment->next = nullptr;
+        return segment;
+    }
+
+    /**
+     * @brief セグメントの連結リストをまとめて返却
+     */
+    void release(Segment* head) noexcept {
+        while (head != nullptr) {
+            Segment* next = head->next;
+            head->next = free_list_;
+            free_list_ = head;
+            ++available_;
+            head = next;
+        }
+    }
+
+protected:
+    SegmentAllocator() noexcept = default;
+    ~SegmentAllocator() noexcept = default;
+
+    void init(Segment* segments, uint32_t count) noexcept {
+        for (uint32_t i = 0; i + 1 < count; ++i) {
+            segments[i].next = &segments[i + 1];
+        }
+        segments[count - 1].next = nullptr;
+
+        free_list_ = segments;
+        capacity_ = count;
+        available_ = count;
+    }
+
+private:
+    Segment* free_list_ = nullptr;
+    uint32_t capacity_ = 0;
+    uint32_t available_ = 0;
+};
+
+/**
+ * @brief 固定長セグメントのプール
+ *
+ * SegmentedString が使用するセグメントを静的に確保する。
+ * 通常はstatic変数またはグローバル変数として配置し、複数のビルダーで共有する。
+ *
+ * @tparam SegmentSize 1セグメントのバイト数
+ * @tparam SegmentCount セグメント数
+ *
+ * @note スレッドセーフではない
+ */
+template <uint32_t SegmentSize, uint32_t SegmentCount>
+class SegmentPool : public SegmentAllocator<SegmentSize> {
+    static_assert(SegmentSize > 0, "SegmentSize must be greater than 0");
+    static_assert(SegmentCount > 0, "SegmentCount must be greater than 0");
+
+public:
+    SegmentPool() noexcept { this->init(segments_, SegmentCount); }
+
+private:
+    StringSegment<SegmentSize> segments_[SegmentCount];
+};
+
+/**
+ * @brief セグメント連結による可変長文字列ビルダー
+ *
+ * 固定長セグメントをプールから取得して連結し、単一の FixedString に
+ * 収まらない大きなペイロード（JSON、CSVなど）を組み立てる。
+ *
+ * - 追加時にセグメント境界をまたいで分割するだけで、既存の内容を再コピーしない
+ * - 使用メモリはプールのサイズで上限が決まり、動的メモリ確保なし
+ * - 内容はセグメントごとの std::string_view 列（スキャッタリスト）として取得する
+ *
+ * @note セグメント境界はUTF-8文字の途中になることがある。
+ *       各セグメントは単独の文字列ではなく、連結したバイト列として扱うこと。
+ *
+ * @par 使用例
+ * @code
+ * static SegmentPool<256, 16> pool;
+ *
+ * SegmentedString<256> json(pool);
+ * json.append("{\"samples\":[");
+ * for (...) {
+ *     json.append(format<16>("{},", value));
+ * }
+ * json.append("]}");
+ *
+ * json.write_to(*serial); // セグメントをまとめて write_textv()
+ * @endcode
+ */
+template <uint32_t SegmentSize>
+class SegmentedString {
+public:
+    using Segment = StringSegment<SegmentSize>;
+
+    /** @brief write_to() が1回の write_textv() に渡すセグメント数 */
+    static constexpr uint32_t WRITE_BATCH = 16;
+
+    /**
+     * @brief セグメント単位の前方イテレータ
+     */
+    class const_iterator {
+    public:
+        constexpr explicit const_iterator(const Segment* segment) noexcept : segment_(segment) {}
+
+        [[nodiscard]] std::string_view operator*() const noexcept { return std::string_view {segment_->data, segment_->length}; }
+
+        const_iterator& operator++() noexcept {
+            segment_ = segment_->next;
+            return *this;
+        }
+
+        [[nodiscard]] bool operator==(const const_iterator& other) const noexcept { return segment_ == other.segment_; }
+
+        [[nodiscard]] bool operator!=(const const_iterator& other) const noexcept { return segment_ != other.segment_; }
+
+    private:
+        const Segment* segment_;
+    };
+
+    /**
+     * @brief プールを指定して構築
+     */
+    explicit SegmentedString(SegmentAllocator<SegmentSize>& pool) noexcept : pool_(&pool) {}
+
+    /**
+     * @brief デストラクタ（セグメントをプールへ返却）
+     */
+    ~SegmentedString() noexcept { clear(); }
+
+    SegmentedString(const SegmentedString&) = delete;
+    SegmentedString& operator=(const SegmentedString&) = delete;
+
+    /**
+     * @brief ムーブコンストラクタ
+     */
+    SegmentedString(SegmentedString&& other) noexcept
+        : pool_(other.pool_), head_(other.head_), tail_(other.tail_), byte_length_(other.byte_length_), segment_count_(other.segment_count_) {
+        other.detach();
+    }
+
+    /**
+     * @brief ムーブ代入
+     */
+    SegmentedString& operator=(SegmentedString&& other) noexcept {
+        if (this != &other) {
+            clear();
+            pool_ = other.pool_;
+            head_ = other.head_;
+            tail_ = other.tail_;
+            byte_length_ = other.byte_length_;
+            segment_count_ = other.segment_count_;
+            other.detach();
+        }
+        return *this;
+    }
+
+    /**
+     * @brief バイト長を取得
+     */
+    [[nodiscard]] uint32_t byte_length() const noexcept { return byte_length_; }
+
+    /**
+     * @brief サイズを取得（byte_length()のエイリアス）
+     */
+    [[nodiscard]] size_t size() const noexcept { return byte_length_; }
+
+    /**
+     * @brief 空か判定
+     */
+    [[nodiscard]] bool is_empty() const noexcept { return byte_length_ == 0; }
+
+    /**
+     * @brief 使用中のセグメント数を取得
+     */
+    [[nodiscard]] uint32_t segment_count() const noexcept { return segment_count_; }
+
+    /**
+     * @brief 追加で書き込めるバイト数を取得
+     *
+     * 末尾セグメントの空きと、プールの未使用セグメントの合計。
+     * プールを共有している場合、他のビルダーの使用によって減少する。
+     */
+    [[nodiscard]] uint32_t remaining() const noexcept {
+        const uint32_t tail_free = (tail_ != nullptr) ? SegmentSize - tail_->length : 0;
+        return tail_free + pool_->available() * SegmentSize;
+    }
+
+    /**
+     * @brief 文字列を追加
+     *
+     * FixedString::append() と同様に、全体が収まらない場合は何も追加しない。
+     *
+     * @return 追加できた場合true
+     */
+    bool append(std::string_view view) noexcept {
+        const auto view_size = static_cast<uint32_t>(view.size());
+
+        if (view_size > remaining()) {
+            return false;
+        }
+
+        const char* src = view.data();
+        uint32_t left = view_size;
+
+        while (left > 0) {
+            if (tail_ == nullptr || tail_->length == SegmentSize) {
+                grow();
+            }
+
+            const uint32_t space = SegmentSize - tail_->length;
+            const uint32_t chunk = (left < space) ? left : space;
+            char* dst = tail_->data + tail_->length;
+
+            for (uint32_t i = 0; i < chunk; ++i) {
+                dst[i] = src[i];
+            }
+
+            tail_->length += chunk;
+            src += chunk;
+            left -= chunk;
+        }
+
+        byte_length_ += view_size;
+        return true;
+    }
+
+    /**
+     * @brief C文字列を追加
+     */
+    bool append(const char* str) noexcept {
+        if (str == nullptr) {
+            return false;
+        }
+
+        return append(from_c_string(str));
+    }
+
+    /**
+     * @brief 1文字追加
+     */
+    bool append(char c) noexcept { return append(std::string_view {&c, 1}); }
+
+    /**
+     * @brief クリア（全セグメントをプールへ返却）
+     */
+    void clear() noexcept {
+        if (pool_ != nullptr) {
+            pool_->release(head_);
+        }
+
+        head_ = nullptr;
+        tail_ = nullptr;
+        byte_length_ = 0;
+        segment_count_ = 0;
+    }
+
+    /**
+     * @brief スキャッタリストを取得
+     *
+     * 各セグメントの内容を先頭から順に out へ格納する。
+     * out は ByteWritable::writev() / TextWritable::write_textv() の引数にそのまま渡せる。
+     * out が足りない場合は格納できた分だけを返す。
+     *
+     * @return 格納した要素数
+     */
+    uint32_t to_scatter_list(span<span<const char>> out) const noexcept {
+        uint32_t count = 0;
+
+        for (const Segment* segment = head_; segment != nullptr && count < out.size(); segment = segment->next) {
+            out[count++] = span<const char>(segment->data, segment->length);
+        }
+
+        return count;
+    }
+
+    /**
+     * @brief 全セグメントを TextWritable へギャザー書き込み
+     *
+     * セグメントを WRITE_BATCH 個ずつ write_textv() に渡す。中間バッファへのコピーはしない。
+     *
+     * @return 書き込んだバイト数（書き込みが不足した場合はそこで終了）
+     */
+    size_t write_to(TextWritable& out) const {
+        span<const char> parts[WRITE_BATCH];
+        size_t total = 0;
+        const Segment* segment = head_;
+
+        while (segment != nullptr) {
+            uint32_t count = 0;
+            size_t batch_bytes = 0;
+            for (; segment != nullptr && count < WRITE_BATCH; segment = segment->next) {
+                parts[count++] = span<const char>(segment->data, segment->length);
+                batch_bytes += segment->length;
+            }
+
+            const size_t written = out.write_textv(span<const span<const char>>(parts, count));
+            total += written;
+            if (written < batch_bytes) {
+                break;
+            }
+        }
+
+        return total;
+    }
+
+    /**
+     * @brief 連続したバッファへコピー
+     *
+     * @return コピーしたバイト数（out が足りない場合は先頭部分のみ）
+     */
+    uint32_t copy_to(span<char> out) const noexcept {
+        uint32_t copied = 0;
+
+        for (const Segment* segment = head_; segment != nullptr && copied < out.size(); segment = segment->next) {
+            const auto space = static_cast<uint32_t>(out.size()) - copied;
+            const uint32_t chunk = (segment->length < space) ? segment->length : space;
+
+            std::memcpy(out.data() + copied, segment->data, chunk);
+            copied += chunk;
+        }
+
+        return copied;
+    }
+
+    /**
+     * @brief イテレータ（開始）
+     */
+    [[nodiscard]] const_iterator begin() const noexcept { return const_iterator(head_); }
+
+    /**
+     * @brief イテレータ（終了）
+     */
+    [[nodiscard]] const_iterator end() const noexcept { return const_iterator(nullptr); }
+
+private:
+    // remaining() で容量を確認済みであることが前提
+    void grow() noexcept {
+        Segment* segment = pool_->acquire();
+
+        if (tail_ == nullptr) {
+            head_ = segment;
+        } else {
+            tail_->next = segment;
+        }
+
+        tail_ = segment;
+        ++segment_count_;
+    }
+
+    void detach() noexcept {
+        head_ = nullptr;
+        tail_ = nullptr;
+        byte_length_ = 0;
+        segment_count_ = 0;
+    }
+
+    SegmentAllocator<SegmentSize>* pool_;
+    Segment* head_ = nullptr;
+    Segment* tail_ = nullptr;
+    uint32_t byte_length_ = 0;
+    uint32_t segment_count_ = 0;
+};
+
+} // namespace omusubi
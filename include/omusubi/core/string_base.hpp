@@ -7,11 +7,49 @@
 
 namespace omusubi {
 
+namespace detail {
+
+/**
+ * @brief バイト列の一致判定（String の全派生型で共有する実装）
+ */
+[[nodiscard]] constexpr bool string_equals(const char* data, uint32_t length, const char* other, uint32_t other_length) noexcept {
+    if (length != other_length) {
+        return false;
+    }
+
+    for (uint32_t i = 0; i < length; ++i) {
+        if (data[i] != other[i]) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * @brief char_index 番目の UTF-8 文字を取得（String の全派生型で共有する実装）
+ */
+[[nodiscard]] constexpr std::string_view string_char_at(const char* data, uint32_t length, uint32_t char_index) noexcept {
+    const uint32_t byte_pos = utf8::get_char_position(data, length, char_index);
+
+    if (byte_pos >= length) {
+        return std::string_view {};
+    }
+
+    const uint8_t char_len = utf8::get_char_byte_length(static_cast<uint8_t>(data[byte_pos]));
+
+    return std::string_view {data + byte_pos, char_len};
+}
+
+} // namespace detail
+
 /**
  * @brief CRTP文字列基底クラス
  *
- * FixedStringの共通実装を提供。
+ * FixedString・FixedStringRef・StaticString の共通実装を提供。
  * 派生クラスはdata()とbyte_length()を実装する必要がある。
+ * 各メンバーは (data(), byte_length()) を容量に依存しない detail の関数へ渡すだけなので、
+ * 文字列処理の本体は容量ごとにインスタンス化されない。
  */
 template <typename Derived>
 class String {
@@ -25,21 +63,16 @@ public:
         return utf8::get_char_position(derived().data(), derived().byte_length(), char_index);
     }
 
-    [[nodiscard]] constexpr bool is_empty() const noexcept { return derived().byte_length() == 0; }
-
-    [[nodiscard]] constexpr bool equals(const char* str, uint32_t len) const noexcept {
-        if (derived().byte_length() != len) {
-            return false;
-        }
+    /**
+     * @brief char_index 番目の文字を取得（範囲外の場合は空）
+     */
+    [[nodiscard]] constexpr std::string_view get_char(uint32_t char_index) const noexcept {
+        return detail::string_char_at(derived().data(), derived().byte_length(), char_index);
+    }
 
-        for (uint32_t i = 0; i < len; ++i) {
-            if (derived().data()[i] != str[i]) {
-                return false;
-            }
-        }
+    [[nodiscard]] constexpr bool is_empty() const noexcept { return derived().byte_length() == 0; }
 
-        return true;
-    }
+    [[nodiscard]] constexpr bool equals(const char* str, uint32_t len) const noexcept { return detail::string_equals(derived().data(), derived().byte_length(), str, len); }
 
     [[nodiscard]] constexpr bool equals(std::string_view other) const noexcept { return equals(other.data(), static_cast<uint32_t>(other.size())); }
 
@@ -0,0 +1,413 @@
+#pragma once
+
+#include <cstdint>
+#include <omusubi/core/result.hpp>
+
+namespace omusubi {
+
+/**
+ * @brief 時刻 a が時刻 b より前か判定（32bitミリ秒のラップアラウンド対応）
+ *
+ * get_uptime_ms() は約49.7日で0に戻るため、時刻同士を直接比較してはならない。
+ * 差を符号付きで解釈することで、2つの時刻の間隔が約24.8日未満であれば正しく判定できる。
+ */
+[[nodiscard]] constexpr bool is_time_before(uint32_t a, uint32_t b) noexcept {
+    return static_cast<int32_t>(a - b) < 0;
+}
+
+/**
+ * @brief 時刻 deadline に到達済みか判定（ラップアラウンド対応）
+ */
+[[nodiscard]] constexpr bool is_time_reached(uint32_t now, uint32_t deadline) noexcept {
+    return !is_time_before(now, deadline);
+}
+
+/**
+ * @brief TimerWheel に登録したタイマーのハンドル
+ *
+ * スロット番号と世代番号の組。発火・キャンセル後に同じスロットが再利用されても、
+ * 古いハンドルでのキャンセルは無視される。
+ */
+class TimerHandle {
+public:
+    /** @brief 無効なハンドルを表すインデックス */
+    static constexpr uint16_t INVALID_INDEX = 0xFFFF;
+
+    /**
+     * @brief デフォルトコンストラクタ（無効なハンドル）
+     */
+    constexpr TimerHandle() noexcept : index_(INVALID_INDEX), generation_(0) {}
+
+    constexpr TimerHandle(uint16_t index, uint16_t generation) noexcept : index_(index), generation_(generation) {}
+
+    [[nodiscard]] constexpr uint16_t index() const noexcept { return index_; }
+
+    [[nodiscard]] constexpr uint16_t generation() const noexcept { return generation_; }
+
+    [[nodiscard]] constexpr bool is_valid() const noexcept { return index_ != INVALID_INDEX; }
+
+    [[nodiscard]] constexpr bool operator==(TimerHandle other) const noexcept { return index_ == other.index_ && generation_ == other.generation_; }
+
+    [[nodiscard]] constexpr bool operator!=(TimerHandle other) const noexcept { return !(*this == other); }
+
+private:
+    uint16_t index_;
+    uint16_t generation_;
+};
+
+/**
+ * @brief 階層型タイマーホイール
+ *
+ * 「250ms後に再送」「5秒後にタイムアウト」のような期限付き処理を、
+ * 保留中の全エントリを毎ループ走査せずに管理する。
+ *
+ * - 16スロット × 8階層で32bitミリ秒の全範囲を表現する
+ *   （階層 L のスロットは 16^L ミリ秒の幅を持つ）
+ * - schedule / cancel: O(1)（スロットの双方向リストへの挿入・削除）
+ * - advance: 期限切れタイマーの発火と上位階層からの再配置。
+ *   各階層の使用中スロットをビットマップで管理し、空のスロットは飛ばすため、
+ *   長時間呼ばれなかった場合でも経過時間に比例した処理は発生しない
+ * - 時刻は get_uptime_ms() の値をそのまま渡す（ラップアラウンド対応）
+ * - 動的メモリ確保なし
+ *
+ * @tparam T タイマーに付随するデータ（デフォルト構築・ムーブ代入可能であること）
+ * @tparam MaxTimers 同時に登録できる最大タイマー数（65535未満）
+ *
+ * @note スレッドセーフではない。ISRからの schedule / cancel は不可。
+ *
+ * @par 使用例
+ * @code
+ * static TimerWheel<uint16_t, 64> timers;  // データは再送対象のシーケンス番号
+ *
+ * // 送信時
+ * auto handle = timers.schedule(system.get_uptime_ms(), 250, seq);
+ *
+ * // ACK受信時
+ * timers.cancel(handle.value());
+ *
+ * // update() ごと
+ * timers.advance(system.get_uptime_ms(), [](uint16_t& seq) { retransmit(seq); });
+ * @endcode
+ */
+template <typename T, uint16_t MaxTimers>
+class TimerWheel {
+    static_assert(MaxTimers > 0 && MaxTimers < TimerHandle::INVALID_INDEX, "MaxTimers must be in [1, 65534]");
+
+public:
+    /** @brief 1階層あたりのスロット数のビット数 */
+    static constexpr uint32_t SLOT_BITS = 4;
+
+    /** @brief 1階層あたりのスロット数 */
+    static constexpr uint32_t SLOTS = 1U << SLOT_BITS;
+
+    /** @brief 階層数（SLOT_BITS × LEVELS = 32） */
+    static constexpr uint32_t LEVELS = 32 / SLOT_BITS;
+
+    /**
+     * @brief 現在時刻を指定して構築
+     */
+    explicit TimerWheel(uint32_t now_ms = 0) noexcept : current_(now_ms) {
+        for (uint16_t& head : heads_) {
+            head = NONE;
+        }
+        for (uint16_t& bitmap : bitmaps_) {
+            bitmap = 0;
+        }
+        for (uint16_t i = 0; i < MaxTimers; ++i) {
+            nodes_[i].next = (i + 1 < MaxTimers) ? static_cast<uint16_t>(i + 1) : NONE;
+            nodes_[i].bucket = FREE;
+        }
+        free_head_ = 0;
+    }
+
+    TimerWheel(const TimerWheel&) = delete;
+    TimerWheel& operator=(const TimerWheel&) = delete;
+    TimerWheel(TimerWheel&&) = delete;
+    TimerWheel& operator=(TimerWheel&&) = delete;
+    ~TimerWheel() noexcept = default;
+
+    /**
+     * @brief 最大タイマー数を取得
+     */
+    [[nodiscard]] static constexpr uint16_t capacity() noexcept { return MaxTimers; }
+
+    /**
+     * @brief 登録中のタイマー数を取得
+     */
+    [[nodiscard]] uint16_t size() const noexcept { return count_; }
+
+    /**
+     * @brief 登録中のタイマーがないか判定
+     */
+    [[nodiscard]] bool is_empty() const noexcept { return count_ == 0; }
+
+    /**
+     * @brief タイマーを登録
+     *
+     * @param now_ms 現在時刻（get_uptime_ms()）
+     * @param delay_ms 発火までの時間（2^31未満。期限が処理済みの時刻以前になる場合は次の時刻に発火）
+     * @param data 発火時にコールバックへ渡すデータ
+     * @return タイマーのハンドル（登録数が上限の場合は Error::BUFFER_FULL）
+     */
+    Result<TimerHandle> schedule(uint32_t now_ms, uint32_t delay_ms, T data) noexcept {
+        if (free_head_ == NONE) {
+            return Result<TimerHandle>::err(Error::BUFFER_FULL);
+        }
+
+        const uint16_t index = free_head_;
+        Node& node = nodes_[index];
+        free_head_ = node.next;
+
+        node.data = static_cast<T&&>(data);
+        node.expiry = now_ms + delay_ms;
+        if (is_time_before(node.expiry, current_)) {
+            node.expiry = current_;
+        }
+
+        link(index);
+        ++count_;
+
+        return Result<TimerHandle>::ok(TimerHandle(index, node.generation));
+    }
+
+    /**
+     * @brief タイマーをキャンセル
+     *
+     * @return 既に発火済み・キャンセル済み・無効なハンドルの場合false
+     */
+    bool cancel(TimerHandle handle) noexcept {
+        if (!is_active(handle)) {
+            return false;
+        }
+
+        unlink(handle.index());
+        release(handle.index());
+        return true;
+    }
+
+    /**
+     * @brief タイマーが登録中か判定
+     */
+    [[nodiscard]] bool is_active(TimerHandle handle) const noexcept {
+        return handle.index() < MaxTimers && nodes_[handle.index()].bucket != FREE && nodes_[handle.index()].generation == handle.generation();
+    }
+
+    /**
+     * @brief 登録中のタイマーの発火時刻を取得
+     *
+     * @return 発火時刻（登録中でない場合は Error::INVALID_PARAMETER）
+     */
+    [[nodiscard]] Result<uint32_t> expiry(TimerHandle handle) const noexcept {
+        if (!is_active(handle)) {
+            return Result<uint32_t>::err(Error::INVALID_PARAMETER);
+        }
+        return Result<uint32_t>::ok(nodes_[handle.index()].expiry);
+    }
+
+    /**
+     * @brief 現在時刻までに期限が来たタイマーを発火させる
+     *
+     * 発火したタイマーは登録解除されてから on_expire(T&) が呼ばれる。
+     * コールバック内で schedule() / cancel() を呼んでもよい。
+     *
+     * @param now_ms 現在時刻（get_uptime_ms()）
+     * @param on_expire 発火時に呼ばれる関数オブジェクト
+     * @return 発火したタイマー数
+     */
+    template <typename F>
+    // NOLINTNEXTLINE(cppcoreguidelines-missing-std-forward)
+    uint32_t advance(uint32_t now_ms, F&& on_expire) noexcept {
+        uint32_t fired = 0;
+
+        while (count_ > 0 && is_time_reached(now_ms, current_)) {
+            cascade();
+            fired += fire(on_expire);
+
+            const uint64_t distance = next_event_distance();
+            if (distance > static_cast<uint64_t>(now_ms - current_)) {
+                break;
+            }
+            current_ += static_cast<uint32_t>(distance);
+        }
+
+        // 次に処理すべき時刻は now_ms の直後（途中の時刻には処理対象がない）
+        if (is_time_reached(now_ms, current_)) {
+            current_ = now_ms + 1;
+        }
+
+        return fired;
+    }
+
+    /**
+     * @brief 全タイマーを登録解除（コールバックは呼ばない）
+     */
+    void clear() noexcept {
+        for (uint16_t i = 0; i < MaxTimers; ++i) {
+            if (nodes_[i].bucket != FREE) {
+                unlink(i);
+                release(i);
+            }
+        }
+    }
+
+private:
+    static constexpr uint16_t NONE = 0xFFFF;
+    static constexpr uint8_t FREE = 0xFF;
+    static constexpr uint32_t SLOT_MASK = SLOTS - 1;
+
+    struct Node {
+        T data {};
+        uint32_t expiry = 0;
+        uint16_t next = NONE;
+        uint16_t prev = NONE;
+        uint16_t generation = 0;
+        uint8_t bucket = FREE; ///< 階層 × SLOTS + スロット（未使用時は FREE）
+    };
+
+    /**
+     * @brief 発火時刻に応じたスロットへ挿入
+     *
+     * current_ との差が 16^(L+1) 未満となる最小の階層 L に、
+     * 発火時刻の L 桁目（16進）をスロット番号として格納する。
+     */
+    void link(uint16_t index) noexcept {
+        Node& node = nodes_[index];
+        const uint32_t delta = node.expiry - current_;
+
+        uint32_t level = 0;
+        while (level + 1 < LEVELS && (delta >> (SLOT_BITS * (level + 1))) != 0) {
+            ++level;
+        }
+
+        const uint32_t slot = (node.expiry >> (SLOT_BITS * level)) & SLOT_MASK;
+        const auto bucket = static_cast<uint8_t>((level * SLOTS) + slot);
+
+        node.bucket = bucket;
+        node.prev = NONE;
+        node.next = heads_[bucket];
+        if (node.next != NONE) {
+            nodes_[node.next].prev = index;
+        }
+        heads_[bucket] = index;
+        bitmaps_[level] = static_cast<uint16_t>(bitmaps_[level] | (1U << slot));
+    }
+
+    void unlink(uint16_t index) noexcept {
+        Node& node = nodes_[index];
+        const uint8_t bucket = node.bucket;
+
+        if (node.prev != NONE) {
+            nodes_[node.prev].next = node.next;
+        } else {
+            heads_[bucket] = node.next;
+        }
+        if (node.next != NONE) {
+            nodes_[node.next].prev = node.prev;
+        }
+
+        if (heads_[bucket] == NONE) {
+            const uint32_t level = bucket / SLOTS;
+            bitmaps_[level] = static_cast<uint16_t>(bitmaps_[level] & ~(1U << (bucket & SLOT_MASK)));
+        }
+    }
+
+    void release(uint16_t index) noexcept {
+        Node& node = nodes_[index];
+        node.bucket = FREE;
+        node.generation = static_cast<uint16_t>(node.generation + 1);
+        node.next = free_head_;
+        free_head_ = index;
+        --count_;
+    }
+
+    /**
+     * @brief current_ が上位階層のスロット境界であれば、そのスロットのタイマーを下位階層へ再配置
+     *
+     * 上位階層から順に処理し、再配置先がさらに境界上のスロットになる場合も同じ時刻で処理する。
+     */
+    void cascade() noexcept {
+        for (uint32_t level = LEVELS - 1; level > 0; --level) {
+            if ((current_ & ((1U << (SLOT_BITS * level)) - 1)) != 0) {
+                continue;
+            }
+
+            const uint32_t bucket = (level * SLOTS) + ((current_ >> (SLOT_BITS * level)) & SLOT_MASK);
+            uint16_t index = heads_[bucket];
+            heads_[bucket] = NONE;
+            bitmaps_[level] = static_cast<uint16_t>(bitmaps_[level] & ~(1U << (bucket & SLOT_MASK)));
+
+            while (index != NONE) {
+                const uint16_t next = nodes_[index].next;
+                link(index);
+                index = next;
+            }
+        }
+    }
+
+    /**
+     * @brief current_ のスロット（階層0）のタイマーを発火
+     */
+    template <typename F>
+    uint32_t fire(F& on_expire) noexcept {
+        const uint32_t bucket = current_ & SLOT_MASK;
+        uint32_t fired = 0;
+
+        // コールバック内で同じ時刻のタイマーが追加された場合も、このループで発火する
+        while (heads_[bucket] != NONE) {
+            const uint16_t index = heads_[bucket];
+            unlink(index);
+
+            T data = static_cast<T&&>(nodes_[index].data);
+            release(index);
+
+            on_expire(data);
+            ++fired;
+        }
+
+        return fired;
+    }
+
+    /**
+     * @brief current_ の次に処理が必要な時刻までの距離（1以上）
+     *
+     * 各階層の使用中スロットのうち、次に到達するスロット境界までの距離の最小値。
+     */
+    [[nodiscard]] uint64_t next_event_distance() const noexcept {
+        uint64_t best = uint64_t {1} << 32;
+
+        for (uint32_t level = 0; level < LEVELS; ++level) {
+            const uint32_t bitmap = bitmaps_[level];
+            if (bitmap == 0) {
+                continue;
+            }
+
+            const uint32_t shift = SLOT_BITS * level;
+            const uint32_t position = (current_ >> shift) & SLOT_MASK;
+
+            // position の次のスロットから1周分（position 自身は16スロット先として扱う）
+            uint32_t step = 1;
+            while (step <= SLOTS && (bitmap & (1U << ((position + step) & SLOT_MASK))) == 0) {
+                ++step;
+            }
+
+            const uint64_t window_start = static_cast<uint64_t>(current_ >> shift) << shift;
+            const uint64_t target = window_start + (static_cast<uint64_t>(step) << shift);
+            const uint64_t distance = target - current_;
+
+            if (distance < best) {
+                best = distance;
+            }
+        }
+
+        return best;
+    }
+
+    Node nodes_[MaxTimers];
+    uint16_t heads_[LEVELS * SLOTS];
+    uint16_t bitmaps_[LEVELS];
+    uint16_t free_head_ = NONE;
+    uint16_t count_ = 0;
+    uint32_t current_;
+};
+
+} // namespace omusubi
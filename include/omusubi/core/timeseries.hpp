@@ -0,0 +1,583 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <omusubi/core/fixed_buffer.hpp>
+#include <omusubi/core/result.hpp>
+#include <omusubi/core/span.hpp>
+#include <type_traits>
+
+namespace omusubi {
+
+namespace detail {
+
+/**
+ * @brief 下位 count ビットのマスク（count <= 64）
+ */
+[[nodiscard]] constexpr uint64_t low_bit_mask(uint32_t count) noexcept {
+    return count >= 64 ? ~uint64_t {0} : (uint64_t {1} << count) - 1;
+}
+
+/**
+ * @brief 先頭の0ビット数（value != 0）
+ */
+[[nodiscard]] inline uint32_t leading_zero_bits(uint64_t value) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<uint32_t>(__builtin_clzll(value));
+#else
+    uint32_t count = 0;
+    while ((value & (uint64_t {1} << 63)) == 0) {
+        value <<= 1;
+        ++count;
+    }
+    return count;
+#endif
+}
+
+/**
+ * @brief 末尾の0ビット数（value != 0）
+ */
+[[nodiscard]] inline uint32_t trailing_zero_bits(uint64_t value) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<uint32_t>(__builtin_ctzll(value));
+#else
+    uint32_t count = 0;
+    while ((value & 1) == 0) {
+        value >>= 1;
+        ++count;
+    }
+    return count;
+#endif
+}
+
+/**
+ * @brief FixedBuffer へ上位ビットから詰めて書き込むビットライター
+ *
+ * 8ビットたまるごとにバッファへ追加し、端数は flush() で0を詰めて書き出す。
+ * 容量不足になると以降の書き込みは無視される。
+ */
+template <uint32_t Capacity>
+class BitWriter {
+public:
+    explicit BitWriter(FixedBuffer<Capacity>& buffer) noexcept : buffer_(&buffer) {}
+
+    /**
+     * @brief 下位 count ビットを書き込む（count <= 32）
+     */
+    void write(uint64_t bits, uint32_t count) noexcept {
+        pending_ = (pending_ << count) | (bits & low_bit_mask(count));
+        pending_count_ += count;
+        while (pending_count_ >= 8) {
+            pending_count_ -= 8;
+            append(static_cast<uint8_t>(pending_ >> pending_count_));
+        }
+        pending_ &= low_bit_mask(pending_count_);
+    }
+
+    /**
+     * @brief 下位 count ビットを書き込む（count <= 64）
+     */
+    void write_wide(uint64_t bits, uint32_t count) noexcept {
+        if (count > 32) {
+            write(bits >> 32, count - 32);
+            count = 32;
+        }
+        write(bits, count);
+    }
+
+    /**
+     * @brief 端数ビットを0で埋めて書き出す
+     */
+    void flush() noexcept {
+        if (pending_count_ > 0) {
+            append(static_cast<uint8_t>(pending_ << (8 - pending_count_)));
+            pending_ = 0;
+            pending_count_ = 0;
+        }
+    }
+
+    /**
+     * @brief 書き出したバイト数を0に戻す
+     */
+    void reset() noexcept {
+        pending_ = 0;
+        pending_count_ = 0;
+        bytes_written_ = 0;
+        failed_ = false;
+    }
+
+    [[nodiscard]] uint32_t bytes_written() const noexcept { return bytes_written_; }
+
+    [[nodiscard]] bool failed() const noexcept { return failed_; }
+
+private:
+    void append(uint8_t byte) noexcept {
+        if (failed_ || !buffer_->append(byte)) {
+            failed_ = true;
+            return;
+        }
+        ++bytes_written_;
+    }
+
+    FixedBuffer<Capacity>* buffer_;
+    uint64_t pending_ = 0;
+    uint32_t pending_count_ = 0;
+    uint32_t bytes_written_ = 0;
+    bool failed_ = false;
+};
+
+/**
+ * @brief バイト列を上位ビットから読むビットリーダー
+ */
+class BitReader {
+public:
+    explicit BitReader(span<const uint8_t> data) noexcept : data_(data) {}
+
+    /**
+     * @brief count ビットを読む（count <= 64）
+     *
+     * @return 入力が足りない場合false（位置は進めない）
+     */
+    bool read(uint32_t count, uint64_t& out) noexcept {
+        if (count > remaining_bits()) {
+            return false;
+        }
+
+        uint64_t value = 0;
+        while (count > 0) {
+            const uint32_t available = 8 - static_cast<uint32_t>(position_ & 7);
+            const uint32_t take = count < available ? count : available;
+            const uint8_t byte = data_[position_ >> 3];
+            value = (value << take) | ((byte >> (available - take)) & low_bit_mask(take));
+            position_ += take;
+            count -= take;
+        }
+        out = value;
+        return true;
+    }
+
+    /**
+     * @brief 先頭から連続する1ビットを最大 limit 個まで数えて読む
+     *
+     * 0ビットで止まった場合はその0ビットも読み進める。
+     *
+     * @return 入力が足りない場合false
+     */
+    bool read_unary(uint32_t limit, uint32_t& ones) noexcept {
+        ones = 0;
+        while (ones < limit) {
+            uint64_t bit = 0;
+            if (!read(1, bit)) {
+                return false;
+            }
+            if (bit == 0) {
+                return true;
+            }
+            ++ones;
+        }
+        return true;
+    }
+
+    [[nodiscard]] size_t remaining_bits() const noexcept { return data_.size() * 8 - position_; }
+
+private:
+    span<const uint8_t> data_;
+    size_t position_ = 0;
+};
+
+/**
+ * @brief 時刻の delta-of-delta 符号化の区間（Gorilla 方式）
+ *
+ * 接頭辞 '0', '10', '110', '1110', '1111' に続けて、それぞれ 0, 7, 9, 12, 32 ビットの値を置く。
+ */
+inline constexpr uint32_t DOD_BUCKET_BITS[] = {0, 7, 9, 12, 32};
+inline constexpr uint32_t DOD_BUCKET_COUNT = 5;
+
+template <typename T>
+struct XorFloatTraits;
+
+template <>
+struct XorFloatTraits<float> {
+    using Bits = uint32_t;
+    static constexpr uint32_t WIDTH = 32;
+    static constexpr uint32_t FIELD_BITS = 5; ///< 先頭の0ビット数と有効ビット長-1
+};
+
+template <>
+struct XorFloatTraits<double> {
+    using Bits = uint64_t;
+    static constexpr uint32_t WIDTH = 64;
+    static constexpr uint32_t FIELD_BITS = 6;
+};
+
+} // namespace detail
+
+/**
+ * @brief 時刻列の delta-of-delta 符号化器
+ *
+ * 一定周期のサンプリングでは前回との差分の差がほぼ0になり、1サンプルあたり1ビットで表せる。
+ * ブロックの先頭の時刻は32ビットのまま書き、以降は差分の差を可変長のビット列で書く。
+ * 時刻は uint32_t の剰余として扱うため、get_uptime_ms() のラップアラウンドをまたいでも復元できる。
+ *
+ * finish() で端数ビットを書き出してブロックを閉じる。続けて append() すると新しいブロックになる。
+ * 容量不足になると以降の追加は無視され、finish() が Error::BUFFER_FULL を返す。
+ *
+ * @par 使用例
+ * @code
+ * FixedBuffer<128> packet;
+ * TimestampEncoder timestamps(packet);
+ * for (...) {
+ *     timestamps.append(get_uptime_ms());
+ * }
+ * auto size = timestamps.finish();  // 件数 timestamps.count() は別途送る
+ * @endcode
+ */
+template <uint32_t Capacity>
+class TimestampEncoder {
+public:
+    /**
+     * @brief 出力先を指定して構築
+     */
+    explicit TimestampEncoder(FixedBuffer<Capacity>& buffer) noexcept : writer_(buffer) {}
+
+    /**
+     * @brief 時刻を追加
+     *
+     * @return 書き込めた場合true（以前に失敗している場合もfalse）
+     */
+    bool append(uint32_t timestamp) noexcept {
+        if (count_ == 0) {
+            writer_.write(timestamp, 32);
+        } else {
+            const uint32_t delta = timestamp - previous_;
+            const auto dod = static_cast<int32_t>(delta - previous_delta_);
+            write_delta_of_delta(dod);
+            previous_delta_ = delta;
+        }
+        previous_ = timestamp;
+        ++count_;
+        return !writer_.failed();
+    }
+
+    /**
+     * @brief ブロックに追加した時刻の数
+     */
+    [[nodiscard]] uint32_t count() const noexcept { return count_; }
+
+    /**
+     * @brief 端数ビットを書き出してブロックを閉じる
+     *
+     * @return ブロックのバイト数
+     */
+    [[nodiscard]] Result<uint32_t> finish() noexcept {
+        writer_.flush();
+        const bool failed = writer_.failed();
+        const uint32_t size = writer_.bytes_written();
+        writer_.reset();
+        count_ = 0;
+        previous_ = 0;
+        previous_delta_ = 0;
+
+        if (failed) {
+            return Result<uint32_t>::err(Error::BUFFER_FULL);
+        }
+        return Result<uint32_t>::ok(size);
+    }
+
+private:
+    void write_delta_of_delta(int32_t dod) noexcept {
+        if (dod == 0) {
+            writer_.write(0, 1);
+            return;
+        }
+
+        // 区間 [-(2^(n-1) - 1), 2^(n-1)] の値を n ビットで表す
+        for (uint32_t bucket = 1; bucket < detail::DOD_BUCKET_COUNT - 1; ++bucket) {
+            const uint32_t bits = detail::DOD_BUCKET_BITS[bucket];
+            const int32_t limit = int32_t {1} << (bits - 1);
+            if (dod > -limit && dod <= limit) {
+                // 接頭辞は bucket 個の1と0
+                writer_.write(((uint64_t {1} << bucket) - 1) << 1, bucket + 1);
+                writer_.write(static_cast<uint32_t>(dod), bits);
+                return;
+            }
+        }
+
+        writer_.write(0x0F, 4);
+        writer_.write(static_cast<uint32_t>(dod), 32);
+    }
+
+    detail::BitWriter<Capacity> writer_;
+    uint32_t count_ = 0;
+    uint32_t previous_ = 0;
+    uint32_t previous_delta_ = 0;
+};
+
+/**
+ * @brief TimestampEncoder で符号化したブロックの復号器
+ *
+ * ブロックの末尾には0ビットの詰め物があるため、件数は符号化側の count() を別途受け取る。
+ * 途中で終わる入力と、件数分を読み終えた後の next() は Error::BUFFER_EMPTY を返す。
+ */
+class TimestampDecoder {
+public:
+    /**
+     * @brief 入力と時刻の数を指定して構築
+     */
+    TimestampDecoder(span<const uint8_t> data, uint32_t count) noexcept : reader_(data), remaining_(count) {}
+
+    /**
+     * @brief 未読の時刻の数
+     */
+    [[nodiscard]] uint32_t remaining() const noexcept { return remaining_; }
+
+    /**
+     * @brief 次の時刻を読む
+     */
+    [[nodiscard]] Result<uint32_t> next() noexcept {
+        if (remaining_ == 0) {
+            return Result<uint32_t>::err(Error::BUFFER_EMPTY);
+        }
+
+        uint64_t bits = 0;
+        if (first_) {
+            if (!reader_.read(32, bits)) {
+                return Result<uint32_t>::err(Error::BUFFER_EMPTY);
+            }
+            first_ = false;
+            previous_ = static_cast<uint32_t>(bits);
+            --remaining_;
+            return Result<uint32_t>::ok(previous_);
+        }
+
+        uint32_t bucket = 0;
+        if (!reader_.read_unary(detail::DOD_BUCKET_COUNT - 1, bucket)) {
+            return Result<uint32_t>::err(Error::BUFFER_EMPTY);
+        }
+
+        uint32_t dod = 0;
+        const uint32_t width = detail::DOD_BUCKET_BITS[bucket];
+        if (width > 0) {
+            if (!reader_.read(width, bits)) {
+                return Result<uint32_t>::err(Error::BUFFER_EMPTY);
+            }
+            // n ビットの値を (-(2^(n-1)), 2^(n-1)] の範囲へ戻す
+            dod = static_cast<uint32_t>(bits);
+            if (width < 32 && bits > (uint64_t {1} << (width - 1))) {
+                dod -= uint32_t {1} << width;
+            }
+        }
+
+        previous_delta_ += dod;
+        previous_ += previous_delta_;
+        --remaining_;
+        return Result<uint32_t>::ok(previous_);
+    }
+
+private:
+    detail::BitReader reader_;
+    uint32_t remaining_;
+    uint32_t previous_ = 0;
+    uint32_t previous_delta_ = 0;
+    bool first_ = true;
+};
+
+/**
+ * @brief 浮動小数点数列の XOR 符号化器（Gorilla 方式）
+ *
+ * 前の値とのビット単位の XOR を取り、同じ値は1ビット、変化が一部のビットに収まる値は
+ * その有効ビットだけを書く。ゆっくり変化するセンサー値で効果が大きい。
+ *
+ * - XOR が0: '0'
+ * - 有効ビットが前回の範囲に収まる: '10' + 前回の範囲のビット
+ * - それ以外: '11' + 先頭の0ビット数 + 有効ビット長-1 + 有効ビット
+ *
+ * finish() と容量不足の扱いは TimestampEncoder と同じ。
+ *
+ * @tparam Capacity 出力先 FixedBuffer の容量
+ * @tparam T float または double
+ */
+template <uint32_t Capacity, typename T = float>
+class XorFloatEncoder {
+    using Traits = detail::XorFloatTraits<T>;
+    using Bits = typename Traits::Bits;
+
+public:
+    /**
+     * @brief 出力先を指定して構築
+     */
+    explicit XorFloatEncoder(FixedBuffer<Capacity>& buffer) noexcept : writer_(buffer) {}
+
+    /**
+     * @brief 値を追加
+     *
+     * @return 書き込めた場合true（以前に失敗している場合もfalse）
+     */
+    bool append(T value) noexcept {
+        Bits bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+
+        if (count_ == 0) {
+            writer_.write_wide(bits, Traits::WIDTH);
+        } else {
+            write_xor(bits ^ previous_);
+        }
+        previous_ = bits;
+        ++count_;
+        return !writer_.failed();
+    }
+
+    /**
+     * @brief ブロックに追加した値の数
+     */
+    [[nodiscard]] uint32_t count() const noexcept { return count_; }
+
+    /**
+     * @brief 端数ビットを書き出してブロックを閉じる
+     *
+     * @return ブロックのバイト数
+     */
+    [[nodiscard]] Result<uint32_t> finish() noexcept {
+        writer_.flush();
+        const bool failed = writer_.failed();
+        const uint32_t size = writer_.bytes_written();
+        writer_.reset();
+        count_ = 0;
+        previous_ = 0;
+        window_leading_ = 0;
+        window_length_ = 0;
+
+        if (failed) {
+            return Result<uint32_t>::err(Error::BUFFER_FULL);
+        }
+        return Result<uint32_t>::ok(size);
+    }
+
+private:
+    static constexpr uint32_t MAX_LEADING = (uint32_t {1} << Traits::FIELD_BITS) - 1;
+
+    void write_xor(Bits difference) noexcept {
+        if (difference == 0) {
+            writer_.write(0, 1);
+            return;
+        }
+
+        uint32_t leading = detail::leading_zero_bits(difference) - (64 - Traits::WIDTH);
+        const uint32_t trailing = detail::trailing_zero_bits(difference);
+
+        // 前回の範囲に収まれば範囲の記述を省く
+        if (window_length_ > 0 && leading >= window_leading_ && Traits::WIDTH - trailing <= window_leading_ + window_length_) {
+            writer_.write(0x02, 2);
+            writer_.write_wide(difference >> (Traits::WIDTH - window_leading_ - window_length_), window_length_);
+            return;
+        }
+
+        if (leading > MAX_LEADING) {
+            leading = MAX_LEADING;
+        }
+        const uint32_t length = Traits::WIDTH - leading - trailing;
+        writer_.write(0x03, 2);
+        writer_.write(leading, Traits::FIELD_BITS);
+        writer_.write(length - 1, Traits::FIELD_BITS);
+        writer_.write_wide(difference >> trailing, length);
+        window_leading_ = leading;
+        window_length_ = length;
+    }
+
+    detail::BitWriter<Capacity> writer_;
+    uint32_t count_ = 0;
+    Bits previous_ = 0;
+    uint32_t window_leading_ = 0;
+    uint32_t window_length_ = 0;
+};
+
+/**
+ * @brief XorFloatEncoder で符号化したブロックの復号器
+ *
+ * 途中で終わる入力と、件数分を読み終えた後の next() は Error::BUFFER_EMPTY、
+ * 範囲の記述が値の幅を超える入力は Error::INVALID_DATA を返す。
+ *
+ * @tparam T float または double
+ */
+template <typename T = float>
+class XorFloatDecoder {
+    using Traits = detail::XorFloatTraits<T>;
+    using Bits = typename Traits::Bits;
+
+public:
+    /**
+     * @brief 入力と値の数を指定して構築
+     */
+    XorFloatDecoder(span<const uint8_t> data, uint32_t count) noexcept : reader_(data), remaining_(count) {}
+
+    /**
+     * @brief 未読の値の数
+     */
+    [[nodiscard]] uint32_t remaining() const noexcept { return remaining_; }
+
+    /**
+     * @brief 次の値を読む
+     */
+    [[nodiscard]] Result<T> next() noexcept {
+        if (remaining_ == 0) {
+            return Result<T>::err(Error::BUFFER_EMPTY);
+        }
+
+        uint64_t bits = 0;
+        if (first_) {
+            if (!reader_.read(Traits::WIDTH, bits)) {
+                return Result<T>::err(Error::BUFFER_EMPTY);
+            }
+            first_ = false;
+            previous_ = static_cast<Bits>(bits);
+            return emit();
+        }
+
+        uint32_t control = 0;
+        if (!reader_.read_unary(2, control)) {
+            return Result<T>::err(Error::BUFFER_EMPTY);
+        }
+
+        if (control == 0) {
+            return emit();
+        }
+
+        if (control == 2) {
+            uint64_t leading = 0;
+            uint64_t length = 0;
+            if (!reader_.read(Traits::FIELD_BITS, leading) || !reader_.read(Traits::FIELD_BITS, length)) {
+                return Result<T>::err(Error::BUFFER_EMPTY);
+            }
+            if (leading + length + 1 > Traits::WIDTH) {
+                return Result<T>::err(Error::INVALID_DATA);
+            }
+            window_leading_ = static_cast<uint32_t>(leading);
+            window_length_ = static_cast<uint32_t>(length) + 1;
+        } else if (window_length_ == 0) {
+            return Result<T>::err(Error::INVALID_DATA);
+        }
+
+        if (!reader_.read(window_length_, bits)) {
+            return Result<T>::err(Error::BUFFER_EMPTY);
+        }
+        previous_ ^= static_cast<Bits>(bits << (Traits::WIDTH - window_leading_ - window_length_));
+        return emit();
+    }
+
+private:
+    Result<T> emit() noexcept {
+        T value;
+        std::memcpy(&value, &previous_, sizeof(value));
+        --remaining_;
+        return Result<T>::ok(value);
+    }
+
+    detail::BitReader reader_;
+    uint32_t remaining_;
+    Bits previous_ = 0;
+    uint32_t window_leading_ = 0;
+    uint32_t window_length_ = 0;
+    bool first_ = true;
+};
+
+} // namespace omusubi
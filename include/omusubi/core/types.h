@@ -38,7 +38,8 @@ enum class Error : uint8_t {
     PERMISSION_DENIED, ///< 権限なし
     FILE_NOT_FOUND,    ///< ファイルが見つからない
     INVALID_DATA,      ///< 無効なデータ
-    UNKNOWN            ///< 不明なエラー
+    UNKNOWN,           ///< 不明なエラー
+    BUFFER_EMPTY       ///< バッファが空（既存の値の番号を変えないよう末尾に追加）
 };
 
 /**
@@ -0,0 +1,174 @@
+#pragma once
+
+#include <cstdint>
+#include <omusubi/core/fixed_buffer.hpp>
+#include <omusubi/core/result.hpp>
+#include <omusubi/core/span.hpp>
+
+namespace omusubi {
+
+/**
+ * @brief LEB128 可変長整数の最大バイト数（64ビット値）
+ */
+inline constexpr uint32_t VARINT_MAX_SIZE = 10;
+
+/**
+ * @brief 符号付き整数を ZigZag 符号化
+ *
+ * 0, -1, 1, -2, 2, ... を 0, 1, 2, 3, 4, ... に写し、絶対値の小さい負数も短い varint になるようにする。
+ */
+[[nodiscard]] constexpr uint64_t zigzag_encode(int64_t value) noexcept {
+    return (static_cast<uint64_t>(value) << 1) ^ (value < 0 ? ~uint64_t {0} : uint64_t {0});
+}
+
+/**
+ * @brief ZigZag 符号化された値を復元
+ */
+[[nodiscard]] constexpr int64_t zigzag_decode(uint64_t value) noexcept {
+    return static_cast<int64_t>((value >> 1) ^ (~(value & 1) + 1));
+}
+
+/**
+ * @brief 値を LEB128 で符号化したときのバイト数
+ */
+[[nodiscard]] constexpr uint32_t varint_size(uint64_t value) noexcept {
+    uint32_t size = 1;
+    while (value >= 0x80) {
+        value >>= 7;
+        ++size;
+    }
+    return size;
+}
+
+/**
+ * @brief 符号なし整数を LEB128 で書き込む
+ *
+ * @param out VARINT_MAX_SIZE バイト以上の領域
+ * @return 書き込んだバイト数
+ */
+inline uint32_t encode_varint(uint64_t value, uint8_t* out) noexcept {
+    uint32_t size = 0;
+    while (value >= 0x80) {
+        out[size++] = static_cast<uint8_t>(value | 0x80);
+        value >>= 7;
+    }
+    out[size++] = static_cast<uint8_t>(value);
+    return size;
+}
+
+/**
+ * @brief 符号なし整数を LEB128 でバッファに追加
+ *
+ * 全体が収まらない場合は何も追加しない。
+ *
+ * @return 容量が不足している場合false
+ */
+template <uint32_t Capacity>
+bool append_varint(FixedBuffer<Capacity>& buffer, uint64_t value) noexcept {
+    uint8_t bytes[VARINT_MAX_SIZE];
+    const uint32_t size = encode_varint(value, bytes);
+    return buffer.append(span<const uint8_t>(bytes, size));
+}
+
+/**
+ * @brief 符号付き整数を ZigZag + LEB128 でバッファに追加
+ *
+ * @return 容量が不足している場合false
+ */
+template <uint32_t Capacity>
+bool append_signed_varint(FixedBuffer<Capacity>& buffer, int64_t value) noexcept {
+    return append_varint(buffer, zigzag_encode(value));
+}
+
+/**
+ * @brief LEB128 可変長整数の列を先頭から読むリーダー
+ *
+ * 途中で終わる値は Error::BUFFER_EMPTY、10バイトを超える値や64ビットに収まらない値は Error::INVALID_DATA を返す。
+ * エラー時は読み取り位置を進めない。
+ *
+ * @par 使用例
+ * @code
+ * VarintReader reader(span<const uint8_t>(rx, n));
+ * while (!reader.is_end()) {
+ *     auto delta = reader.read_signed();
+ *     if (delta.is_err()) break;
+ *     value += delta.value();
+ * }
+ * @endcode
+ */
+class VarintReader {
+public:
+    /**
+     * @brief 入力を指定して構築
+     */
+    explicit VarintReader(span<const uint8_t> data) noexcept : data_(data) {}
+
+    /**
+     * @brief 現在の読み取り位置を取得
+     */
+    [[nodiscard]] size_t position() const noexcept { return position_; }
+
+    /**
+     * @brief 残りのバイト数を取得
+     */
+    [[nodiscard]] size_t remaining() const noexcept { return data_.size() - position_; }
+
+    /**
+     * @brief 入力の終端に達したか判定
+     */
+    [[nodiscard]] bool is_end() const noexcept { return position_ >= data_.size(); }
+
+    /**
+     * @brief 符号なし整数を読む
+     */
+    [[nodiscard]] Result<uint64_t> read_unsigned() noexcept {
+        if (is_end()) {
+            return Result<uint64_t>::err(Error::BUFFER_EMPTY);
+        }
+
+        // 1バイトの値が大半を占めるため先に処理する
+        const uint8_t first = data_[position_];
+        if (first < 0x80) {
+            ++position_;
+            return Result<uint64_t>::ok(first);
+        }
+
+        uint64_t value = first & 0x7F;
+        size_t index = position_ + 1;
+        for (uint32_t shift = 7; shift < 64; shift += 7) {
+            if (index >= data_.size()) {
+                return Result<uint64_t>::err(Error::BUFFER_EMPTY);
+            }
+
+            const uint8_t byte = data_[index++];
+            // 10バイト目は最下位ビットのみ有効
+            if (shift == 63 && byte > 1) {
+                return Result<uint64_t>::err(Error::INVALID_DATA);
+            }
+
+            value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+            if (byte < 0x80) {
+                position_ = index;
+                return Result<uint64_t>::ok(value);
+            }
+        }
+        return Result<uint64_t>::err(Error::INVALID_DATA);
+    }
+
+    /**
+     * @brief ZigZag 符号化された符号付き整数を読む
+     */
+    [[nodiscard]] Result<int64_t> read_signed() noexcept {
+        auto value = read_unsigned();
+        if (value.is_err()) {
+            return Result<int64_t>::err(value.error());
+        }
+        return Result<int64_t>::ok(zigzag_decode(value.value()));
+    }
+
+private:
+    span<const uint8_t> data_;
+    size_t position_ = 0;
+};
+
+} // namespace omusubi
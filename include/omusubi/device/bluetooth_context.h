@@ -1,5 +1,6 @@
 #pragma once
 
+#include <omusubi/interface/async_stream.h>
 #include <omusubi/interface/connectable.h>
 #include <omusubi/interface/readable.h>
 #include <omusubi/interface/scannable.h>
@@ -10,7 +11,7 @@ namespace omusubi {
 /**
  * @brief Bluetooth Classic通信デバイス
  */
-class BluetoothContext : public ByteReadable, public TextReadable, public ByteWritable, public TextWritable, public Connectable, public Scannable {
+class BluetoothContext : public ByteReadable, public TextReadable, public ByteWritable, public TextWritable, public Connectable, public AsyncByteStream, public Scannable {
 public:
     BluetoothContext() = default;
     ~BluetoothContext() override = default;
@@ -43,6 +44,13 @@ public:
     [[nodiscard]] uint8_t get_found_count() const override = 0;
     [[nodiscard]] std::string_view get_found_name(uint8_t index) const override = 0;
     [[nodiscard]] int32_t get_found_signal_strength(uint8_t index) const override = 0;
+
+protected:
+    // AsyncByteStream interface
+    // 既定は write() / read() をそのまま使う。write() がブロックするドライバはブロックしない送信でオーバーライドすること
+    size_t write_some(span<const uint8_t> data) override { return write(data); }
+    size_t read_some(span<uint8_t> buffer) override { return read(buffer); }
+    [[nodiscard]] bool is_stream_open() const override { return is_connected(); }
 };
 
 } // namespace omusubi
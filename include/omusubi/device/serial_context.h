@@ -1,5 +1,6 @@
 #pragma once
 
+#include <omusubi/interface/async_stream.h>
 #include <omusubi/interface/connectable.h>
 #include <omusubi/interface/readable.h>
 #include <omusubi/interface/writable.h>
@@ -9,7 +10,7 @@ namespace omusubi {
 /**
  * @brief シリアル通信デバイス
  */
-class SerialContext : public ByteReadable, public TextReadable, public ByteWritable, public TextWritable, public Connectable {
+class SerialContext : public ByteReadable, public TextReadable, public ByteWritable, public TextWritable, public Connectable, public AsyncByteStream {
 public:
     SerialContext() = default;
     ~SerialContext() override = default;
@@ -35,6 +36,13 @@ public:
     [[nodiscard]] bool connect() override = 0;
     [[nodiscard]] bool disconnect() override = 0;
     [[nodiscard]] bool is_connected() const override = 0;
+
+protected:
+    // AsyncByteStream interface
+    // 既定は write() / read() をそのまま使う。write() がブロックするドライバはブロックしない送信でオーバーライドすること
+    size_t write_some(span<const uint8_t> data) override { return write(data); }
+    size_t read_some(span<uint8_t> buffer) override { return read(buffer); }
+    [[nodiscard]] bool is_stream_open() const override { return is_connected(); }
 };
 
 } // namespace omusubi
@@ -0,0 +1,187 @@
+#pragma once
+
+#include <omusubi/core/inplace_function.hpp>
+#include <omusubi/core/result.hpp>
+#include <omusubi/core/span.hpp>
+
+namespace omusubi {
+
+/**
+ * @brief 非同期I/Oの完了コールバック
+ *
+ * 成功時は転送したバイト数、失敗時はエラーを受け取る。
+ * ヒープを使わず、ポインタ3つ分までの捕捉を保持できる。
+ */
+using IoCompletion = InplaceFunction<void(Result<size_t>)>;
+
+/**
+ * @brief 非同期バイトストリーム
+ *
+ * async_write() / async_read() は操作を登録するだけで、すぐに戻る。
+ * 転送は poll_async() のたびにブロックしない範囲で進め、完了したら完了コールバックを呼ぶ。
+ * poll_async() はプラットフォームの SystemContext::update() から呼ばれるため、
+ * メインループはセンサーの読み取りや計算と送受信を重ねられる。
+ *
+ * - 送信・受信それぞれ同時に1つまで（状態は固定長、ヒープを使わない）
+ * - 完了コールバックは poll_async() の中からのみ呼ばれる（async_*() の中では呼ばない）。
+ *   コールバックの中で次の async_*() を登録してよい
+ * - 転送中に切断された場合は Error::NOT_CONNECTED で完了する
+ * - バッファは完了するまで呼び出し側が保持すること
+ *
+ * 実装クラスは write_some() / read_some() をブロックしない転送で実装する。
+ *
+ * @par 使用例
+ * @code
+ * serial->async_write(span<const uint8_t>(frame, size), [](Result<size_t> result) {
+ *     if (result.is_err()) { handle_error(result.error()); }
+ * });
+ * serial->async_read(span<uint8_t>(rx), [&](Result<size_t> result) { parse(rx, result.value()); });
+ *
+ * while (true) {
+ *     ctx.update();       // 送受信を進め、完了コールバックを呼ぶ
+ *     sample_sensors();   // その間も他の処理を続ける
+ * }
+ * @endcode
+ */
+class AsyncByteStream {
+public:
+    AsyncByteStream() = default;
+    virtual ~AsyncByteStream() = default;
+    AsyncByteStream(const AsyncByteStream&) = delete;
+    AsyncByteStream& operator=(const AsyncByteStream&) = delete;
+    AsyncByteStream(AsyncByteStream&&) = delete;
+    AsyncByteStream& operator=(AsyncByteStream&&) = delete;
+
+    /**
+     * @brief 非同期送信を開始
+     *
+     * data をすべて送り終えたとき、送ったバイト数で完了する。
+     *
+     * @return 送信中の操作がある場合・completion が空の場合false（登録しない）
+     */
+    bool async_write(span<const uint8_t> data, IoCompletion completion) noexcept {
+        if (write_.completion || !completion) {
+            return false;
+        }
+        write_.data = data;
+        write_.done = 0;
+        write_.completion = static_cast<IoCompletion&&>(completion);
+        return true;
+    }
+
+    /**
+     * @brief 非同期受信を開始
+     *
+     * 1バイト以上受信した時点で、受信したバイト数（buffer.size() 以下）で完了する。
+     *
+     * @return 受信中の操作がある場合・completion が空の場合・buffer が空の場合false（登録しない）
+     */
+    bool async_read(span<uint8_t> buffer, IoCompletion completion) noexcept {
+        if (read_.completion || !completion || buffer.empty()) {
+            return false;
+        }
+        read_.buffer = buffer;
+        read_.completion = static_cast<IoCompletion&&>(completion);
+        return true;
+    }
+
+    [[nodiscard]] bool is_write_pending() const noexcept { return static_cast<bool>(write_.completion); }
+
+    [[nodiscard]] bool is_read_pending() const noexcept { return static_cast<bool>(read_.completion); }
+
+    /**
+     * @brief 登録中の操作を完了コールバックを呼ばずに取り消す
+     */
+    void cancel_async() noexcept {
+        write_.completion.reset();
+        read_.completion.reset();
+    }
+
+    /**
+     * @brief 登録中の送受信を進め、完了した操作のコールバックを呼ぶ
+     *
+     * @return 呼んだ完了コールバックの数
+     */
+    uint32_t poll_async() {
+        uint32_t completed = 0;
+
+        if (write_.completion) {
+            if (!is_stream_open()) {
+                complete(write_.completion, Result<size_t>::err(Error::NOT_CONNECTED));
+                ++completed;
+            } else {
+                while (write_.done < write_.data.size()) {
+                    const size_t n = write_some(write_.data.subspan(write_.done, write_.data.size() - write_.done));
+                    if (n == 0) {
+                        break;
+                    }
+                    write_.done += n;
+                }
+                if (write_.done == write_.data.size()) {
+                    complete(write_.completion, Result<size_t>::ok(write_.done));
+                    ++completed;
+                }
+            }
+        }
+
+        if (read_.completion) {
+            if (!is_stream_open()) {
+                complete(read_.completion, Result<size_t>::err(Error::NOT_CONNECTED));
+                ++completed;
+            } else {
+                const size_t n = read_some(read_.buffer);
+                if (n > 0) {
+                    complete(read_.completion, Result<size_t>::ok(n));
+                    ++completed;
+                }
+            }
+        }
+
+        return completed;
+    }
+
+protected:
+    /**
+     * @brief ブロックせずに送れるだけ送る
+     *
+     * @return 送ったバイト数（すぐに送れない場合は0）
+     */
+    virtual size_t write_some(span<const uint8_t> data) = 0;
+
+    /**
+     * @brief ブロックせずに受信済みのデータを読む
+     *
+     * @return 読んだバイト数（受信データがない場合は0）
+     */
+    virtual size_t read_some(span<uint8_t> buffer) = 0;
+
+    /**
+     * @brief 転送できる状態か（接続中か）
+     */
+    [[nodiscard]] virtual bool is_stream_open() const = 0;
+
+private:
+    /**
+     * @brief 完了コールバックを取り出してから呼ぶ（コールバックの中で次の操作を登録できるように）
+     */
+    static void complete(IoCompletion& slot, Result<size_t> result) {
+        IoCompletion completion = static_cast<IoCompletion&&>(slot);
+        completion(static_cast<Result<size_t>&&>(result));
+    }
+
+    struct PendingWrite {
+        span<const uint8_t> data;
+        size_t done = 0;
+        IoCompletion completion;
+    };
+
+    struct PendingRead {
+        span<uint8_t> buffer;
+        IoCompletion completion;
+    };
+
+    PendingWrite write_;
+    PendingRead read_;
+};
+
+} // namespace omusubi
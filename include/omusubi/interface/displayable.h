@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include <omusubi/core/display_width.hpp>
 #include <string_view>
 
 namespace omusubi {
@@ -19,6 +20,14 @@ public:
 
     /** @brief 文字列を表示 */
     virtual void display(std::string_view text) = 0;
+
+    /**
+     * @brief 表示幅 max_columns に収まるよう切り詰めて表示
+     *
+     * 全角文字は2桁として数え、文字の途中で切れることはない。
+     * デフォルト実装は truncate_to_width() の結果を display() に渡す。
+     */
+    virtual void display_fit(std::string_view text, uint32_t max_columns) { display(truncate_to_width(text, max_columns)); }
 };
 
 } // namespace omusubi
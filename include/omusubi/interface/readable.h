@@ -21,6 +21,41 @@ public:
 
     /** @brief 利用可能なバイト数を取得 */
     [[nodiscard]] virtual size_t available() const = 0;
+
+    /**
+     * @brief 読み取り可能な連続領域をコピーせずに参照
+     *
+     * ドライバの内部バッファを直接返す。プロトコルデコーダはこの領域をその場で解析し、
+     * 処理したバイト数だけ consume() で進める。
+     * 返した領域は次に consume() / read() を呼ぶまで有効。
+     * 内部バッファが折り返している場合、返すのは折り返し位置までの部分のみ。
+     *
+     * デフォルト実装は空のspanを返す（ゼロコピー非対応）。その場合は read() を使用すること。
+     */
+    [[nodiscard]] virtual span<const uint8_t> peek() { return span<const uint8_t>(); }
+
+    /**
+     * @brief 先頭から指定バイト数を破棄
+     *
+     * デフォルト実装は read() で読み捨てる。
+     *
+     * @return 破棄したバイト数
+     */
+    virtual size_t consume(size_t count) {
+        uint8_t discard[32];
+        size_t total = 0;
+
+        while (total < count) {
+            const size_t chunk = (count - total < sizeof(discard)) ? count - total : sizeof(discard);
+            const size_t n = read(span<uint8_t>(discard, chunk));
+            if (n == 0) {
+                break;
+            }
+            total += n;
+        }
+
+        return total;
+    }
 };
 
 /**
@@ -18,6 +18,27 @@ public:
 
     /** @brief バイト列を書き込む */
     virtual size_t write(span<const uint8_t> data) = 0;
+
+    /**
+     * @brief 複数のバイト列を順に書き込む（ギャザー書き込み）
+     *
+     * ヘッダ・ペイロード・CRCのように分かれたバッファを、1つにまとめるコピーなしで送信する。
+     * デフォルト実装は write() を順に呼び、途中で書き込みが不足した場合はそこで終了する。
+     * ギャザーDMAや writev(2) を使えるドライバはオーバーライドすること。
+     *
+     * @return 書き込んだ総バイト数
+     */
+    virtual size_t writev(span<const span<const uint8_t>> buffers) {
+        size_t total = 0;
+        for (const span<const uint8_t>& buffer : buffers) {
+            const size_t written = write(buffer);
+            total += written;
+            if (written < buffer.size()) {
+                break;
+            }
+        }
+        return total;
+    }
 };
 
 /**
@@ -38,6 +59,25 @@ public:
 
     /** @brief テキストを書き込む */
     virtual size_t write_text(span<const char> text) = 0;
+
+    /**
+     * @brief 複数のテキストを順に書き込む（ギャザー書き込み）
+     *
+     * デフォルト実装は write_text() を順に呼び、途中で書き込みが不足した場合はそこで終了する。
+     *
+     * @return 書き込んだ総バイト数
+     */
+    virtual size_t write_textv(span<const span<const char>> parts) {
+        size_t total = 0;
+        for (const span<const char>& part : parts) {
+            const size_t written = write_text(part);
+            total += written;
+            if (written < part.size()) {
+                break;
+            }
+        }
+        return total;
+    }
 };
 
 } // namespace omusubi
@@ -7,21 +7,46 @@
 #include "context/scannable_context.h"
 #include "context/sensor_context.h"
 #include "context/system_info_context.h"
+#include "core/arena.hpp"
+#include "core/cbor.hpp"
+#include "core/crc.hpp"
+#include "core/display_width.hpp"
 #include "core/fixed_buffer.hpp"
+#include "core/fixed_map.hpp"
 #include "core/fixed_string.hpp"
+#include "core/fixed_string_ref.hpp"
+#include "core/fixed_vector.hpp"
 #include "core/format.hpp"
+#include "core/framing.hpp"
+#include "core/hash.hpp"
+#include "core/inplace_function.hpp"
+#include "core/intern_pool.hpp"
+#include "core/json.hpp"
+#include "core/line_reader.hpp"
 #include "core/log_level.h"
 #include "core/logger.hpp"
+#include "core/lz.hpp"
+#include "core/mpmc_queue.hpp"
+#include "core/object_pool.hpp"
+#include "core/packed.hpp"
+#include "core/parse.hpp"
+#include "core/priority_queue.hpp"
 #include "core/result.hpp"
+#include "core/ring_buffer.hpp"
+#include "core/segmented_string.hpp"
 #include "core/span.hpp"
 #include "core/static_string.hpp"
 #include "core/string_base.hpp"
 #include "core/string_view.h"
+#include "core/timer_wheel.hpp"
+#include "core/timeseries.hpp"
 #include "core/types.h"
+#include "core/varint.hpp"
 #include "device/ble_context.h"
 #include "device/bluetooth_context.h"
 #include "device/serial_context.h"
 #include "device/wifi_context.h"
+#include "interface/async_stream.h"
 #include "interface/connectable.h"
 #include "interface/displayable.h"
 #include "interface/log_output.h"
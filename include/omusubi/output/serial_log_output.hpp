@@ -2,7 +2,6 @@
 
 #include <omusubi/device/serial_context.h>
 
-#include <omusubi/core/format.hpp>
 #include <omusubi/core/logger.hpp>
 
 namespace omusubi {
@@ -12,6 +11,9 @@ namespace omusubi {
  *
  * SerialContextを通じてログをシリアル出力します。
  * フォーマット: [LEVEL] message
+ *
+ * プレフィックスとメッセージは1つのバッファにまとめず、write_textv() で順に送信します。
+ * メッセージ長に上限はありません。
  */
 class SerialLogOutput : public LogOutput {
 private:
@@ -34,9 +36,15 @@ public:
             return;
         }
 
-        // format()を使用してログメッセージを整形
-        auto formatted = format("[{}] {}\r\n", log_level_to_string(level), message);
-        serial_->write_text(span<const char>(formatted.data(), formatted.byte_length()));
+        const std::string_view level_name = log_level_to_string(level);
+        const span<const char> parts[] = {
+            span<const char>("[", 1),
+            span<const char>(level_name.data(), level_name.size()),
+            span<const char>("] ", 2),
+            span<const char>(message.data(), message.size()),
+            span<const char>("\r\n", 2),
+        };
+        serial_->write_textv(span<const span<const char>>(parts));
     }
 
     /**
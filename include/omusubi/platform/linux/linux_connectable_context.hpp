@@ -0,0 +1,75 @@
+#pragma once
+
+#include <omusubi/context/connectable_context.h>
+#include <omusubi/platform/linux/linux_serial_context.hpp>
+
+namespace omusubi::platform::linux_host {
+
+/**
+ * @brief Linux の接続可能なデバイス
+ *
+ * シリアルポート0〜2（既定は /dev/ttyUSB0〜2）を持つ。Bluetooth・WiFi・BLE は未対応で nullptr を返す。
+ */
+class LinuxConnectableContext : public ConnectableContext {
+public:
+    /** @brief シリアルポート数 */
+    static constexpr uint8_t SERIAL_COUNT = 3;
+
+    LinuxConnectableContext() noexcept = default;
+    ~LinuxConnectableContext() override = default;
+    LinuxConnectableContext(const LinuxConnectableContext&) = delete;
+    LinuxConnectableContext& operator=(const LinuxConnectableContext&) = delete;
+    LinuxConnectableContext(LinuxConnectableContext&&) = delete;
+    LinuxConnectableContext& operator=(LinuxConnectableContext&&) = delete;
+
+    [[nodiscard]] SerialContext* get_serial_context(uint8_t port) const override {
+        switch (port) {
+            case 0:
+                return &serial0_;
+            case 1:
+                return &serial1_;
+            case 2:
+                return &serial2_;
+            default:
+                return nullptr;
+        }
+    }
+
+    [[nodiscard]] uint8_t get_serial_count() const override { return SERIAL_COUNT; }
+
+    [[nodiscard]] BluetoothContext* get_bluetooth_context() const override { return nullptr; }
+
+    [[nodiscard]] WiFiContext* get_wifi_context() const override { return nullptr; }
+
+    [[nodiscard]] BLEContext* get_ble_context() const override { return nullptr; }
+
+    /**
+     * @brief 接続中のシリアルポートの受信データを取り込み、非同期I/Oを進める
+     *
+     * 完了した非同期I/Oの完了コールバックはここから呼ばれる。
+     */
+    void update() {
+        serial0_.update();
+        serial1_.update();
+        serial2_.update();
+        serial0_.poll_async();
+        serial1_.poll_async();
+        serial2_.poll_async();
+    }
+
+    /**
+     * @brief すべてのシリアルポートを切断
+     */
+    void disconnect_all() noexcept {
+        (void)serial0_.disconnect();
+        (void)serial1_.disconnect();
+        (void)serial2_.disconnect();
+    }
+
+private:
+    mutable LinuxSerialContext serial0_ {0};
+    mutable LinuxSerialContext serial1_ {1};
+    mutable LinuxSerialContext serial2_ {2};
+};
+
+} // namespace omusubi::platform::linux_host
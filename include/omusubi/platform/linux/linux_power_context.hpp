@@ -0,0 +1,29 @@
+#pragma once
+
+#include <omusubi/context/power_context.h>
+
+namespace omusubi::platform::linux_host {
+
+/**
+ * @brief Linux の電源状態
+ *
+ * /sys/class/power_supply/BAT0 の capacity と status を読む。
+ * バッテリーがない場合は外部電源・100% とする。
+ */
+class LinuxPowerContext : public PowerContext {
+public:
+    LinuxPowerContext() noexcept = default;
+    ~LinuxPowerContext() override = default;
+    LinuxPowerContext(const LinuxPowerContext&) = delete;
+    LinuxPowerContext& operator=(const LinuxPowerContext&) = delete;
+    LinuxPowerContext(LinuxPowerContext&&) = delete;
+    LinuxPowerContext& operator=(LinuxPowerContext&&) = delete;
+
+    [[nodiscard]] PowerState get_power_state() const override;
+
+    [[nodiscard]] uint8_t get_battery_level() const override;
+
+    [[nodiscard]] bool is_charging() const override;
+};
+
+} // namespace omusubi::platform::linux_host
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <omusubi/context/scannable_context.h>
+
+namespace omusubi::platform::linux_host {
+
+/**
+ * @brief Linux のスキャン可能なデバイス（未対応、すべて nullptr）
+ */
+class LinuxScannableContext : public ScannableContext {
+public:
+    LinuxScannableContext() noexcept = default;
+    ~LinuxScannableContext() override = default;
+    LinuxScannableContext(const LinuxScannableContext&) = delete;
+    LinuxScannableContext& operator=(const LinuxScannableContext&) = delete;
+    LinuxScannableContext(LinuxScannableContext&&) = delete;
+    LinuxScannableContext& operator=(LinuxScannableContext&&) = delete;
+
+    [[nodiscard]] BluetoothContext* get_bluetooth_context() const override { return nullptr; }
+
+    [[nodiscard]] WiFiContext* get_wifi_context() const override { return nullptr; }
+
+    [[nodiscard]] BLEContext* get_ble_context() const override { return nullptr; }
+};
+
+} // namespace omusubi::platform::linux_host
@@ -0,0 +1,162 @@
+#pragma once
+
+#include <cstdint>
+#include <omusubi/core/fixed_string.hpp>
+#include <omusubi/core/ring_buffer.hpp>
+#include <omusubi/device/serial_context.h>
+#include <string_view>
+
+namespace omusubi::platform::linux_host {
+
+/**
+ * @brief Linux の termios によるシリアルポート
+ *
+ * デバイスファイル（/dev/ttyUSB0、openpty() のスレーブなど）をノンブロッキングで開き、
+ * 生（raw）モード・8N1・指定のボーレートに設定する。
+ *
+ * - 受信は epoll で読み取り可能になったデータをリングバッファへ直接読み込む。
+ *   read() / available() / peek() / update() のたびに取り込み、peek() はリングバッファの領域をコピーせずに返す
+ * - 送信はカーネルのバッファが一杯のとき、書き込み可能になるまで epoll で待つ（待つ間も受信は取り込む）。
+ *   set_write_timeout() の時間を過ぎると書き込めた分だけを返す
+ * - writev() は writev(2) で1回のシステムコールにまとめる
+ * - async_write() / async_read() はカーネルのバッファを待たずに進め、SystemContext::update() で完了を通知する
+ *
+ * @par 使用例
+ * @code
+ * LinuxSerialContext serial(0);
+ * serial.set_device("/dev/ttyUSB0");
+ * serial.set_baud_rate(115200);
+ * if (serial.connect()) {
+ *     serial.write_text(span<const char>("hello\n", 6));
+ *     if (serial.wait_readable(100)) {
+ *         size_t n = serial.read(span<uint8_t>(rx));
+ *     }
+ * }
+ * @endcode
+ */
+class LinuxSerialContext : public SerialContext {
+public:
+    /** @brief 受信リングバッファの大きさ */
+    static constexpr uint32_t RX_BUFFER_SIZE = 4096;
+
+    /** @brief デバイスパスの最大長 */
+    static constexpr uint32_t MAX_DEVICE_PATH = 64;
+
+    /**
+     * @brief ポート番号を指定して構築
+     *
+     * デバイスパスの既定値は /dev/ttyUSB<port>。
+     */
+    explicit LinuxSerialContext(uint8_t port) noexcept;
+    ~LinuxSerialContext() override;
+    LinuxSerialContext(const LinuxSerialContext&) = delete;
+    LinuxSerialContext& operator=(const LinuxSerialContext&) = delete;
+    LinuxSerialContext(LinuxSerialContext&&) = delete;
+    LinuxSerialContext& operator=(LinuxSerialContext&&) = delete;
+
+    // ========================================
+    // 設定（connect() の前に呼ぶ）
+    // ========================================
+
+    /**
+     * @brief デバイスパスを設定
+     *
+     * @return 長すぎる場合false
+     */
+    bool set_device(std::string_view path) noexcept;
+
+    /**
+     * @brief ボーレートを設定（termios の標準値のみ、既定 115200）
+     */
+    void set_baud_rate(uint32_t baud_rate) noexcept { baud_rate_ = baud_rate; }
+
+    /**
+     * @brief 送信でカーネルのバッファの空きを待つ時間の上限（ミリ秒、既定 1000）
+     */
+    void set_write_timeout(uint32_t timeout_ms) noexcept { write_timeout_ms_ = timeout_ms; }
+
+    [[nodiscard]] std::string_view get_device() const noexcept { return device_.view(); }
+
+    [[nodiscard]] uint32_t get_baud_rate() const noexcept { return baud_rate_; }
+
+    // ========================================
+    // 受信
+    // ========================================
+
+    /**
+     * @brief カーネルに届いている受信データをリングバッファへ取り込む（ブロックしない）
+     *
+     * @return 取り込んだバイト数
+     */
+    size_t update() noexcept;
+
+    /**
+     * @brief 受信データが届くまで待つ
+     *
+     * @param timeout_ms 待つ時間の上限（ミリ秒）
+     * @return 読み取れるデータがある場合true
+     */
+    bool wait_readable(uint32_t timeout_ms) noexcept;
+
+    // ByteReadable interface
+    size_t read(span<uint8_t> buffer) override;
+    [[nodiscard]] size_t available() const override;
+    [[nodiscard]] span<const uint8_t> peek() override;
+    size_t consume(size_t count) override;
+
+    /**
+     * @brief 改行までの1行を読み取る
+     *
+     * 改行（\n、直前の \r も除く）までを buffer にコピーする。改行がまだ届いていない場合は何も読まずに0を返す。
+     * 1行が buffer に収まらない場合、または改行がないまま受信バッファ（RX_BUFFER_SIZE）が一杯になった場合は
+     * そこで区切る。
+     */
+    size_t read_line(span<char> buffer) override;
+
+    // ========================================
+    // 送信
+    // ========================================
+
+    size_t write(span<const uint8_t> data) override;
+    size_t writev(span<const span<const uint8_t>> buffers) override;
+    size_t write_text(span<const char> text) override;
+
+    // ========================================
+    // 接続
+    // ========================================
+
+    /**
+     * @brief デバイスを開いて termios を設定
+     *
+     * @return 開けない場合・ボーレートが標準値でない場合false
+     */
+    [[nodiscard]] bool connect() override;
+    [[nodiscard]] bool disconnect() override;
+    [[nodiscard]] bool is_connected() const override { return fd_ >= 0; }
+
+protected:
+    // AsyncByteStream interface（カーネルのバッファが一杯なら待たずに戻る）
+    size_t write_some(span<const uint8_t> data) override;
+
+private:
+    /**
+     * @brief 書き込み可能になるまで待つ
+     */
+    bool wait_writable(uint32_t timeout_ms) noexcept;
+
+    /**
+     * @brief writev(2) で書き込む
+     *
+     * @param timeout_ms カーネルのバッファの空きを待つ時間の上限（0 なら待たない）
+     */
+    size_t transmit(span<const span<const uint8_t>> buffers, uint32_t timeout_ms) noexcept;
+
+    FixedString<MAX_DEVICE_PATH> device_;
+    uint32_t baud_rate_ = 115200;
+    uint32_t write_timeout_ms_ = 1000;
+    int fd_ = -1;
+    int epoll_fd_ = -1;
+    RingBuffer<uint8_t, RX_BUFFER_SIZE> rx_;
+};
+
+} // namespace omusubi::platform::linux_host
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <omusubi/context/input_context.h>
+#include <omusubi/context/output_context.h>
+#include <omusubi/context/sensor_context.h>
+#include <omusubi/platform/linux/linux_connectable_context.hpp>
+#include <omusubi/platform/linux/linux_power_context.hpp>
+#include <omusubi/platform/linux/linux_scannable_context.hpp>
+#include <omusubi/platform/linux/linux_system_info_context.hpp>
+#include <omusubi/system_context.h>
+
+namespace omusubi::platform::linux_host {
+
+/**
+ * @brief Linux ホスト上の SystemContext
+ *
+ * 実機なしでアプリケーションや I/O スタック全体を動かし、スループットやレイテンシを計測するための実装。
+ * 時刻はすべて CLOCK_MONOTONIC を使う。
+ *
+ * - begin(): 稼働時間の起点を設定
+ * - update(): 接続中のシリアルポートの受信データを取り込み、非同期I/Oの完了コールバックを呼ぶ
+ * - delay(): clock_nanosleep(2) で待つ（シグナルで中断されても残りを待つ）
+ * - reset(): シリアルポートをすべて切断し、稼働時間の起点を戻す（プロセスは再起動しない）
+ *
+ * センサー・入力・出力は未対応（空のコンテキスト）。
+ */
+class LinuxSystemContext : public SystemContext {
+public:
+    LinuxSystemContext() noexcept = default;
+    ~LinuxSystemContext() override = default;
+    LinuxSystemContext(const LinuxSystemContext&) = delete;
+    LinuxSystemContext& operator=(const LinuxSystemContext&) = delete;
+    LinuxSystemContext(LinuxSystemContext&&) = delete;
+    LinuxSystemContext& operator=(LinuxSystemContext&&) = delete;
+
+    void begin() override;
+    void update() override;
+    void delay(uint32_t ms) override;
+    void reset() override;
+
+    [[nodiscard]] ConnectableContext& get_connectable_context() const override { return connectable_; }
+
+    [[nodiscard]] ScannableContext& get_scannable_context() const override { return scannable_; }
+
+    [[nodiscard]] SensorContext& get_sensor_context() const override { return sensor_; }
+
+    [[nodiscard]] InputContext& get_input_context() const override { return input_; }
+
+    [[nodiscard]] OutputContext& get_output_context() const override { return output_; }
+
+    [[nodiscard]] SystemInfoContext& get_system_info_context() const override { return system_info_; }
+
+    [[nodiscard]] PowerContext& get_power_context() const override { return power_; }
+
+private:
+    mutable LinuxConnectableContext connectable_;
+    mutable LinuxScannableContext scannable_;
+    mutable SensorContext sensor_;
+    mutable InputContext input_;
+    mutable OutputContext output_;
+    mutable LinuxSystemInfoContext system_info_;
+    mutable LinuxPowerContext power_;
+};
+
+} // namespace omusubi::platform::linux_host
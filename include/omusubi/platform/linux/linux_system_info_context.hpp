@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstdint>
+#include <omusubi/context/system_info_context.h>
+#include <omusubi/core/fixed_string.hpp>
+
+namespace omusubi::platform::linux_host {
+
+/**
+ * @brief Linux のシステム情報
+ *
+ * - デバイス名: ホスト名（uname(2)）
+ * - チップID: /etc/machine-id の先頭64ビット（読めない場合は gethostid()）
+ * - 稼働時間: CLOCK_MONOTONIC による restart_uptime() からの経過時間
+ * - 空きメモリ: sysinfo(2) の空き物理メモリ（4GB で飽和）
+ */
+class LinuxSystemInfoContext : public SystemInfoContext {
+public:
+    LinuxSystemInfoContext() noexcept;
+    ~LinuxSystemInfoContext() override = default;
+    LinuxSystemInfoContext(const LinuxSystemInfoContext&) = delete;
+    LinuxSystemInfoContext& operator=(const LinuxSystemInfoContext&) = delete;
+    LinuxSystemInfoContext(LinuxSystemInfoContext&&) = delete;
+    LinuxSystemInfoContext& operator=(LinuxSystemInfoContext&&) = delete;
+
+    [[nodiscard]] std::string_view get_device_name() const override { return device_name_.view(); }
+
+    [[nodiscard]] std::string_view get_firmware_version() const override;
+
+    [[nodiscard]] uint64_t get_chip_id() const override { return chip_id_; }
+
+    [[nodiscard]] uint32_t get_uptime_ms() const override;
+
+    [[nodiscard]] uint32_t get_free_memory() const override;
+
+    /**
+     * @brief 稼働時間の起点を現在時刻にする
+     */
+    void restart_uptime() noexcept;
+
+private:
+    FixedString<64> device_name_;
+    uint64_t chip_id_ = 0;
+    uint64_t start_ns_ = 0;
+};
+
+} // namespace omusubi::platform::linux_host
@@ -0,0 +1,494 @@
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <omusubi/core/ring_buffer.hpp>
+#include <omusubi/device/serial_context.h>
+
+namespace omusubi::platform::loopback {
+
+/**
+ * @brief 仮想時計（ナノ秒）
+ *
+ * LoopbackSerialContext の伝送はこの時計だけを基準にする。実時間を使わないため、
+ * 同じ設定・同じ操作列なら何度実行しても同じ結果になる。時計はテスト側が advance() で進める。
+ */
+class VirtualClock {
+public:
+    VirtualClock() noexcept = default;
+    ~VirtualClock() noexcept = default;
+    VirtualClock(const VirtualClock&) = delete;
+    VirtualClock& operator=(const VirtualClock&) = delete;
+    VirtualClock(VirtualClock&&) = delete;
+    VirtualClock& operator=(VirtualClock&&) = delete;
+
+    [[nodiscard]] uint64_t now_ns() const noexcept { return now_ns_; }
+
+    [[nodiscard]] uint64_t now_us() const noexcept { return now_ns_ / 1000; }
+
+    /**
+     * @brief 現在時刻（ミリ秒、get_uptime_ms() と同じく約49.7日で0に戻る）
+     */
+    [[nodiscard]] uint32_t now_ms() const noexcept { return static_cast<uint32_t>(now_ns_ / 1000000); }
+
+    void advance_ns(uint64_t ns) noexcept { now_ns_ += ns; }
+
+    void advance_us(uint64_t us) noexcept { now_ns_ += us * 1000; }
+
+    void advance_ms(uint64_t ms) noexcept { now_ns_ += ms * 1000000; }
+
+    /**
+     * @brief 指定時刻まで進める（過去の時刻なら何もしない）
+     */
+    void advance_to(uint64_t ns) noexcept {
+        if (ns > now_ns_) {
+            now_ns_ = ns;
+        }
+    }
+
+private:
+    uint64_t now_ns_ = 0;
+};
+
+/**
+ * @brief 伝送路の特性（送信方向ごと）
+ */
+struct LinkConfig {
+    uint32_t baud_rate = 115200; ///< ボーレート（1バイト = 10ビット（8N1）、0 なら帯域無制限）
+    uint32_t latency_us = 0;     ///< 1バイトを送り終えてから相手に届くまでの固定遅延
+    uint32_t jitter_us = 0;      ///< バーストごとに加える遅延の揺らぎ（0〜jitter_us の一様分布、順序は保つ）
+    double bit_error_rate = 0.0; ///< データビットごとの反転確率
+    uint32_t seed = 1;           ///< 揺らぎとビット誤りの擬似乱数の種
+};
+
+/**
+ * @brief 伝送路の統計情報（送信方向ごと）
+ */
+struct LinkStats {
+    uint64_t bytes_sent;     ///< 送信したバイト数
+    uint64_t bytes_lost;     ///< 相手が切断中で失われたバイト数
+    uint64_t bytes_rejected; ///< 相手の受信バッファが一杯で受け付けなかったバイト数
+    uint64_t bit_errors;     ///< 反転させたビット数
+};
+
+/**
+ * @brief プロセス内の仮想シリアルポート（ループバック・伝送路エミュレーション）
+ *
+ * 2つを link() でつなぐと、一方の write() が仮想時計に従って他方の read() に届く。
+ * 単体ではループバックプラグ（自分の送信が自分に届く）として動く。
+ * フレーミング・ログ・プロトコルのコードを、実機なしで帯域・遅延の条件を変えて測定するために使う。
+ *
+ * - 送信はボーレートで直列化する。1バイト目は (送信開始 + 1バイト時間 + 遅延 + 揺らぎ) に届き、
+ *   以降は1バイト時間ごとに届く。送信路が使用中なら前の送信が終わってから送り始める
+ * - 揺らぎは送信路が空いた状態から送り始めるとき（バーストの先頭）に1回引く。
+ *   使用中の送信路に続けた write() は同じバーストとして直前のバイトの直後に届く。到着順は入れ替わらない
+ * - ビット誤りは送信時に幾何分布で次の誤り位置を引き、データビットを反転する（1ビットごとの乱数は引かない）
+ * - 送信中・到着済みのバイトは受信側の Capacity バイトのリングバッファに入る。
+ *   空きが足りなければ write() は入る分だけ受け付ける（ハードウェアフロー制御相当）
+ * - 時刻の計算は整数ナノ秒。1バイト時間の丸め誤差は 921600 baud で 0.01% 未満
+ *
+ * スレッドセーフではない（仮想時計を進めるテストのスレッドから使う）。
+ *
+ * @tparam Capacity 受信リングバッファの大きさ（2の累乗）
+ * @tparam MaxSegments 到着待ちのバーストの最大数（2の累乗）
+ *
+ * @par 使用例
+ * @code
+ * VirtualClock clock;
+ * LoopbackSerialContext<> a(clock);
+ * LoopbackSerialContext<> b(clock);
+ * a.link(b);
+ * a.set_link_config({921600, 500, 100, 1e-6});  // a → b の特性
+ * (void)a.connect();
+ * (void)b.connect();
+ *
+ * a.write(request);
+ * clock.advance_to(b.next_arrival_ns());
+ * size_t n = b.read(span<uint8_t>(rx));
+ * @endcode
+ */
+template <uint32_t Capacity = 4096, uint32_t MaxSegments = 64>
+class LoopbackSerialContext : public SerialContext {
+    static_assert(MaxSegments > 0 && (MaxSegments & (MaxSegments - 1)) == 0, "MaxSegments must be a power of two");
+
+public:
+    /** @brief next_arrival_ns() で到着待ちのデータがないことを表す値 */
+    static constexpr uint64_t NO_ARRIVAL = UINT64_MAX;
+
+    /** @brief 1バイトのビット数（スタート1 + データ8 + ストップ1） */
+    static constexpr uint32_t BITS_PER_BYTE = 10;
+
+    explicit LoopbackSerialContext(const VirtualClock& clock) noexcept : clock_(&clock), peer_(this) { set_link_config(LinkConfig {}); }
+
+    ~LoopbackSerialContext() override = default;
+    LoopbackSerialContext(const LoopbackSerialContext&) = delete;
+    LoopbackSerialContext& operator=(const LoopbackSerialContext&) = delete;
+    LoopbackSerialContext(LoopbackSerialContext&&) = delete;
+    LoopbackSerialContext& operator=(LoopbackSerialContext&&) = delete;
+
+    // ========================================
+    // 伝送路の設定
+    // ========================================
+
+    /**
+     * @brief 相手のポートと相互に接続
+     *
+     * 伝送路の特性は各方向で引き継がれる。到着待ちのデータは破棄される。
+     */
+    void link(LoopbackSerialContext& peer) noexcept {
+        peer_ = &peer;
+        peer.peer_ = this;
+        clear_incoming();
+        peer.clear_incoming();
+    }
+
+    /**
+     * @brief このポートから相手への伝送路の特性を設定
+     *
+     * 擬似乱数は seed で初期化し直す。送信中のデータは設定前の特性のまま届く。
+     */
+    void set_link_config(const LinkConfig& config) noexcept {
+        config_ = config;
+        byte_ns_ = (config.baud_rate == 0) ? 0 : (static_cast<uint64_t>(BITS_PER_BYTE) * 1000000000ULL + config.baud_rate / 2) / config.baud_rate;
+        rng_ = (config.seed == 0) ? 1 : config.seed;
+        error_log_scale_ = (config.bit_error_rate > 0.0 && config.bit_error_rate < 1.0) ? 1.0 / std::log1p(-config.bit_error_rate) : 0.0;
+        bits_until_error_ = next_error_distance();
+    }
+
+    [[nodiscard]] const LinkConfig& get_link_config() const noexcept { return config_; }
+
+    /**
+     * @brief このポートから相手への統計情報
+     */
+    [[nodiscard]] const LinkStats& get_tx_stats() const noexcept { return stats_; }
+
+    /**
+     * @brief 1バイトの送信時間（ナノ秒）
+     */
+    [[nodiscard]] uint64_t get_byte_time_ns() const noexcept { return byte_ns_; }
+
+    /**
+     * @brief 次に受信データが届く時刻（ナノ秒）
+     *
+     * 到着待ちのデータがなければ NO_ARRIVAL。clock.advance_to() に渡せば、
+     * 待ち時間をまとめて飛ばすイベント駆動のシミュレーションになる。
+     */
+    [[nodiscard]] uint64_t next_arrival_ns() const noexcept {
+        const uint64_t now = clock_->now_ns();
+        for (uint32_t i = 0; i < segment_count_; ++i) {
+            const Segment& segment = segments_[(segment_head_ + i) & SEGMENT_MASK];
+            const uint32_t due = due_count(segment, now);
+            if (due < segment.count) {
+                return segment.first_ns + static_cast<uint64_t>(due) * segment.byte_ns;
+            }
+        }
+        return NO_ARRIVAL;
+    }
+
+    /**
+     * @brief このポートの送信路が空く時刻（ナノ秒）
+     */
+    [[nodiscard]] uint64_t tx_idle_ns() const noexcept { return (line_free_ns_ > clock_->now_ns()) ? line_free_ns_ : clock_->now_ns(); }
+
+    // ========================================
+    // 受信
+    // ========================================
+
+    // ByteReadable interface
+    size_t read(span<uint8_t> buffer) override {
+        deliver();
+        const uint32_t count = (buffer.size() < arrived_) ? static_cast<uint32_t>(buffer.size()) : arrived_;
+        const uint32_t n = rx_.pop(buffer.first(count));
+        arrived_ -= n;
+        return n;
+    }
+
+    [[nodiscard]] size_t available() const override {
+        const uint64_t now = clock_->now_ns();
+        size_t total = arrived_;
+        for (uint32_t i = 0; i < segment_count_; ++i) {
+            const Segment& segment = segments_[(segment_head_ + i) & SEGMENT_MASK];
+            const uint32_t due = due_count(segment, now);
+            total += due - ((i == 0) ? front_delivered_ : 0);
+            if (due < segment.count) {
+                break;
+            }
+        }
+        return total;
+    }
+
+    [[nodiscard]] span<const uint8_t> peek() override {
+        deliver();
+        const span<const uint8_t> region = rx_.read_region();
+        return region.first((region.size() < arrived_) ? region.size() : arrived_);
+    }
+
+    size_t consume(size_t count) override {
+        deliver();
+        const auto n = static_cast<uint32_t>((count < arrived_) ? count : arrived_);
+        rx_.consume(n);
+        arrived_ -= n;
+        return n;
+    }
+
+    /**
+     * @brief 到着済みのデータから改行までの1行を読み取る（区切り方は ring_read_line() を参照）
+     */
+    size_t read_line(span<char> buffer) override {
+        deliver();
+        const RingLine line = ring_read_line(rx_, buffer, arrived_);
+        consume(line.consumed);
+        return line.length;
+    }
+
+    // ========================================
+    // 送信
+    // ========================================
+
+    size_t write(span<const uint8_t> data) override {
+        const span<const uint8_t> buffers[] = {data};
+        return writev(span<const span<const uint8_t>>(buffers));
+    }
+
+    /**
+     * @brief 複数のバイト列を1回の送信として書き込む
+     */
+    size_t writev(span<const span<const uint8_t>> buffers) override {
+        if (!connected_) {
+            return 0;
+        }
+
+        size_t requested = 0;
+        for (const span<const uint8_t>& buffer : buffers) {
+            requested += buffer.size();
+        }
+        if (requested == 0) {
+            return 0;
+        }
+
+        // 送信路に載せる（前の送信が終わってから）
+        const uint64_t now = clock_->now_ns();
+        const uint64_t start = (line_free_ns_ > now) ? line_free_ns_ : now;
+        if (!peer_->connected_) {
+            line_free_ns_ = start + static_cast<uint64_t>(requested) * byte_ns_;
+            stats_.bytes_sent += requested;
+            stats_.bytes_lost += requested;
+            return requested;
+        }
+
+        if (start == now && config_.jitter_us > 0) {
+            burst_jitter_ns_ = next_random() % (static_cast<uint64_t>(config_.jitter_us) * 1000 + 1);
+        }
+        uint64_t first_ns = start + byte_ns_ + static_cast<uint64_t>(config_.latency_us) * 1000 + burst_jitter_ns_;
+        if (peer_->segment_count_ > 0 && first_ns < peer_->last_arrival_ns_ + byte_ns_) {
+            first_ns = peer_->last_arrival_ns_ + byte_ns_; // 追い越さず、受信側でも1バイト時間は空く
+        }
+
+        // 受信側の空き（区間表が一杯でも、直前のバーストに連結できるなら送れる）
+        const bool has_segment = peer_->segment_count_ < MaxSegments || peer_->can_extend(first_ns, byte_ns_);
+        const uint32_t space = has_segment ? peer_->rx_.free_space() : 0;
+        const auto count = static_cast<uint32_t>((requested < space) ? requested : space);
+        stats_.bytes_rejected += requested - count;
+        if (count == 0) {
+            return 0;
+        }
+
+        line_free_ns_ = start + static_cast<uint64_t>(count) * byte_ns_;
+        stats_.bytes_sent += count;
+        copy_to_peer(buffers, count);
+        peer_->append_segment(first_ns, count, byte_ns_);
+        return count;
+    }
+
+    size_t write_text(span<const char> text) override {
+        return write(span<const uint8_t>(reinterpret_cast<const uint8_t*>(text.data()), text.size()));
+    }
+
+    // ========================================
+    // 接続
+    // ========================================
+
+    /**
+     * @brief 接続（受信済み・到着待ちのデータは破棄する）
+     */
+    [[nodiscard]] bool connect() override {
+        if (!connected_) {
+            clear_incoming();
+            connected_ = true;
+        }
+        return true;
+    }
+
+    [[nodiscard]] bool disconnect() override {
+        if (!connected_) {
+            return false;
+        }
+        connected_ = false;
+        clear_incoming();
+        return true;
+    }
+
+    [[nodiscard]] bool is_connected() const override { return connected_; }
+
+private:
+    static constexpr uint32_t SEGMENT_MASK = MaxSegments - 1;
+
+    /**
+     * @brief 1バイト時間の間隔で届く連続するバイト列（バースト）
+     */
+    struct Segment {
+        uint64_t first_ns; ///< 先頭バイトの到着時刻
+        uint64_t byte_ns;  ///< バイトの到着間隔
+        uint32_t count;    ///< バイト数
+    };
+
+    /**
+     * @brief now までに届いたバイト数
+     */
+    static uint32_t due_count(const Segment& segment, uint64_t now) noexcept {
+        if (now < segment.first_ns) {
+            return 0;
+        }
+        if (segment.byte_ns == 0) {
+            return segment.count;
+        }
+        const uint64_t due = (now - segment.first_ns) / segment.byte_ns + 1;
+        return (due < segment.count) ? static_cast<uint32_t>(due) : segment.count;
+    }
+
+    /**
+     * @brief 到着時刻を過ぎたバイトを読み取り可能にする
+     */
+    void deliver() noexcept {
+        const uint64_t now = clock_->now_ns();
+        while (segment_count_ > 0) {
+            const Segment& segment = segments_[segment_head_];
+            const uint32_t due = due_count(segment, now);
+            arrived_ += due - front_delivered_;
+            if (due < segment.count) {
+                front_delivered_ = due;
+                return;
+            }
+            segment_head_ = (segment_head_ + 1) & SEGMENT_MASK;
+            --segment_count_;
+            front_delivered_ = 0;
+        }
+    }
+
+    /**
+     * @brief 最後の区間の直後に届くか（使用中の送信路に続けた送信は連続する）
+     */
+    [[nodiscard]] bool can_extend(uint64_t first_ns, uint64_t byte_ns) const noexcept {
+        if (segment_count_ == 0) {
+            return false;
+        }
+        const Segment& last = segments_[(segment_head_ + segment_count_ - 1) & SEGMENT_MASK];
+        return last.byte_ns == byte_ns && last.first_ns + static_cast<uint64_t>(last.count) * byte_ns == first_ns;
+    }
+
+    void append_segment(uint64_t first_ns, uint32_t count, uint64_t byte_ns) noexcept {
+        if (can_extend(first_ns, byte_ns)) {
+            segments_[(segment_head_ + segment_count_ - 1) & SEGMENT_MASK].count += count;
+        } else {
+            segments_[(segment_head_ + segment_count_) & SEGMENT_MASK] = Segment {first_ns, byte_ns, count};
+            ++segment_count_;
+        }
+        last_arrival_ns_ = first_ns + static_cast<uint64_t>(count - 1) * byte_ns;
+    }
+
+    /**
+     * @brief 相手のリングバッファへコピーし、ビット誤りを加える
+     */
+    void copy_to_peer(span<const span<const uint8_t>> buffers, uint32_t count) noexcept {
+        uint32_t remaining = count;
+        for (const span<const uint8_t>& buffer : buffers) {
+            uint32_t offset = 0;
+            while (remaining > 0 && offset < buffer.size()) {
+                const span<uint8_t> region = peer_->rx_.write_region();
+                uint32_t n = static_cast<uint32_t>(buffer.size()) - offset;
+                n = (n < remaining) ? n : remaining;
+                n = (n < region.size()) ? n : static_cast<uint32_t>(region.size());
+
+                std::memcpy(region.data(), buffer.data() + offset, n);
+                inject_errors(region.first(n));
+                peer_->rx_.commit(n);
+                offset += n;
+                remaining -= n;
+            }
+        }
+    }
+
+    void inject_errors(span<uint8_t> bytes) noexcept {
+        uint64_t bits = static_cast<uint64_t>(bytes.size()) * 8;
+        uint64_t position = 0;
+        while (bits_until_error_ < bits - position) {
+            position += bits_until_error_;
+            bytes[position / 8] ^= static_cast<uint8_t>(1U << (position % 8));
+            ++stats_.bit_errors;
+            ++position;
+            bits_until_error_ = next_error_distance();
+        }
+        bits_until_error_ -= bits - position;
+    }
+
+    /**
+     * @brief 次のビット誤りまでの正常なビット数（幾何分布）
+     */
+    uint64_t next_error_distance() noexcept {
+        if (config_.bit_error_rate >= 1.0) {
+            return 0;
+        }
+        if (error_log_scale_ == 0.0) {
+            return UINT64_MAX;
+        }
+        // (0, 1] の一様乱数から逆関数法で引く
+        const double uniform = (static_cast<double>(next_random() >> 11) + 1.0) * (1.0 / 9007199254740992.0);
+        const double distance = std::floor(std::log(uniform) * error_log_scale_);
+        return (distance < 1.8e19) ? static_cast<uint64_t>(distance) : UINT64_MAX;
+    }
+
+    /**
+     * @brief 擬似乱数（xorshift64*）
+     */
+    uint64_t next_random() noexcept {
+        rng_ ^= rng_ >> 12;
+        rng_ ^= rng_ << 25;
+        rng_ ^= rng_ >> 27;
+        return rng_ * 0x2545F4914F6CDD1DULL;
+    }
+
+    void clear_incoming() noexcept {
+        rx_.clear();
+        segment_head_ = 0;
+        segment_count_ = 0;
+        front_delivered_ = 0;
+        arrived_ = 0;
+        last_arrival_ns_ = 0;
+    }
+
+    const VirtualClock* clock_;
+    LoopbackSerialContext* peer_;
+    bool connected_ = false;
+
+    // 送信側（このポート → peer_）
+    LinkConfig config_ {};
+    LinkStats stats_ {};
+    uint64_t byte_ns_ = 0;
+    uint64_t line_free_ns_ = 0;
+    uint64_t burst_jitter_ns_ = 0;
+    uint64_t rng_ = 1;
+    uint64_t bits_until_error_ = UINT64_MAX;
+    double error_log_scale_ = 0.0;
+
+    // 受信側（peer_ → このポート）
+    RingBuffer<uint8_t, Capacity> rx_;
+    Segment segments_[MaxSegments] {};
+    uint32_t segment_head_ = 0;
+    uint32_t segment_count_ = 0;
+    uint32_t front_delivered_ = 0; ///< 先頭の区間のうち arrived_ に数えたバイト数
+    uint32_t arrived_ = 0;         ///< リングバッファ先頭の到着済みバイト数
+    uint64_t last_arrival_ns_ = 0;
+};
+
+} // namespace omusubi::platform::loopback
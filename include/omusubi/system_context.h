@@ -38,7 +38,11 @@ public:
     /** @brief システムを初期化 */
     virtual void begin() = 0;
 
-    /** @brief システム状態を更新 */
+    /**
+     * @brief システム状態を更新
+     *
+     * 各デバイスの非同期I/O（AsyncByteStream）を進め、完了コールバックを呼ぶ。メインループで毎回呼ぶこと。
+     */
     virtual void update() = 0;
 
     /** @brief 待機（ミリ秒） */
@@ -0,0 +1,70 @@
+#include <omusubi/platform/linux/linux_power_context.hpp>
+
+#include <fcntl.h>
+#include <string_view>
+#include <unistd.h>
+
+namespace omusubi::platform::linux_host {
+
+namespace {
+
+/**
+ * @brief sysfs の属性を1行読む（末尾の改行を除く）
+ */
+std::string_view read_attribute(const char* path, char* buffer, size_t size) {
+    const int fd = ::open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return {};
+    }
+
+    const ssize_t n = ::read(fd, buffer, size);
+    ::close(fd);
+    if (n <= 0) {
+        return {};
+    }
+
+    std::string_view text(buffer, static_cast<size_t>(n));
+    while (!text.empty() && (text.back() == '\n' || text.back() == ' ')) {
+        text.remove_suffix(1);
+    }
+    return text;
+}
+
+std::string_view battery_status(char* buffer, size_t size) {
+    return read_attribute("/sys/class/power_supply/BAT0/status", buffer, size);
+}
+
+} // namespace
+
+PowerState LinuxPowerContext::get_power_state() const {
+    char buffer[32];
+    const std::string_view status = battery_status(buffer, sizeof(buffer));
+    if (status.empty()) {
+        return PowerState::EXTERNAL;
+    }
+    return (status == "Discharging") ? PowerState::BATTERY : PowerState::EXTERNAL;
+}
+
+uint8_t LinuxPowerContext::get_battery_level() const {
+    char buffer[8];
+    const std::string_view capacity = read_attribute("/sys/class/power_supply/BAT0/capacity", buffer, sizeof(buffer));
+    if (capacity.empty()) {
+        return 100;
+    }
+
+    uint32_t level = 0;
+    for (const char c : capacity) {
+        if (c < '0' || c > '9') {
+            return 100;
+        }
+        level = level * 10 + static_cast<uint32_t>(c - '0');
+    }
+    return static_cast<uint8_t>((level > 100) ? 100 : level);
+}
+
+bool LinuxPowerContext::is_charging() const {
+    char buffer[32];
+    return battery_status(buffer, sizeof(buffer)) == "Charging";
+}
+
+} // namespace omusubi::platform::linux_host
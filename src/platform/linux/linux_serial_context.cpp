@@ -0,0 +1,357 @@
+#include <omusubi/core/format.hpp>
+#include <omusubi/platform/linux/linux_serial_context.hpp>
+
+#include <cerrno>
+#include <ctime>
+#include <fcntl.h>
+#include <sys/epoll.h>
+#include <sys/ioctl.h>
+#include <sys/uio.h>
+#include <termios.h>
+#include <unistd.h>
+
+namespace omusubi::platform::linux_host {
+
+namespace {
+
+// writev(2) 1回にまとめるバッファ数
+constexpr size_t MAX_IOV = 16;
+
+bool to_speed(uint32_t baud_rate, speed_t& speed) {
+    switch (baud_rate) {
+        case 9600:
+            speed = B9600;
+            return true;
+        case 19200:
+            speed = B19200;
+            return true;
+        case 38400:
+            speed = B38400;
+            return true;
+        case 57600:
+            speed = B57600;
+            return true;
+        case 115200:
+            speed = B115200;
+            return true;
+        case 230400:
+            speed = B230400;
+            return true;
+        case 460800:
+            speed = B460800;
+            return true;
+        case 921600:
+            speed = B921600;
+            return true;
+        default:
+            return false;
+    }
+}
+
+int64_t monotonic_ms() {
+    timespec now {};
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return static_cast<int64_t>(now.tv_sec) * 1000 + now.tv_nsec / 1000000;
+}
+
+} // namespace
+
+LinuxSerialContext::LinuxSerialContext(uint8_t port) noexcept {
+    format_to(device_, "/dev/ttyUSB{}", port);
+}
+
+LinuxSerialContext::~LinuxSerialContext() {
+    (void)disconnect();
+}
+
+bool LinuxSerialContext::set_device(std::string_view path) noexcept {
+    if (path.size() > MAX_DEVICE_PATH) {
+        return false;
+    }
+    device_.clear();
+    device_.append(path);
+    return true;
+}
+
+// ========================================
+// 接続
+// ========================================
+
+bool LinuxSerialContext::connect() {
+    if (is_connected()) {
+        return true;
+    }
+
+    speed_t speed {};
+    if (!to_speed(baud_rate_, speed)) {
+        return false;
+    }
+
+    const int fd = ::open(device_.c_str(), O_RDWR | O_NOCTTY | O_NONBLOCK | O_CLOEXEC);
+    if (fd < 0) {
+        return false;
+    }
+
+    // 生モード・8N1・フロー制御なし
+    termios tio {};
+    if (tcgetattr(fd, &tio) != 0) {
+        ::close(fd);
+        return false;
+    }
+    cfmakeraw(&tio);
+    tio.c_cflag |= CLOCAL | CREAD;
+    tio.c_cflag &= ~static_cast<tcflag_t>(CSTOPB | PARENB | CRTSCTS);
+    tio.c_cc[VMIN] = 0;
+    tio.c_cc[VTIME] = 0;
+    cfsetispeed(&tio, speed);
+    cfsetospeed(&tio, speed);
+    if (tcsetattr(fd, TCSANOW, &tio) != 0) {
+        ::close(fd);
+        return false;
+    }
+    tcflush(fd, TCIOFLUSH);
+
+    const int epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    epoll_event event {};
+    event.events = EPOLLIN;
+    event.data.fd = fd;
+    if (epoll_fd < 0 || epoll_ctl(epoll_fd, EPOLL_CTL_ADD, fd, &event) != 0) {
+        if (epoll_fd >= 0) {
+            ::close(epoll_fd);
+        }
+        ::close(fd);
+        return false;
+    }
+
+    fd_ = fd;
+    epoll_fd_ = epoll_fd;
+    rx_.clear();
+    return true;
+}
+
+bool LinuxSerialContext::disconnect() {
+    if (!is_connected()) {
+        return false;
+    }
+
+    ::close(epoll_fd_);
+    ::close(fd_);
+    epoll_fd_ = -1;
+    fd_ = -1;
+    rx_.clear();
+    return true;
+}
+
+// ========================================
+// 受信
+// ========================================
+
+size_t LinuxSerialContext::update() noexcept {
+    if (!is_connected()) {
+        return 0;
+    }
+
+    // リングバッファの空き領域へ直接読み込む（折り返し位置で2回に分かれる）
+    size_t total = 0;
+    while (true) {
+        const span<uint8_t> region = rx_.write_region();
+        if (region.empty()) {
+            break;
+        }
+
+        const ssize_t n = ::read(fd_, region.data(), region.size());
+        if (n > 0) {
+            rx_.commit(static_cast<uint32_t>(n));
+            total += static_cast<size_t>(n);
+            if (static_cast<size_t>(n) < region.size()) {
+                break;
+            }
+        } else if (n < 0 && errno == EINTR) {
+            continue;
+        } else {
+            break;
+        }
+    }
+    return total;
+}
+
+bool LinuxSerialContext::wait_readable(uint32_t timeout_ms) noexcept {
+    update();
+    if (!rx_.is_empty()) {
+        return true;
+    }
+    if (!is_connected()) {
+        return false;
+    }
+
+    const int64_t deadline = monotonic_ms() + timeout_ms;
+    while (true) {
+        const int64_t remaining = deadline - monotonic_ms();
+        if (remaining < 0) {
+            return false;
+        }
+
+        epoll_event event {};
+        const int ready = epoll_wait(epoll_fd_, &event, 1, static_cast<int>(remaining));
+        if (ready < 0 && errno == EINTR) {
+            continue;
+        }
+        if (ready <= 0) {
+            return false;
+        }
+
+        update();
+        if (!rx_.is_empty()) {
+            return true;
+        }
+        if ((event.events & (EPOLLHUP | EPOLLERR)) != 0) {
+            return false;
+        }
+    }
+}
+
+size_t LinuxSerialContext::read(span<uint8_t> buffer) {
+    update();
+    return rx_.pop(buffer);
+}
+
+size_t LinuxSerialContext::available() const {
+    size_t pending = 0;
+    int queued = 0;
+    if (is_connected() && ioctl(fd_, FIONREAD, &queued) == 0 && queued > 0) {
+        pending = static_cast<size_t>(queued);
+    }
+    return rx_.size() + pending;
+}
+
+span<const uint8_t> LinuxSerialContext::peek() {
+    update();
+    return rx_.read_region();
+}
+
+size_t LinuxSerialContext::consume(size_t count) {
+    const uint32_t stored = rx_.size();
+    const auto n = static_cast<uint32_t>((count < stored) ? count : stored);
+    rx_.consume(n);
+    return n;
+}
+
+size_t LinuxSerialContext::read_line(span<char> buffer) {
+    update();
+
+    const RingLine line = ring_read_line(rx_, buffer, rx_.size());
+    rx_.consume(line.consumed);
+    return line.length;
+}
+
+// ========================================
+// 送信
+// ========================================
+
+bool LinuxSerialContext::wait_writable(uint32_t timeout_ms) noexcept {
+    // 受信側が一杯のときは EPOLLIN を外す（レベルトリガーで起き続けるため）
+    epoll_event event {};
+    event.events = rx_.is_full() ? EPOLLOUT : (EPOLLIN | EPOLLOUT);
+    event.data.fd = fd_;
+    if (epoll_ctl(epoll_fd_, EPOLL_CTL_MOD, fd_, &event) != 0) {
+        return false;
+    }
+
+    bool writable = false;
+    const int64_t deadline = monotonic_ms() + timeout_ms;
+    while (!writable) {
+        const int64_t remaining = deadline - monotonic_ms();
+        if (remaining < 0) {
+            break;
+        }
+
+        epoll_event ready_event {};
+        const int ready = epoll_wait(epoll_fd_, &ready_event, 1, static_cast<int>(remaining));
+        if (ready < 0 && errno == EINTR) {
+            continue;
+        }
+        if (ready <= 0 || (ready_event.events & (EPOLLHUP | EPOLLERR)) != 0) {
+            break;
+        }
+
+        // 待つ間に届いた受信データを取り込み、相手側の送信が詰まらないようにする
+        if ((ready_event.events & EPOLLIN) != 0) {
+            update();
+        }
+        writable = (ready_event.events & EPOLLOUT) != 0;
+    }
+
+    event.events = EPOLLIN;
+    epoll_ctl(epoll_fd_, EPOLL_CTL_MOD, fd_, &event);
+    return writable;
+}
+
+size_t LinuxSerialContext::write(span<const uint8_t> data) {
+    const span<const uint8_t> buffers[] = {data};
+    return writev(span<const span<const uint8_t>>(buffers));
+}
+
+size_t LinuxSerialContext::writev(span<const span<const uint8_t>> buffers) {
+    return transmit(buffers, write_timeout_ms_);
+}
+
+size_t LinuxSerialContext::write_some(span<const uint8_t> data) {
+    const span<const uint8_t> buffers[] = {data};
+    return transmit(span<const span<const uint8_t>>(buffers), 0);
+}
+
+size_t LinuxSerialContext::transmit(span<const span<const uint8_t>> buffers, uint32_t timeout_ms) noexcept {
+    if (!is_connected()) {
+        return 0;
+    }
+
+    const int64_t deadline = monotonic_ms() + timeout_ms;
+    size_t total = 0;
+    size_t index = 0;
+    size_t offset = 0;
+
+    while (true) {
+        iovec iov[MAX_IOV];
+        size_t count = 0;
+        for (size_t i = index; i < buffers.size() && count < MAX_IOV; ++i) {
+            const size_t skip = (i == index) ? offset : 0;
+            if (buffers[i].size() > skip) {
+                iov[count].iov_base = const_cast<uint8_t*>(buffers[i].data() + skip);
+                iov[count].iov_len = buffers[i].size() - skip;
+                ++count;
+            }
+        }
+        if (count == 0) {
+            break;
+        }
+
+        const ssize_t n = ::writev(fd_, iov, static_cast<int>(count));
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            const int64_t remaining = deadline - monotonic_ms();
+            if (errno == EAGAIN && timeout_ms > 0 && remaining >= 0 && wait_writable(static_cast<uint32_t>(remaining))) {
+                continue;
+            }
+            break;
+        }
+
+        // 書き込めた分だけ位置を進める
+        total += static_cast<size_t>(n);
+        auto written = static_cast<size_t>(n);
+        while (index < buffers.size() && written >= buffers[index].size() - offset) {
+            written -= buffers[index].size() - offset;
+            offset = 0;
+            ++index;
+        }
+        offset += written;
+    }
+    return total;
+}
+
+size_t LinuxSerialContext::write_text(span<const char> text) {
+    return write(span<const uint8_t>(reinterpret_cast<const uint8_t*>(text.data()), text.size()));
+}
+
+} // namespace omusubi::platform::linux_host
@@ -0,0 +1,89 @@
+#include <omusubi/platform/linux/linux_system_info_context.hpp>
+
+#include <ctime>
+#include <fcntl.h>
+#include <sys/sysinfo.h>
+#include <sys/utsname.h>
+#include <unistd.h>
+
+namespace omusubi::platform::linux_host {
+
+namespace {
+
+uint64_t monotonic_ns() {
+    timespec now {};
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return static_cast<uint64_t>(now.tv_sec) * 1000000000U + static_cast<uint64_t>(now.tv_nsec);
+}
+
+/**
+ * @brief /etc/machine-id（32桁の16進数）の先頭16桁
+ */
+bool read_machine_id(uint64_t& id) {
+    const int fd = ::open("/etc/machine-id", O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return false;
+    }
+
+    char hex[16];
+    const ssize_t n = ::read(fd, hex, sizeof(hex));
+    ::close(fd);
+    if (n != static_cast<ssize_t>(sizeof(hex))) {
+        return false;
+    }
+
+    uint64_t value = 0;
+    for (const char c : hex) {
+        uint32_t digit = 0;
+        if (c >= '0' && c <= '9') {
+            digit = static_cast<uint32_t>(c - '0');
+        } else if (c >= 'a' && c <= 'f') {
+            digit = static_cast<uint32_t>(c - 'a' + 10);
+        } else {
+            return false;
+        }
+        value = (value << 4) | digit;
+    }
+    id = value;
+    return true;
+}
+
+} // namespace
+
+LinuxSystemInfoContext::LinuxSystemInfoContext() noexcept {
+    utsname name {};
+    if (uname(&name) == 0) {
+        device_name_.append(name.nodename);
+    }
+
+    if (!read_machine_id(chip_id_)) {
+        chip_id_ = static_cast<uint32_t>(gethostid());
+    }
+
+    restart_uptime();
+}
+
+std::string_view LinuxSystemInfoContext::get_firmware_version() const {
+    return "linux-host";
+}
+
+uint32_t LinuxSystemInfoContext::get_uptime_ms() const {
+    // 約49.7日でラップアラウンドする（MCU の実装と同じ）
+    return static_cast<uint32_t>((monotonic_ns() - start_ns_) / 1000000U);
+}
+
+uint32_t LinuxSystemInfoContext::get_free_memory() const {
+    struct sysinfo info {};
+    if (sysinfo(&info) != 0) {
+        return 0;
+    }
+
+    const uint64_t bytes = static_cast<uint64_t>(info.freeram) * info.mem_unit;
+    return (bytes > UINT32_MAX) ? UINT32_MAX : static_cast<uint32_t>(bytes);
+}
+
+void LinuxSystemInfoContext::restart_uptime() noexcept {
+    start_ns_ = monotonic_ns();
+}
+
+} // namespace omusubi::platform::linux_host
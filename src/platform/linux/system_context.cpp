@@ -0,0 +1,45 @@
+#include <omusubi/platform/linux/linux_system_context.hpp>
+
+#include <cerrno>
+#include <ctime>
+
+namespace omusubi {
+
+namespace platform::linux_host {
+
+void LinuxSystemContext::begin() {
+    system_info_.restart_uptime();
+}
+
+void LinuxSystemContext::update() {
+    connectable_.update();
+}
+
+void LinuxSystemContext::delay(uint32_t ms) {
+    // 絶対時刻で待つため、シグナルで中断されても待ち時間が延びない
+    timespec deadline {};
+    clock_gettime(CLOCK_MONOTONIC, &deadline);
+    deadline.tv_sec += static_cast<time_t>(ms / 1000);
+    deadline.tv_nsec += static_cast<long>(ms % 1000) * 1000000L;
+    if (deadline.tv_nsec >= 1000000000L) {
+        deadline.tv_nsec -= 1000000000L;
+        ++deadline.tv_sec;
+    }
+
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &deadline, nullptr) == EINTR) {
+    }
+}
+
+void LinuxSystemContext::reset() {
+    connectable_.disconnect_all();
+    system_info_.restart_uptime();
+}
+
+} // namespace platform::linux_host
+
+SystemContext& get_system_context() {
+    static platform::linux_host::LinuxSystemContext inst;
+    return inst;
+}
+
+} // namespace omusubi
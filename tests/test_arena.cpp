@@ -0,0 +1,148 @@
+// Arena の単体テスト
+
+#define DOCTEST_CONFIG_NO_EXCEPTIONS
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <omusubi/core/arena.hpp>
+
+#include "doctest.h"
+
+using namespace omusubi;
+using namespace std::literals;
+
+namespace {
+
+struct Field {
+    uint16_t id;
+    uint32_t value;
+};
+
+struct Point {
+    int32_t x;
+    int32_t y;
+
+    Point(int32_t px, int32_t py) noexcept : x(px), y(py) {}
+};
+
+bool is_aligned(const void* ptr, size_t alignment) {
+    return (reinterpret_cast<uintptr_t>(ptr) % alignment) == 0;
+}
+
+} // namespace
+
+TEST_CASE("Arena - 基本機能") {
+    alignas(16) uint8_t memory[128];
+    Arena arena {span<uint8_t>(memory)};
+
+    CHECK_EQ(arena.capacity(), 128U);
+    CHECK_EQ(arena.used(), 0U);
+
+    void* a = arena.allocate(10, 1);
+    REQUIRE(a != nullptr);
+    CHECK_EQ(arena.used(), 10U);
+
+    SUBCASE("アライメント") {
+        void* b = arena.allocate(8, 8);
+        REQUIRE(b != nullptr);
+        CHECK(is_aligned(b, 8));
+        CHECK_EQ(arena.used(), 24U); // 10 + 詰め物6 + 8
+    }
+
+    SUBCASE("容量不足") {
+        CHECK(arena.allocate(119, 1) == nullptr);
+        CHECK_EQ(arena.used(), 10U);
+        CHECK(arena.allocate(118, 1) != nullptr);
+        CHECK_EQ(arena.remaining(), 0U);
+        CHECK(arena.allocate(1, 1) == nullptr);
+    }
+
+    SUBCASE("アライメントの詰め物で容量を超える") {
+        CHECK(arena.allocate(116, 1) != nullptr); // used = 126
+        CHECK(arena.allocate(1, 4) == nullptr);   // 詰め物2 + 1 > 残り2
+    }
+}
+
+TEST_CASE("Arena - 型付きヘルパー") {
+    alignas(16) uint8_t memory[256];
+    Arena arena {span<uint8_t>(memory)};
+
+    SUBCASE("create") {
+        CHECK(arena.allocate(1, 1) != nullptr);
+        Point* p = arena.create<Point>(3, -4);
+        REQUIRE(p != nullptr);
+        CHECK(is_aligned(p, alignof(Point)));
+        CHECK_EQ(p->x, 3);
+        CHECK_EQ(p->y, -4);
+    }
+
+    SUBCASE("allocate_array（値初期化）") {
+        span<Field> fields = arena.allocate_array<Field>(8);
+        REQUIRE_EQ(fields.size(), 8U);
+        CHECK(is_aligned(fields.data(), alignof(Field)));
+        for (const Field& field : fields) {
+            CHECK_EQ(field.id, 0);
+            CHECK_EQ(field.value, 0U);
+        }
+    }
+
+    SUBCASE("allocate_array（容量不足・オーバーフロー）") {
+        CHECK(arena.allocate_array<Field>(1000).empty());
+        CHECK(arena.allocate_array<uint64_t>(SIZE_MAX / 4).empty());
+        CHECK_EQ(arena.used(), 0U);
+    }
+
+    SUBCASE("copy_string") {
+        char source[] = "sensor/temp";
+        std::string_view copy = arena.copy_string(source);
+        source[0] = 'X';
+        CHECK_EQ(copy, "sensor/temp"sv);
+        CHECK_EQ(copy.data()[copy.size()], '\0');
+    }
+}
+
+TEST_CASE("Arena - mark / rewind") {
+    uint8_t memory[64];
+    Arena arena {span<uint8_t>(memory)};
+
+    CHECK(arena.allocate(8, 1) != nullptr);
+    const Arena::Marker marker = arena.mark();
+    CHECK(arena.allocate(20, 1) != nullptr);
+    CHECK_EQ(arena.used(), 28U);
+
+    arena.rewind(marker);
+    CHECK_EQ(arena.used(), 8U);
+    CHECK_EQ(arena.high_water_mark(), 28U);
+
+    // 現在位置より先のマーカーは無視する
+    arena.rewind(Arena::Marker {60});
+    CHECK_EQ(arena.used(), 8U);
+
+    arena.reset();
+    CHECK_EQ(arena.used(), 0U);
+}
+
+TEST_CASE("Arena - scope") {
+    uint8_t memory[64];
+    Arena arena {span<uint8_t>(memory)};
+    CHECK(arena.allocate(4, 1) != nullptr);
+
+    {
+        auto scope = arena.scope();
+        CHECK(arena.allocate(16, 1) != nullptr);
+        {
+            auto inner = arena.scope();
+            CHECK(arena.allocate(16, 1) != nullptr);
+            CHECK_EQ(arena.used(), 36U);
+        }
+        CHECK_EQ(arena.used(), 20U);
+    }
+    CHECK_EQ(arena.used(), 4U);
+
+    SUBCASE("release で巻き戻しをキャンセル") {
+        {
+            auto scope = arena.scope();
+            CHECK(arena.allocate(8, 1) != nullptr);
+            scope.release();
+        }
+        CHECK_EQ(arena.used(), 12U);
+    }
+}
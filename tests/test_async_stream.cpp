@@ -0,0 +1,183 @@
+// AsyncByteStream の単体テスト（LoopbackSerialContext の仮想シリアルで送受信する）
+
+#define DOCTEST_CONFIG_NO_EXCEPTIONS
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <omusubi/interface/async_stream.h>
+#include <omusubi/platform/loopback/loopback_serial_context.hpp>
+
+#include "doctest.h"
+
+#include <cstring>
+
+using namespace omusubi;
+using namespace omusubi::platform::loopback;
+
+namespace {
+
+using Port = LoopbackSerialContext<256, 16>;
+
+// 完了コールバックの結果を記録する
+struct Completion {
+    uint32_t calls = 0;
+    bool ok = false;
+    size_t size = 0;
+    Error error = Error::OK;
+
+    IoCompletion handler() {
+        return [this](Result<size_t> result) {
+            ++calls;
+            ok = result.is_ok();
+            if (ok) {
+                size = result.value();
+            } else {
+                error = result.error();
+            }
+        };
+    }
+};
+
+} // namespace
+
+TEST_CASE("AsyncByteStream - 送信") {
+    VirtualClock clock;
+    Port a(clock);
+    Port b(clock);
+    a.link(b);
+    REQUIRE(a.connect());
+    REQUIRE(b.connect());
+    a.set_link_config({0, 0, 0, 0.0, 1});
+
+    static uint8_t data[1000];
+    for (uint32_t i = 0; i < sizeof(data); ++i) {
+        data[i] = static_cast<uint8_t>(i);
+    }
+    Completion done;
+
+    SUBCASE("完了コールバックは poll_async() からのみ呼ばれる") {
+        CHECK(a.async_write(span<const uint8_t>(data, 10), done.handler()));
+        CHECK(a.is_write_pending());
+        CHECK_EQ(done.calls, 0U);
+        CHECK_EQ(b.available(), 0U);
+
+        CHECK_EQ(a.poll_async(), 1U);
+        CHECK_EQ(done.calls, 1U);
+        CHECK(done.ok);
+        CHECK_EQ(done.size, 10U);
+        CHECK_FALSE(a.is_write_pending());
+        CHECK_EQ(b.available(), 10U);
+    }
+
+    SUBCASE("相手のバッファが一杯なら空くまで少しずつ送る") {
+        CHECK(a.async_write(span<const uint8_t>(data), done.handler()));
+
+        static uint8_t received[1000];
+        size_t total = 0;
+        uint32_t polls = 0;
+        while (done.calls == 0 && polls < 100) {
+            a.poll_async();
+            total += b.read(span<uint8_t>(received + total, sizeof(received) - total));
+            ++polls;
+        }
+        CHECK_EQ(done.calls, 1U);
+        CHECK_EQ(done.size, sizeof(data));
+        CHECK_GT(polls, 1U);
+        CHECK_EQ(total, sizeof(data));
+        CHECK_EQ(std::memcmp(data, received, sizeof(data)), 0);
+    }
+
+    SUBCASE("送信中は次の送信を登録できない") {
+        CHECK(a.async_write(span<const uint8_t>(data, 4), done.handler()));
+        CHECK_FALSE(a.async_write(span<const uint8_t>(data, 4), done.handler()));
+        CHECK_FALSE(b.async_write(span<const uint8_t>(data, 4), IoCompletion()));
+    }
+
+    SUBCASE("完了コールバックの中で次の送信を登録できる") {
+        uint32_t frames = 0;
+        struct Chain {
+            Port* port;
+            uint32_t* frames;
+            void operator()(Result<size_t> /*result*/) const {
+                if (++*frames < 3) {
+                    port->async_write(span<const uint8_t>(data, 8), Chain {port, frames});
+                }
+            }
+        };
+        CHECK(a.async_write(span<const uint8_t>(data, 8), Chain {&a, &frames}));
+        for (int i = 0; i < 5; ++i) {
+            a.poll_async();
+        }
+        CHECK_EQ(frames, 3U);
+        CHECK_EQ(b.available(), 24U);
+    }
+
+    SUBCASE("切断されたら NOT_CONNECTED で完了") {
+        CHECK(a.async_write(span<const uint8_t>(data, 4), done.handler()));
+        CHECK(a.disconnect());
+        CHECK_EQ(a.poll_async(), 1U);
+        CHECK_FALSE(done.ok);
+        CHECK_EQ(done.error, Error::NOT_CONNECTED);
+    }
+
+    SUBCASE("取り消すと完了コールバックは呼ばれない") {
+        CHECK(a.async_write(span<const uint8_t>(data, 4), done.handler()));
+        a.cancel_async();
+        CHECK_FALSE(a.is_write_pending());
+        CHECK_EQ(a.poll_async(), 0U);
+        CHECK_EQ(done.calls, 0U);
+    }
+}
+
+TEST_CASE("AsyncByteStream - 受信") {
+    VirtualClock clock;
+    Port a(clock);
+    Port b(clock);
+    a.link(b);
+    REQUIRE(a.connect());
+    REQUIRE(b.connect());
+    a.set_link_config({115200, 0, 0, 0.0, 1});
+
+    uint8_t rx[8] = {};
+    Completion done;
+
+    SUBCASE("1バイト以上届いた時点で完了") {
+        CHECK(b.async_read(span<uint8_t>(rx), done.handler()));
+        CHECK_EQ(b.poll_async(), 0U);
+
+        const uint8_t data[] = {'a', 'b', 'c'};
+        a.write(span<const uint8_t>(data));
+        CHECK_EQ(b.poll_async(), 0U);
+
+        clock.advance_to(b.next_arrival_ns());
+        clock.advance_to(b.next_arrival_ns());
+        CHECK_EQ(b.poll_async(), 1U);
+        CHECK(done.ok);
+        CHECK_EQ(done.size, 2U);
+        CHECK_EQ(std::memcmp(rx, "ab", 2), 0);
+        CHECK_FALSE(b.is_read_pending());
+    }
+
+    SUBCASE("送信と受信は同時に登録できる") {
+        Completion sent;
+        const uint8_t data[] = {1, 2};
+        CHECK(b.async_read(span<uint8_t>(rx), done.handler()));
+        CHECK(b.async_write(span<const uint8_t>(data), sent.handler()));
+        CHECK_FALSE(b.async_read(span<uint8_t>(rx), done.handler()));
+        CHECK_FALSE(a.async_read(span<uint8_t>(), done.handler()));
+
+        CHECK_EQ(b.poll_async(), 1U);
+        CHECK_EQ(sent.size, 2U);
+        CHECK(b.is_read_pending());
+
+        a.write(span<const uint8_t>(data, 1));
+        clock.advance_ms(1);
+        CHECK_EQ(b.poll_async(), 1U);
+        CHECK_EQ(done.size, 1U);
+    }
+
+    SUBCASE("切断されたら NOT_CONNECTED で完了") {
+        CHECK(b.async_read(span<uint8_t>(rx), done.handler()));
+        CHECK(b.disconnect());
+        CHECK_EQ(b.poll_async(), 1U);
+        CHECK_EQ(done.error, Error::NOT_CONNECTED);
+    }
+}
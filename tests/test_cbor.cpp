@@ -0,0 +1,320 @@
+// CborWriter / CborReader の単体テスト
+
+#define DOCTEST_CONFIG_NO_EXCEPTIONS
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <omusubi/core/cbor.hpp>
+
+#include "doctest.h"
+
+#include <cmath>
+#include <cstring>
+
+using namespace omusubi;
+
+namespace {
+
+// 出力を記録する ByteWritable
+class MemoryWriter : public ByteWritable {
+public:
+    size_t write(span<const uint8_t> data) override {
+        const size_t room = sizeof(data_) - length_;
+        const size_t n = (data.size() < room) ? data.size() : room;
+        std::memcpy(data_ + length_, data.data(), n);
+        length_ += n;
+        return n;
+    }
+
+    size_t writev(span<const span<const uint8_t>> buffers) override {
+        ++writev_calls;
+        return ByteWritable::writev(buffers);
+    }
+
+    [[nodiscard]] span<const uint8_t> written() const noexcept { return span<const uint8_t>(data_, length_); }
+
+    uint32_t writev_calls = 0;
+
+private:
+    uint8_t data_[16] = {};
+    size_t length_ = 0;
+};
+
+template <typename T>
+bool encodes_to(const T& value, std::initializer_list<uint8_t> expected) {
+    FixedBuffer<32> buffer;
+    CborWriter writer(buffer);
+    writer.write(value);
+    const Result<uint32_t> size = writer.finish();
+    if (size.is_err() || size.value() != expected.size()) {
+        return false;
+    }
+    return std::memcmp(buffer.data(), expected.begin(), expected.size()) == 0;
+}
+
+template <typename T>
+T decode(std::initializer_list<uint8_t> bytes) {
+    CborReader reader(span<const uint8_t>(bytes.begin(), bytes.size()));
+    const Result<T> value = reader.read<T>();
+    return value.is_ok() ? value.value() : T {};
+}
+
+} // namespace
+
+TEST_CASE("CborWriter - 整数（RFC 8949 付録A）") {
+    CHECK(encodes_to(0, {0x00}));
+    CHECK(encodes_to(23, {0x17}));
+    CHECK(encodes_to(24, {0x18, 0x18}));
+    CHECK(encodes_to(100, {0x18, 0x64}));
+    CHECK(encodes_to(1000, {0x19, 0x03, 0xE8}));
+    CHECK(encodes_to(1000000, {0x1A, 0x00, 0x0F, 0x42, 0x40}));
+    CHECK(encodes_to(UINT64_C(1000000000000), {0x1B, 0x00, 0x00, 0x00, 0xE8, 0xD4, 0xA5, 0x10, 0x00}));
+    CHECK(encodes_to(std::numeric_limits<uint64_t>::max(), {0x1B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF}));
+    CHECK(encodes_to(-1, {0x20}));
+    CHECK(encodes_to(-10, {0x29}));
+    CHECK(encodes_to(-100, {0x38, 0x63}));
+    CHECK(encodes_to(-1000, {0x39, 0x03, 0xE7}));
+    CHECK(encodes_to(std::numeric_limits<int64_t>::min(), {0x3B, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF}));
+    CHECK(encodes_to(static_cast<int8_t>(-128), {0x38, 0x7F}));
+}
+
+TEST_CASE("CborWriter - 浮動小数点数は最短の形式") {
+    CHECK(encodes_to(0.0F, {0xF9, 0x00, 0x00}));
+    CHECK(encodes_to(-0.0F, {0xF9, 0x80, 0x00}));
+    CHECK(encodes_to(1.0F, {0xF9, 0x3C, 0x00}));
+    CHECK(encodes_to(1.5F, {0xF9, 0x3E, 0x00}));
+    CHECK(encodes_to(65504.0F, {0xF9, 0x7B, 0xFF}));
+    CHECK(encodes_to(5.960464477539063e-8F, {0xF9, 0x00, 0x01}));
+    CHECK(encodes_to(0.00006103515625F, {0xF9, 0x04, 0x00}));
+    CHECK(encodes_to(-4.0F, {0xF9, 0xC4, 0x00}));
+    CHECK(encodes_to(100000.0F, {0xFA, 0x47, 0xC3, 0x50, 0x00}));
+    CHECK(encodes_to(3.4028234663852886e+38F, {0xFA, 0x7F, 0x7F, 0xFF, 0xFF}));
+    CHECK(encodes_to(std::numeric_limits<float>::infinity(), {0xF9, 0x7C, 0x00}));
+    CHECK(encodes_to(-std::numeric_limits<float>::infinity(), {0xF9, 0xFC, 0x00}));
+    CHECK(encodes_to(std::numeric_limits<float>::quiet_NaN(), {0xF9, 0x7E, 0x00}));
+
+    CHECK(encodes_to(1.1, {0xFB, 0x3F, 0xF1, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9A}));
+    CHECK(encodes_to(1.0e+300, {0xFB, 0x7E, 0x37, 0xE4, 0x3C, 0x88, 0x00, 0x75, 0x9C}));
+    CHECK(encodes_to(-4.1, {0xFB, 0xC0, 0x10, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66}));
+    CHECK(encodes_to(0.5, {0xF9, 0x38, 0x00}));
+    CHECK(encodes_to(-std::numeric_limits<double>::infinity(), {0xF9, 0xFC, 0x00}));
+}
+
+TEST_CASE("CborWriter - 単純値・文字列・配列") {
+    CHECK(encodes_to(false, {0xF4}));
+    CHECK(encodes_to(true, {0xF5}));
+    CHECK(encodes_to("", {0x60}));
+    CHECK(encodes_to("IETF", {0x64, 0x49, 0x45, 0x54, 0x46}));
+    CHECK(encodes_to(std::string_view("a"), {0x61, 0x61}));
+
+    const uint8_t bytes[] = {0x01, 0x02, 0x03, 0x04};
+    CHECK(encodes_to(span<const uint8_t>(bytes), {0x44, 0x01, 0x02, 0x03, 0x04}));
+
+    const int32_t numbers[] = {1, 2, 3};
+    CHECK(encodes_to(span<const int32_t>(numbers), {0x83, 0x01, 0x02, 0x03}));
+
+    CHECK(encodes_to(Vector3(1.0F, -2.0F, 0.5F), {0x83, 0xF9, 0x3C, 0x00, 0xF9, 0xC0, 0x00, 0xF9, 0x38, 0x00}));
+
+    FixedBuffer<16> buffer;
+    CborWriter writer(buffer);
+    writer.write_map_header(2);
+    writer.write("a");
+    writer.write(1);
+    writer.write("b");
+    writer.write_null();
+    const Result<uint32_t> size = writer.finish();
+    REQUIRE(size.is_ok());
+    const uint8_t expected[] = {0xA2, 0x61, 0x61, 0x01, 0x61, 0x62, 0xF6};
+    REQUIRE_EQ(size.value(), sizeof(expected));
+    CHECK_EQ(std::memcmp(buffer.data(), expected, sizeof(expected)), 0);
+}
+
+TEST_CASE("CborWriter - 容量不足") {
+    FixedBuffer<4> buffer;
+    CborWriter writer(buffer);
+    CHECK(writer.write(1));
+    CHECK_FALSE(writer.write("long"));
+
+    // 失敗以降は書き込まない
+    CHECK_FALSE(writer.write(2));
+    CHECK_EQ(buffer.size(), 1U);
+
+    const Result<uint32_t> size = writer.finish();
+    REQUIRE(size.is_err());
+    CHECK_EQ(size.error(), Error::BUFFER_FULL);
+}
+
+TEST_CASE("CborWriter - ByteWritable へのギャザー書き込み") {
+    MemoryWriter sink;
+    CborWriter writer(sink);
+    CHECK(writer.write("IETF"));
+    CHECK_EQ(sink.writev_calls, 1U);
+    CHECK(writer.write(true));
+
+    const Result<uint32_t> size = writer.finish();
+    REQUIRE(size.is_ok());
+    CHECK_EQ(size.value(), 6U);
+    CHECK_EQ(sink.written()[5], 0xF5);
+
+    // 書き込み不足は WRITE_FAILED
+    CHECK_FALSE(writer.write("0123456789ABC"));
+    const Result<uint32_t> failed = writer.finish();
+    REQUIRE(failed.is_err());
+    CHECK_EQ(failed.error(), Error::WRITE_FAILED);
+}
+
+TEST_CASE("CborReader - 整数と範囲検査") {
+    CHECK_EQ(decode<uint32_t>({0x19, 0x03, 0xE8}), 1000U);
+    CHECK_EQ(decode<int32_t>({0x39, 0x03, 0xE7}), -1000);
+    CHECK_EQ(decode<int64_t>({0x3B, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF}), std::numeric_limits<int64_t>::min());
+    CHECK_EQ(decode<uint64_t>({0x1B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF}), std::numeric_limits<uint64_t>::max());
+    CHECK_EQ(decode<int8_t>({0x38, 0x7F}), -128);
+
+    const uint8_t too_large[] = {0x19, 0x01, 0x00};
+    CborReader reader {span<const uint8_t>(too_large)};
+    const Result<uint8_t> narrow = reader.read<uint8_t>();
+    REQUIRE(narrow.is_err());
+    CHECK_EQ(narrow.error(), Error::INVALID_DATA);
+    CHECK_EQ(reader.position(), 0U);
+
+    const uint8_t negative[] = {0x20};
+    CborReader negative_reader {span<const uint8_t>(negative)};
+    const Result<uint32_t> unsigned_value = negative_reader.read<uint32_t>();
+    REQUIRE(unsigned_value.is_err());
+    CHECK_EQ(unsigned_value.error(), Error::INVALID_DATA);
+
+    const uint8_t negative_overflow[] = {0x38, 0x80};
+    CborReader overflow_reader {span<const uint8_t>(negative_overflow)};
+    CHECK(overflow_reader.read<int8_t>().is_err());
+}
+
+TEST_CASE("CborReader - 浮動小数点数") {
+    CHECK_EQ(decode<float>({0xF9, 0x3E, 0x00}), 1.5F);
+    CHECK_EQ(decode<float>({0xF9, 0x7B, 0xFF}), 65504.0F);
+    CHECK_EQ(decode<float>({0xF9, 0x00, 0x01}), 5.960464477539063e-8F);
+    CHECK_EQ(decode<float>({0xF9, 0x03, 0xFF}), 0.000060975551605224609375F);
+    CHECK_EQ(decode<float>({0xFA, 0x47, 0xC3, 0x50, 0x00}), 100000.0F);
+    CHECK_EQ(decode<double>({0xFB, 0x3F, 0xF1, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9A}), 1.1);
+    CHECK(std::isinf(decode<float>({0xF9, 0xFC, 0x00})));
+    CHECK(std::isnan(decode<double>({0xF9, 0x7E, 0x00})));
+
+    // 全ての半精度の値（NaN以外）が往復する
+    uint32_t mismatches = 0;
+    for (uint32_t bits = 0; bits <= 0xFFFF; ++bits) {
+        const float value = detail::cbor_half_to_float(static_cast<uint16_t>(bits));
+        uint16_t half = 0;
+        if (!detail::cbor_float_to_half(value, half) || (!std::isnan(value) && half != bits)) {
+            ++mismatches;
+        }
+    }
+    CHECK_EQ(mismatches, 0U);
+
+    // 半精度で表せない値
+    uint16_t half = 0;
+    CHECK_FALSE(detail::cbor_float_to_half(0.1F, half));
+    CHECK_FALSE(detail::cbor_float_to_half(65536.0F, half));
+    CHECK_FALSE(detail::cbor_float_to_half(1.0e-8F, half));
+}
+
+TEST_CASE("CborReader - 文字列・バイト列はビューで返す") {
+    const uint8_t data[] = {0x64, 0x49, 0x45, 0x54, 0x46, 0x42, 0xAB, 0xCD};
+    CborReader reader {span<const uint8_t>(data)};
+
+    const Result<std::string_view> text = reader.read<std::string_view>();
+    REQUIRE(text.is_ok());
+    CHECK(text.value() == "IETF");
+    CHECK_EQ(static_cast<const void*>(text.value().data()), static_cast<const void*>(data + 1));
+
+    const Result<span<const uint8_t>> bytes = reader.read<span<const uint8_t>>();
+    REQUIRE(bytes.is_ok());
+    CHECK_EQ(bytes.value().size(), 2U);
+    CHECK_EQ(bytes.value().data(), data + 6);
+    CHECK(reader.is_end());
+}
+
+TEST_CASE("CborReader - 途中で終わる入力") {
+    const uint8_t truncated_text[] = {0x64, 0x49, 0x45};
+    CborReader text_reader {span<const uint8_t>(truncated_text)};
+    const Result<std::string_view> text = text_reader.read<std::string_view>();
+    REQUIRE(text.is_err());
+    CHECK_EQ(text.error(), Error::BUFFER_EMPTY);
+    CHECK_EQ(text_reader.position(), 0U);
+
+    const uint8_t truncated_int[] = {0x1A, 0x00, 0x0F};
+    CborReader int_reader {span<const uint8_t>(truncated_int)};
+    const Result<uint32_t> value = int_reader.read<uint32_t>();
+    REQUIRE(value.is_err());
+    CHECK_EQ(value.error(), Error::BUFFER_EMPTY);
+
+    CborReader empty_reader {span<const uint8_t>()};
+    const Result<bool> flag = empty_reader.read<bool>();
+    REQUIRE(flag.is_err());
+    CHECK_EQ(flag.error(), Error::BUFFER_EMPTY);
+
+    // 不定長は非対応
+    const uint8_t indefinite[] = {0x9F, 0x01, 0xFF};
+    CborReader indefinite_reader {span<const uint8_t>(indefinite)};
+    const Result<uint32_t> count = indefinite_reader.read_array_header();
+    REQUIRE(count.is_err());
+    CHECK_EQ(count.error(), Error::INVALID_DATA);
+}
+
+TEST_CASE("CborReader - 型の確認と読み飛ばし") {
+    // {"a": [1, {"b": h'00'}], "c": 1(1363896240), "v": [1.0, -2.0, 0.5]}
+    FixedBuffer<64> buffer;
+    CborWriter writer(buffer);
+    writer.write_map_header(3);
+    writer.write("a");
+    writer.write_array_header(2);
+    writer.write(1);
+    writer.write_map_header(1);
+    writer.write("b");
+    const uint8_t zero[] = {0x00};
+    writer.write(span<const uint8_t>(zero));
+    writer.write("c");
+    writer.write_tag(1);
+    writer.write(1363896240);
+    writer.write("v");
+    writer.write(Vector3(1.0F, -2.0F, 0.5F));
+    REQUIRE(writer.finish().is_ok());
+
+    CborReader reader(span<const uint8_t>(buffer.data(), buffer.size()));
+    const Result<CborType> type = reader.peek_type();
+    REQUIRE(type.is_ok());
+    CHECK(type.value() == CborType::MAP);
+
+    const Result<uint32_t> pairs = reader.read_map_header();
+    REQUIRE(pairs.is_ok());
+    REQUIRE_EQ(pairs.value(), 3U);
+
+    Vector3 v;
+    for (uint32_t i = 0; i < pairs.value(); ++i) {
+        const Result<std::string_view> key = reader.read<std::string_view>();
+        REQUIRE(key.is_ok());
+        if (key.value() == "v") {
+            const Result<Vector3> value = reader.read<Vector3>();
+            REQUIRE(value.is_ok());
+            v = value.value();
+        } else {
+            REQUIRE(reader.skip().is_ok());
+        }
+    }
+    CHECK(reader.is_end());
+    CHECK_EQ(v.x, 1.0F);
+    CHECK_EQ(v.y, -2.0F);
+    CHECK_EQ(v.z, 0.5F);
+
+    // 中身が途中で終わる配列は読み飛ばせない
+    const uint8_t truncated[] = {0x83, 0x01, 0x02};
+    CborReader truncated_reader {span<const uint8_t>(truncated)};
+    const Result<uint32_t> skipped = truncated_reader.skip();
+    REQUIRE(skipped.is_err());
+    CHECK_EQ(skipped.error(), Error::BUFFER_EMPTY);
+    CHECK_EQ(truncated_reader.position(), 0U);
+
+    // 型が違う
+    const uint8_t number[] = {0x01};
+    CborReader number_reader {span<const uint8_t>(number)};
+    CHECK_FALSE(number_reader.read_null());
+    const Result<std::string_view> wrong = number_reader.read<std::string_view>();
+    REQUIRE(wrong.is_err());
+    CHECK_EQ(wrong.error(), Error::INVALID_DATA);
+}
@@ -0,0 +1,151 @@
+// Crc16 / Crc32 / Crc32c の単体テスト
+
+#define DOCTEST_CONFIG_NO_EXCEPTIONS
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <omusubi/core/crc.hpp>
+
+#include "doctest.h"
+
+using namespace omusubi;
+
+namespace {
+
+// ビット単位の参照実装（反転 CRC-32 系、最終XOR込み）
+uint32_t reference_crc32(uint32_t reflected_polynomial, const uint8_t* data, size_t n) {
+    uint32_t crc = 0xFFFFFFFF;
+    for (size_t i = 0; i < n; ++i) {
+        crc ^= data[i];
+        for (uint32_t bit = 0; bit < 8; ++bit) {
+            crc = ((crc & 1U) != 0) ? ((crc >> 1) ^ reflected_polynomial) : (crc >> 1);
+        }
+    }
+    return crc ^ 0xFFFFFFFF;
+}
+
+// ビット単位の参照実装（CRC-16/CCITT-FALSE）
+uint16_t reference_crc16(const uint8_t* data, size_t n) {
+    uint16_t crc = 0xFFFF;
+    for (size_t i = 0; i < n; ++i) {
+        crc = static_cast<uint16_t>(crc ^ (static_cast<uint16_t>(data[i]) << 8));
+        for (uint32_t bit = 0; bit < 8; ++bit) {
+            crc = static_cast<uint16_t>(((crc & 0x8000U) != 0) ? ((crc << 1) ^ 0x1021U) : (crc << 1));
+        }
+    }
+    return crc;
+}
+
+// 再現可能な疑似乱数列
+struct Lcg {
+    uint32_t state = 12345;
+
+    uint32_t next() {
+        state = (state * 1103515245U) + 12345U;
+        return state >> 8;
+    }
+};
+
+} // namespace
+
+TEST_CASE("Crc16 - CRC-16/CCITT-FALSE") {
+    static_assert(Crc16::compute("123456789") == 0x29B1, "check value");
+
+    const uint8_t data[] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+    Crc16 crc;
+    crc.update(span<const uint8_t>(data, 4));
+    crc.update(span<const uint8_t>(data + 4, 5));
+    CHECK_EQ(crc.value(), 0x29B1);
+    CHECK_EQ(Crc16::compute(span<const uint8_t>(data)), 0x29B1);
+
+    // CRCをビッグエンディアンで付加すると全体のCRCは0
+    crc.update(0x29);
+    crc.update(0xB1);
+    CHECK_EQ(crc.value(), 0);
+
+    crc.reset();
+    CHECK_EQ(crc.value(), Crc16::INITIAL);
+}
+
+TEST_CASE("Crc32 / Crc32c - チェック値") {
+    static_assert(Crc32::compute("123456789") == 0xCBF43926, "check value");
+    static_assert(Crc32c::compute("123456789") == 0xE3069283, "check value");
+    static_assert(Crc32::compute("") == 0, "empty");
+
+    const uint8_t data[] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+    CHECK_EQ(Crc32::compute(span<const uint8_t>(data)), 0xCBF43926);
+    CHECK_EQ(Crc32c::compute(span<const uint8_t>(data)), 0xE3069283);
+
+    Crc32 crc;
+    crc.update(span<const uint8_t>(data, 2));
+    crc.update(span<const uint8_t>(data + 2, 7));
+    CHECK_EQ(crc.value(), 0xCBF43926);
+
+    // value() は状態を変えない
+    CHECK_EQ(crc.value(), 0xCBF43926);
+
+    crc.reset();
+    for (uint8_t byte : data) {
+        crc.update(byte);
+    }
+    CHECK_EQ(crc.value(), 0xCBF43926);
+}
+
+TEST_CASE("CRC - テーブル・ハードウェア経路と参照実装の一致") {
+    static uint8_t buffer[4096 + 16];
+    Lcg rng;
+    for (uint8_t& byte : buffer) {
+        byte = static_cast<uint8_t>(rng.next());
+    }
+
+    // 長さと開始位置（アラインメント）を変えて一括計算を比較
+    for (size_t offset = 0; offset < 16; offset += 3) {
+        for (size_t n = 0; n <= 4096; n = (n < 200) ? n + 1 : n + 97) {
+            const uint8_t* p = buffer + offset;
+            const span<const uint8_t> data(p, n);
+            CHECK_EQ(Crc32::compute(data), reference_crc32(0xEDB88320, p, n));
+            CHECK_EQ(Crc32c::compute(data), reference_crc32(0x82F63B78, p, n));
+            CHECK_EQ(Crc16::compute(data), reference_crc16(p, n));
+        }
+    }
+
+    // ランダムな分割で逐次計算しても結果は同じ
+    const uint32_t expected32 = reference_crc32(0xEDB88320, buffer, 4096);
+    const uint32_t expected32c = reference_crc32(0x82F63B78, buffer, 4096);
+    const uint16_t expected16 = reference_crc16(buffer, 4096);
+
+    for (uint32_t round = 0; round < 20; ++round) {
+        Crc32 crc32;
+        Crc32c crc32c;
+        Crc16 crc16;
+        size_t position = 0;
+        while (position < 4096) {
+            size_t n = rng.next() % 300;
+            if (n > 4096 - position) {
+                n = 4096 - position;
+            }
+            const span<const uint8_t> chunk(buffer + position, n);
+            crc32.update(chunk);
+            crc32c.update(chunk);
+            crc16.update(chunk);
+            position += n;
+        }
+        CHECK_EQ(crc32.value(), expected32);
+        CHECK_EQ(crc32c.value(), expected32c);
+        CHECK_EQ(crc16.value(), expected16);
+    }
+}
+
+TEST_CASE("CRC - テーブル経路の直接検証") {
+    // ハードウェア経路が選ばれる環境でもテーブル経路を検証する
+    static uint8_t buffer[1024];
+    Lcg rng;
+    for (uint8_t& byte : buffer) {
+        byte = static_cast<uint8_t>(rng.next());
+    }
+
+    for (size_t n = 0; n <= sizeof(buffer); n += 37) {
+        const uint32_t crc32 = detail::crc32_update_table(detail::CRC32_TABLE, 0xFFFFFFFF, buffer, n) ^ 0xFFFFFFFF;
+        const uint32_t crc32c = detail::crc32_update_table(detail::CRC32C_TABLE, 0xFFFFFFFF, buffer, n) ^ 0xFFFFFFFF;
+        CHECK_EQ(crc32, reference_crc32(0xEDB88320, buffer, n));
+        CHECK_EQ(crc32c, reference_crc32(0x82F63B78, buffer, n));
+    }
+}
@@ -0,0 +1,170 @@
+// display_width() / truncate_to_width() の単体テスト
+
+#define DOCTEST_CONFIG_NO_EXCEPTIONS
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <omusubi/core/display_width.hpp>
+#include <omusubi/core/format.hpp>
+#include <omusubi/interface/displayable.h>
+
+#include "doctest.h"
+
+using namespace omusubi;
+using namespace std::literals;
+
+TEST_CASE("utf8::decode - 基本機能") {
+    uint32_t cp = 0;
+
+    SUBCASE("ASCII") {
+        CHECK_EQ(utf8::decode("A", 1, cp), 1);
+        CHECK_EQ(cp, 0x41U);
+    }
+
+    SUBCASE("マルチバイト") {
+        CHECK_EQ(utf8::decode("あ", 3, cp), 3);
+        CHECK_EQ(cp, 0x3042U);
+        CHECK_EQ(utf8::decode("😀", 4, cp), 4);
+        CHECK_EQ(cp, 0x1F600U);
+    }
+
+    SUBCASE("不正なシーケンス") {
+        CHECK_EQ(utf8::decode("\xE3\x81", 2, cp), 1); // 途中で切れている
+        CHECK_EQ(cp, 0xFFFDU);
+        CHECK_EQ(utf8::decode("\x81", 1, cp), 1); // 継続バイトから開始
+        CHECK_EQ(cp, 0xFFFDU);
+        CHECK_EQ(utf8::decode("\xE3\x41\x41", 3, cp), 1); // 継続バイトが不正
+        CHECK_EQ(cp, 0xFFFDU);
+    }
+}
+
+TEST_CASE("utf8::codepoint_width - 文字種別") {
+    SUBCASE("半角") {
+        CHECK_EQ(utf8::codepoint_width('A'), 1);
+        CHECK_EQ(utf8::codepoint_width(0x00E9), 1); // é
+        CHECK_EQ(utf8::codepoint_width(0xFF71), 1); // 半角カナ ｱ
+        CHECK_EQ(utf8::codepoint_width(0x0391), 1); // Α（曖昧幅は1）
+    }
+
+    SUBCASE("全角") {
+        CHECK_EQ(utf8::codepoint_width(0x3042), 2);  // あ
+        CHECK_EQ(utf8::codepoint_width(0x30A2), 2);  // ア
+        CHECK_EQ(utf8::codepoint_width(0x6F22), 2);  // 漢
+        CHECK_EQ(utf8::codepoint_width(0xFF21), 2);  // 全角 Ａ
+        CHECK_EQ(utf8::codepoint_width(0x3000), 2);  // 全角スペース
+        CHECK_EQ(utf8::codepoint_width(0xAC00), 2);  // 가
+        CHECK_EQ(utf8::codepoint_width(0x1F600), 2); // 😀
+        CHECK_EQ(utf8::codepoint_width(0x20000), 2); // CJK拡張B
+    }
+
+    SUBCASE("幅0") {
+        CHECK_EQ(utf8::codepoint_width('\n'), 0);
+        CHECK_EQ(utf8::codepoint_width(0x7F), 0);
+        CHECK_EQ(utf8::codepoint_width(0x0301), 0);  // 結合アキュート
+        CHECK_EQ(utf8::codepoint_width(0x3099), 0);  // 結合濁点
+        CHECK_EQ(utf8::codepoint_width(0x200B), 0);  // ゼロ幅スペース
+        CHECK_EQ(utf8::codepoint_width(0xFE0F), 0);  // 異体字セレクタ
+        CHECK_EQ(utf8::codepoint_width(0xE0100), 0); // 異体字セレクタ補助
+    }
+
+    SUBCASE("ハングル字母の中声・終声は幅0") {
+        CHECK_EQ(utf8::codepoint_width(0x1100), 2); // 初声
+        CHECK_EQ(utf8::codepoint_width(0x1160), 0); // 中声
+        CHECK_EQ(utf8::codepoint_width(0x11A8), 0); // 終声
+        CHECK_EQ(utf8::codepoint_width(0xD7A3), 2); // 힣（音節）
+        CHECK_EQ(utf8::codepoint_width(0xD7B0), 0); // 拡張B 中声
+        CHECK_EQ(utf8::codepoint_width(0xD7C6), 0);
+        CHECK_EQ(utf8::codepoint_width(0xD7CB), 0); // 拡張B 終声
+        CHECK_EQ(utf8::codepoint_width(0xD7FB), 0);
+        CHECK_EQ(utf8::codepoint_width(0xD7FF), 0);
+    }
+}
+
+TEST_CASE("display_width - 文字列") {
+    CHECK_EQ(display_width(""sv), 0U);
+    CHECK_EQ(display_width("Hello"sv), 5U);
+    CHECK_EQ(display_width("こんにちは"sv), 10U);
+    CHECK_EQ(display_width("温度: 25℃"sv), 9U); // ℃ は曖昧幅のため1桁
+    CHECK_EQ(display_width("ｱｲｳ"sv), 3U);
+    CHECK_EQ(display_width("e\xCC\x81"sv), 1U); // e + 結合アキュート
+
+    static_assert(display_width("日本"sv) == 4, "constexpr display_width");
+}
+
+TEST_CASE("truncate_to_width - 切り詰め") {
+    SUBCASE("ASCII") {
+        CHECK_EQ(truncate_to_width("Hello"sv, 3), "Hel"sv);
+        CHECK_EQ(truncate_to_width("Hello"sv, 10), "Hello"sv);
+        CHECK_EQ(truncate_to_width("Hello"sv, 0), ""sv);
+    }
+
+    SUBCASE("全角文字の途中で切れない") {
+        CHECK_EQ(truncate_to_width("温度センサー"sv, 7), "温度セ"sv);
+        CHECK_EQ(truncate_to_width("温度センサー"sv, 6), "温度セ"sv);
+        CHECK_EQ(truncate_to_width("a温度"sv, 2), "a"sv);
+    }
+
+    SUBCASE("結合文字は直前の文字と一緒に残る") {
+        CHECK_EQ(truncate_to_width("e\xCC\x81x"sv, 1), "e\xCC\x81"sv);
+    }
+
+    SUBCASE("measure_width") {
+        const WidthPrefix prefix = measure_width("ab漢字"sv, 5);
+        CHECK_EQ(prefix.byte_length, 5U);
+        CHECK_EQ(prefix.columns, 4U);
+    }
+}
+
+TEST_CASE("format - 幅指定") {
+    SUBCASE("文字列（既定は左寄せ）") {
+        CHECK_EQ(format<32>("[{:6}]", "ab").view(), "[ab    ]"sv);
+        CHECK_EQ(format<32>("[{:>6}]", "ab").view(), "[    ab]"sv);
+        CHECK_EQ(format<32>("[{:^6}]", "ab").view(), "[  ab  ]"sv);
+        CHECK_EQ(format<32>("[{:*<5}]", "ab").view(), "[ab***]"sv);
+    }
+
+    SUBCASE("数値（既定は右寄せ）") {
+        CHECK_EQ(format<32>("[{:5}]", 42).view(), "[   42]"sv);
+        CHECK_EQ(format<32>("[{:0>5}]", 42).view(), "[00042]"sv);
+        CHECK_EQ(format<32>("[{:<5}]", -7).view(), "[-7   ]"sv);
+    }
+
+    SUBCASE("全角文字は2桁として数える") {
+        CHECK_EQ(format<32>("[{:6}]", "温度").view(), "[温度  ]"sv);
+        CHECK_EQ(format<32>("[{:>6}]", "温度").view(), "[  温度]"sv);
+    }
+
+    SUBCASE("精度による切り詰め") {
+        CHECK_EQ(format<32>("[{:.5}]", "温度センサー").view(), "[温度]"sv);
+        CHECK_EQ(format<32>("[{:6.5}]", "温度センサー").view(), "[温度  ]"sv);
+        CHECK_EQ(format<32>("[{:.3}]", "Hello").view(), "[Hel]"sv);
+    }
+
+    SUBCASE("幅より長い場合はそのまま") {
+        CHECK_EQ(format<32>("[{:2}]", "Hello").view(), "[Hello]"sv);
+    }
+
+    SUBCASE("書式指定なしとの混在") {
+        CHECK_EQ(format<64>("{}: {:>4}", "x", 7).view(), "x:    7"sv);
+        CHECK_EQ(detail::count_placeholders("{} {:>4} {{}}", 13), 2U);
+    }
+}
+
+namespace {
+
+class MockDisplay : public Displayable {
+public:
+    void display(std::string_view text) override { last.from_span(span<const char>(text.data(), text.size())); }
+
+    FixedString<64> last;
+};
+
+} // namespace
+
+TEST_CASE("Displayable - display_fit") {
+    MockDisplay display;
+
+    display.display_fit("温度センサー"sv, 7);
+    CHECK_EQ(display.last.view(), "温度セ"sv);
+
+    display.display_fit("OK"sv, 7);
+    CHECK_EQ(display.last.view(), "OK"sv);
+}
@@ -53,6 +53,23 @@ TEST_CASE("FixedBuffer<N> - 容量制限") {
     }
 }
 
+TEST_CASE("FixedBuffer<N> - バイト列の追加") {
+    FixedBuffer<6> buf;
+    const uint8_t bytes[] = {0x01, 0x02, 0x03, 0x04};
+
+    CHECK(buf.append(span<const uint8_t>(bytes)));
+    CHECK_EQ(buf.size(), 4U);
+
+    // 全体が収まらない場合は何も追加しない
+    CHECK_FALSE(buf.append(span<const uint8_t>(bytes, 3)));
+    CHECK_EQ(buf.size(), 4U);
+
+    CHECK(buf.append(span<const uint8_t>(bytes, 2)));
+    CHECK(buf.append(span<const uint8_t>()));
+    CHECK_EQ(buf.size(), 6U);
+    CHECK_EQ(buf[5], 0x02);
+}
+
 TEST_CASE("FixedBuffer<N> - クリア操作") {
     FixedBuffer<16> buf;
     buf.append(0x01);
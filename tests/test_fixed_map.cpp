@@ -0,0 +1,218 @@
+// FixedMap<K, V, N> の単体テスト
+
+#define DOCTEST_CONFIG_NO_EXCEPTIONS
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <omusubi/core/fixed_map.hpp>
+#include <omusubi/core/intern_pool.hpp>
+
+#include "doctest.h"
+
+using namespace omusubi;
+using namespace std::literals;
+
+namespace {
+
+// すべてのキーが同じhomeに衝突するハッシュ
+struct CollidingKey {
+    uint32_t id;
+
+    [[nodiscard]] uint32_t hash() const noexcept { return 0x8000000DU; }
+
+    bool operator==(const CollidingKey& other) const noexcept { return id == other.id; }
+};
+
+struct Counted {
+    static int live;
+
+    int value;
+
+    explicit Counted(int v) noexcept : value(v) { ++live; }
+
+    Counted(const Counted& other) noexcept : value(other.value) { ++live; }
+
+    Counted(Counted&& other) noexcept : value(other.value) { ++live; }
+
+    Counted& operator=(const Counted&) noexcept = default;
+    Counted& operator=(Counted&&) noexcept = default;
+
+    ~Counted() noexcept { --live; }
+};
+
+int Counted::live = 0;
+
+// 線形合同法による決定的な疑似乱数
+uint32_t next_random(uint32_t& state) {
+    state = state * 1664525U + 1013904223U;
+    return state >> 8;
+}
+
+} // namespace
+
+TEST_CASE("FixedMap - 基本機能") {
+    FixedMap<uint32_t, int32_t, 8> map;
+    CHECK(map.is_empty());
+    CHECK_EQ(map.capacity(), 8U);
+    CHECK_EQ((FixedMap<uint32_t, int32_t, 8>::TABLE_SIZE), 16U);
+
+    CHECK(map.insert(1, 100).is_ok());
+    CHECK(map.insert(2, 200).is_ok());
+    CHECK_EQ(map.size(), 2U);
+
+    REQUIRE(map.find(1) != nullptr);
+    CHECK_EQ(*map.find(1), 100);
+    CHECK(map.find(3) == nullptr);
+    CHECK(map.contains(2));
+
+    SUBCASE("上書き") {
+        auto r = map.insert(1, 111);
+        REQUIRE(r.is_ok());
+        CHECK_EQ(*r.value(), 111);
+        CHECK_EQ(map.size(), 2U);
+    }
+
+    SUBCASE("try_emplaceは既存の値を変更しない") {
+        auto r = map.try_emplace(2, 999);
+        REQUIRE(r.is_ok());
+        CHECK_EQ(*r.value(), 200);
+    }
+
+    SUBCASE("削除") {
+        CHECK(map.erase(1));
+        CHECK_FALSE(map.erase(1));
+        CHECK_FALSE(map.contains(1));
+        CHECK_EQ(map.size(), 1U);
+    }
+}
+
+TEST_CASE("FixedMap - 容量超過") {
+    FixedMap<uint32_t, uint32_t, 4> map;
+    for (uint32_t i = 0; i < 4; ++i) {
+        CHECK(map.insert(i, i).is_ok());
+    }
+    CHECK(map.is_full());
+
+    auto r = map.insert(10, 10);
+    REQUIRE(r.is_err());
+    CHECK_EQ(r.error(), Error::BUFFER_FULL);
+
+    // 既存キーの上書きは満杯でも可能
+    CHECK(map.insert(3, 30).is_ok());
+    CHECK_EQ(*map.find(3), 30U);
+}
+
+TEST_CASE("FixedMap - std::string_viewキー") {
+    FixedMap<std::string_view, uint16_t, 4> handlers;
+    CHECK(handlers.insert("180f"sv, 0x0010).is_ok());
+    CHECK(handlers.insert("2a19"sv, 0x0012).is_ok());
+
+    // 別のバッファにある同じ内容の文字列で検索できる
+    const char key[] = {'2', 'a', '1', '9'};
+    const uint16_t* handle = handlers.find(std::string_view(key, 4));
+    REQUIRE(handle != nullptr);
+    CHECK_EQ(*handle, 0x0012);
+    CHECK_FALSE(handlers.contains("2A19"sv));
+}
+
+TEST_CASE("FixedMap - InternHandleキー") {
+    InternPool<64, 4> names;
+    FixedMap<InternHandle, int32_t, 4> map;
+
+    const InternHandle a = names.intern("alpha"sv).value();
+    const InternHandle b = names.intern("beta"sv).value();
+    CHECK(map.insert(a, 1).is_ok());
+    CHECK(map.insert(b, 2).is_ok());
+    CHECK_EQ(*map.find(names.find("beta"sv)), 2);
+}
+
+TEST_CASE("FixedMap - 衝突とバックワードシフト削除") {
+    FixedMap<CollidingKey, uint32_t, 12> map; // 16スロット、全キーが同じhome（末尾から先頭へ折り返す）
+    for (uint32_t i = 0; i < 12; ++i) {
+        CHECK(map.insert(CollidingKey {i}, i * 10).is_ok());
+    }
+
+    // クラスタの途中を削除しても後続キーが見つかる
+    CHECK(map.erase(CollidingKey {0}));
+    CHECK(map.erase(CollidingKey {5}));
+    for (uint32_t i = 0; i < 12; ++i) {
+        const uint32_t* value = map.find(CollidingKey {i});
+        if (i == 0 || i == 5) {
+            CHECK(value == nullptr);
+        } else {
+            REQUIRE(value != nullptr);
+            CHECK_EQ(*value, i * 10);
+        }
+    }
+
+    // 削除を繰り返しても空きスロットが再利用される
+    for (uint32_t round = 0; round < 100; ++round) {
+        CHECK(map.insert(CollidingKey {100 + round}, round).is_ok());
+        CHECK(map.erase(CollidingKey {100 + round}));
+    }
+    CHECK_EQ(map.size(), 10U);
+}
+
+TEST_CASE("FixedMap - ランダム操作を配列の参照実装と比較") {
+    constexpr uint32_t KEY_RANGE = 64;
+    FixedMap<uint32_t, uint32_t, 40> map;
+    uint32_t reference[KEY_RANGE] = {};
+    bool present[KEY_RANGE] = {};
+    uint32_t count = 0;
+    uint32_t state = 12345;
+
+    for (uint32_t step = 0; step < 20000; ++step) {
+        const uint32_t key = next_random(state) % KEY_RANGE;
+        const uint32_t op = next_random(state) % 3;
+
+        if (op == 0) {
+            CHECK_EQ(map.erase(key), present[key]);
+            if (present[key]) {
+                present[key] = false;
+                --count;
+            }
+        } else {
+            const uint32_t value = next_random(state);
+            const bool ok = map.insert(key, value).is_ok();
+            CHECK_EQ(ok, present[key] || count < 40);
+            if (ok) {
+                if (!present[key]) {
+                    ++count;
+                }
+                present[key] = true;
+                reference[key] = value;
+            }
+        }
+
+        REQUIRE_EQ(map.size(), count);
+    }
+
+    for (uint32_t key = 0; key < KEY_RANGE; ++key) {
+        const uint32_t* value = map.find(key);
+        REQUIRE_EQ(value != nullptr, present[key]);
+        if (value != nullptr) {
+            CHECK_EQ(*value, reference[key]);
+        }
+    }
+
+    uint32_t iterated = 0;
+    for (const auto& entry : map) {
+        CHECK(present[entry.key]);
+        ++iterated;
+    }
+    CHECK_EQ(iterated, count);
+}
+
+TEST_CASE("FixedMap - 値の構築と破棄") {
+    Counted::live = 0;
+    {
+        FixedMap<uint32_t, Counted, 8> map;
+        CHECK(map.try_emplace(1, 10).is_ok());
+        CHECK(map.try_emplace(2, 20).is_ok());
+        CHECK(map.try_emplace(3, 30).is_ok());
+        CHECK_EQ(Counted::live, 3);
+
+        CHECK(map.erase(2));
+        CHECK_EQ(Counted::live, 2);
+        CHECK_EQ(map.find(3)->value, 30);
+    }
+    CHECK_EQ(Counted::live, 0);
+}
@@ -0,0 +1,110 @@
+// FixedStringRef の単体テスト
+
+#define DOCTEST_CONFIG_NO_EXCEPTIONS
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <omusubi/core/fixed_string.hpp>
+#include <omusubi/core/fixed_string_ref.hpp>
+#include <omusubi/core/format.hpp>
+
+#include "doctest.h"
+
+using namespace omusubi;
+using namespace std::literals;
+
+namespace {
+
+// 容量に依存しない関数
+bool append_pair(FixedStringRef out, std::string_view key, std::string_view value) {
+    return out.append(key) && out.append('=') && out.append(value);
+}
+
+} // namespace
+
+TEST_CASE("FixedStringRef - FixedStringからの暗黙変換") {
+    FixedString<16> small;
+    FixedString<64> large;
+
+    CHECK(append_pair(small, "temp"sv, "25"sv));
+    CHECK(append_pair(large, "humidity"sv, "60"sv));
+
+    // 参照経由の変更が元の FixedString に反映される
+    CHECK_EQ(small.view(), "temp=25"sv);
+    CHECK_EQ(small.byte_length(), 7U);
+    CHECK_EQ(large.view(), "humidity=60"sv);
+    CHECK_EQ(large.c_str()[large.byte_length()], '\0');
+}
+
+TEST_CASE("FixedStringRef - 基本機能") {
+    FixedString<8> str("abc");
+    FixedStringRef ref = str.ref();
+
+    CHECK_EQ(ref.capacity(), 8U);
+    CHECK_EQ(ref.byte_length(), 3U);
+    CHECK_EQ(ref.remaining(), 5U);
+    CHECK_EQ(ref.view(), "abc"sv);
+    CHECK(ref == "abc"sv);
+    CHECK(ref != "abd"sv);
+    CHECK_EQ(ref.char_length(), 3U);
+
+    SUBCASE("clear") {
+        ref.clear();
+        CHECK(ref.is_empty());
+        CHECK(str.is_empty());
+        CHECK_EQ(str.c_str()[0], '\0');
+    }
+
+    SUBCASE("同じ文字の繰り返し") {
+        CHECK(ref.append(3, '-'));
+        CHECK_EQ(str.view(), "abc---"sv);
+        CHECK_FALSE(ref.append(3, '-'));
+        CHECK_EQ(str.view(), "abc---"sv);
+    }
+
+    SUBCASE("assign（切り捨て）") {
+        ref.assign("0123456789"sv);
+        CHECK_EQ(str.view(), "01234567"sv);
+    }
+}
+
+TEST_CASE("FixedStringRef - 容量制限") {
+    FixedString<5> str;
+    FixedStringRef ref = str;
+
+    CHECK(ref.append("abc"sv));
+    CHECK_FALSE(ref.append("def"sv)); // 全体が収まらない場合は何も追加しない
+    CHECK_EQ(str.view(), "abc"sv);
+    CHECK(ref.append("de"));
+    CHECK_FALSE(ref.append('f'));
+    CHECK_EQ(str.byte_length(), 5U);
+    CHECK_EQ(str.c_str()[5], '\0');
+}
+
+TEST_CASE("FixedStringRef - UTF-8") {
+    FixedString<32> str;
+    FixedStringRef ref = str;
+    CHECK(ref.append("こんにちは"sv));
+    CHECK_EQ(ref.byte_length(), 15U);
+    CHECK_EQ(ref.char_length(), 5U);
+    CHECK_EQ(ref.get_char_position(2), 6U);
+
+    // 文字列処理は FixedString と FixedStringRef で同じ実装を使う
+    CHECK_EQ(ref.get_char(1), "ん"sv);
+    CHECK_EQ(str.get_char(4), "は"sv);
+    CHECK(str.get_char(5).empty());
+    CHECK(ref.equals(str));
+}
+
+TEST_CASE("FixedStringRef - format_to") {
+    FixedString<32> str;
+    FixedStringRef ref = str;
+
+    CHECK(format_to(ref, "{} = {}", "value", 42));
+    CHECK_EQ(str.view(), "value = 42"sv);
+
+    // FixedString を直接渡しても同じ実装が使われる
+    CHECK(format_to(str, "[{:>4}]", 7));
+    CHECK_EQ(str.view(), "[   7]"sv);
+
+    CHECK(format_hex_to(ref, 255U, true));
+    CHECK_EQ(str.view(), "0xFF"sv);
+}
@@ -0,0 +1,227 @@
+// FixedVector<T, N> の単体テスト
+
+#define DOCTEST_CONFIG_NO_EXCEPTIONS
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <omusubi/core/fixed_vector.hpp>
+#include <omusubi/core/types.h>
+
+#include "doctest.h"
+
+using namespace omusubi;
+
+namespace {
+
+// 構築・破棄・ムーブの回数を数える型
+struct Tracked {
+    static int live;
+    static int moves;
+
+    int value;
+    bool moved_from = false;
+
+    explicit Tracked(int v) noexcept : value(v) { ++live; }
+
+    Tracked(const Tracked& other) noexcept : value(other.value) { ++live; }
+
+    Tracked(Tracked&& other) noexcept : value(other.value) {
+        other.moved_from = true;
+        ++live;
+        ++moves;
+    }
+
+    Tracked& operator=(const Tracked& other) noexcept {
+        value = other.value;
+        moved_from = false;
+        return *this;
+    }
+
+    Tracked& operator=(Tracked&& other) noexcept {
+        value = other.value;
+        moved_from = false;
+        other.moved_from = true;
+        ++moves;
+        return *this;
+    }
+
+    ~Tracked() noexcept { --live; }
+};
+
+int Tracked::live = 0;
+int Tracked::moves = 0;
+
+template <typename Vector>
+bool values_equal(const Vector& vec, std::initializer_list<int> expected) {
+    if (vec.size() != expected.size()) {
+        return false;
+    }
+    uint32_t i = 0;
+    for (int value : expected) {
+        if (vec[i++].value != value) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+TEST_CASE("FixedVector - 基本機能") {
+    FixedVector<uint32_t, 4> vec;
+    CHECK(vec.is_empty());
+    CHECK_EQ(vec.capacity(), 4U);
+
+    CHECK(vec.push_back(1U).is_ok());
+    CHECK(vec.push_back(2U).is_ok());
+    auto r = vec.emplace_back(3U);
+    REQUIRE(r.is_ok());
+    CHECK_EQ(*r.value(), 3U);
+
+    CHECK_EQ(vec.size(), 3U);
+    CHECK_EQ(vec.front(), 1U);
+    CHECK_EQ(vec.back(), 3U);
+    CHECK_EQ(*vec.at(1), 2U);
+    CHECK(vec.at(3) == nullptr);
+
+    uint32_t sum = 0;
+    for (uint32_t v : vec) {
+        sum += v;
+    }
+    CHECK_EQ(sum, 6U);
+
+    CHECK(vec.pop_back());
+    CHECK_EQ(vec.size(), 2U);
+    vec.clear();
+    CHECK_FALSE(vec.pop_back());
+}
+
+TEST_CASE("FixedVector - 容量超過") {
+    FixedVector<uint8_t, 2> vec;
+    CHECK(vec.push_back(1).is_ok());
+    CHECK(vec.push_back(2).is_ok());
+    CHECK(vec.is_full());
+
+    auto r = vec.push_back(3);
+    REQUIRE(r.is_err());
+    CHECK_EQ(r.error(), Error::BUFFER_FULL);
+    CHECK_EQ(vec.size(), 2U);
+
+    const uint8_t more[] = {4};
+    CHECK(vec.append(span<const uint8_t>(more, 1)).is_err());
+}
+
+TEST_CASE("FixedVector - 挿入と削除") {
+    FixedVector<int32_t, 8> vec;
+    const int32_t initial[] = {10, 20, 30, 40};
+    REQUIRE(vec.append(span<const int32_t>(initial, 4)).is_ok());
+
+    SUBCASE("insert") {
+        CHECK(vec.insert(1, 15).is_ok());
+        CHECK(vec.insert(5, 50).is_ok()); // 末尾
+        CHECK(vec.insert(0, 5).is_ok());
+        const int32_t expected[] = {5, 10, 15, 20, 30, 40, 50};
+        REQUIRE_EQ(vec.size(), 7U);
+        for (uint32_t i = 0; i < 7; ++i) {
+            CHECK_EQ(vec[i], expected[i]);
+        }
+
+        auto r = vec.insert(9, 0);
+        REQUIRE(r.is_err());
+        CHECK_EQ(r.error(), Error::INVALID_PARAMETER);
+    }
+
+    SUBCASE("erase（順序維持）") {
+        CHECK(vec.erase(1));
+        CHECK_EQ(vec.size(), 3U);
+        CHECK_EQ(vec[0], 10);
+        CHECK_EQ(vec[1], 30);
+        CHECK_EQ(vec[2], 40);
+        CHECK_FALSE(vec.erase(3));
+    }
+
+    SUBCASE("erase_unordered") {
+        CHECK(vec.erase_unordered(0));
+        CHECK_EQ(vec.size(), 3U);
+        CHECK_EQ(vec[0], 40);
+        CHECK_EQ(vec[1], 20);
+        CHECK(vec.erase_unordered(2)); // 末尾
+        CHECK_EQ(vec.size(), 2U);
+    }
+
+    SUBCASE("span変換") {
+        span<const int32_t> view = static_cast<const FixedVector<int32_t, 8>&>(vec).as_span();
+        CHECK_EQ(view.size(), 4U);
+        CHECK_EQ(view[3], 40);
+
+        FixedVector<int32_t, 8> copy;
+        copy.from_span(view);
+        CHECK_EQ(copy.size(), 4U);
+        CHECK_EQ(copy[2], 30);
+    }
+}
+
+TEST_CASE("FixedVector - 非トリビアル型の構築と破棄") {
+    Tracked::live = 0;
+    Tracked::moves = 0;
+
+    {
+        FixedVector<Tracked, 8> vec;
+        CHECK(vec.emplace_back(1).is_ok());
+        CHECK(vec.emplace_back(2).is_ok());
+        CHECK(vec.emplace_back(3).is_ok());
+        CHECK_EQ(Tracked::live, 3);
+
+        CHECK(vec.emplace(1, 9).is_ok());
+        CHECK(values_equal(vec, {1, 9, 2, 3}));
+        CHECK_EQ(Tracked::live, 4);
+
+        CHECK(vec.erase(0));
+        CHECK(values_equal(vec, {9, 2, 3}));
+        CHECK_EQ(Tracked::live, 3);
+
+        CHECK(vec.erase_unordered(0));
+        CHECK(values_equal(vec, {3, 2}));
+        CHECK_EQ(Tracked::live, 2);
+
+        SUBCASE("コピー") {
+            FixedVector<Tracked, 8> copy(vec);
+            CHECK_EQ(Tracked::live, 4);
+            CHECK(values_equal(copy, {3, 2}));
+        }
+
+        SUBCASE("ムーブ") {
+            Tracked::moves = 0;
+            FixedVector<Tracked, 8> moved(static_cast<FixedVector<Tracked, 8>&&>(vec));
+            CHECK_EQ(Tracked::moves, 2);
+            CHECK(vec.is_empty());
+            CHECK_EQ(Tracked::live, 2);
+            CHECK(values_equal(moved, {3, 2}));
+
+            FixedVector<Tracked, 8> assigned;
+            CHECK(assigned.emplace_back(7).is_ok());
+            assigned = static_cast<FixedVector<Tracked, 8>&&>(moved);
+            CHECK(values_equal(assigned, {3, 2}));
+            CHECK_EQ(Tracked::live, 2);
+        }
+
+        SUBCASE("push_back（ムーブ）") {
+            Tracked item(5);
+            Tracked::moves = 0;
+            CHECK(vec.push_back(static_cast<Tracked&&>(item)).is_ok());
+            CHECK_EQ(Tracked::moves, 1);
+            CHECK(item.moved_from);
+        }
+    }
+
+    // デストラクタで全要素が破棄される
+    CHECK_EQ(Tracked::live, 0);
+}
+
+TEST_CASE("FixedVector - Vector3") {
+    FixedVector<Vector3, 4> samples;
+    CHECK(samples.emplace_back(1.0F, 2.0F, 3.0F).is_ok());
+    CHECK(samples.emplace_back(4.0F, 5.0F, 6.0F).is_ok());
+
+    FixedVector<Vector3, 4> copy = samples; // memcpy パス
+    CHECK_EQ(copy.size(), 2U);
+    CHECK_EQ(copy[1].y, 5.0F);
+}
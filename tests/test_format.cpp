@@ -127,6 +127,43 @@ TEST_CASE("Format - 実行時") {
     CHECK_EQ(result.capacity(), 128);
 }
 
+TEST_CASE("Format - 型指定") {
+    SUBCASE("16進数（大文字）") {
+        auto result = format<64>("Value: 0x{:X}", 255);
+        CHECK_EQ(strcmp(result.c_str(), "Value: 0xFF"), 0);
+    }
+
+    SUBCASE("16進数（小文字、右寄せ）") {
+        auto result = format<64>("[{:>8x}]", 0xBEEF);
+        CHECK_EQ(strcmp(result.c_str(), "[    beef]"), 0);
+    }
+
+    SUBCASE("ゼロ埋めの16進数") {
+        auto result = format<64>("{:0>4X}", static_cast<uint8_t>(0x1F));
+        CHECK_EQ(strcmp(result.c_str(), "001F"), 0);
+    }
+
+    SUBCASE("2進数") {
+        auto result = format<64>("{:b} {:b}", 5, 0);
+        CHECK_EQ(strcmp(result.c_str(), "101 0"), 0);
+    }
+
+    SUBCASE("負数は符号と絶対値") {
+        auto result = format<64>("{:x} {:b}", -255, static_cast<int8_t>(-128));
+        CHECK_EQ(strcmp(result.c_str(), "-ff -10000000"), 0);
+    }
+
+    SUBCASE("10進数と既定の表記") {
+        auto result = format<64>("{:d} {:s} {:x}", 42, "ok", "text");
+        CHECK_EQ(strcmp(result.c_str(), "42 ok text"), 0);
+    }
+
+    SUBCASE("解釈できない書式指定はそのまま残る") {
+        auto result = format<64>("{:q} {}", 7);
+        CHECK_EQ(strcmp(result.c_str(), "{:q} 7"), 0);
+    }
+}
+
 TEST_CASE("Format - format_to()") {
     FixedString<128> str;
 
@@ -0,0 +1,279 @@
+// COBS / SLIP フレーミングの単体テスト
+
+#define DOCTEST_CONFIG_NO_EXCEPTIONS
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <omusubi/core/framing.hpp>
+
+#include "doctest.h"
+
+#include <cstring>
+
+using namespace omusubi;
+
+namespace {
+
+// 出力を記録する ByteWritable
+class MemoryWriter : public ByteWritable {
+public:
+    size_t write(span<const uint8_t> data) override {
+        const size_t room = sizeof(data_) - length_;
+        const size_t n = (data.size() < room) ? data.size() : room;
+        std::memcpy(data_ + length_, data.data(), n);
+        length_ += n;
+        ++write_calls;
+        return n;
+    }
+
+    [[nodiscard]] span<const uint8_t> written() const noexcept { return span<const uint8_t>(data_, length_); }
+
+    void clear() noexcept { length_ = 0; }
+
+    uint32_t write_calls = 0;
+
+private:
+    uint8_t data_[4096] = {};
+    size_t length_ = 0;
+};
+
+// 受信したフレームを記録する
+struct Received {
+    uint8_t data[8][600];
+    size_t lengths[8];
+    uint32_t count = 0;
+
+    void operator()(span<const uint8_t> frame) noexcept {
+        if (count < 8) {
+            std::memcpy(data[count], frame.data(), frame.size());
+            lengths[count] = frame.size();
+        }
+        ++count;
+    }
+
+    [[nodiscard]] bool equals(uint32_t index, span<const uint8_t> expected) const noexcept {
+        return lengths[index] == expected.size() && std::memcmp(data[index], expected.data(), expected.size()) == 0;
+    }
+};
+
+uint32_t next_random(uint32_t& state) {
+    state = state * 1664525U + 1013904223U;
+    return state >> 8;
+}
+
+// 0x00 と SLIP の特殊バイトを多めに含む乱数データ
+void fill_random(uint8_t* data, size_t length, uint32_t& state) {
+    for (size_t i = 0; i < length; ++i) {
+        const uint32_t r = next_random(state);
+        switch (r % 8) {
+            case 0:
+                data[i] = 0x00;
+                break;
+            case 1:
+                data[i] = Slip::END;
+                break;
+            case 2:
+                data[i] = Slip::ESC;
+                break;
+            default:
+                data[i] = static_cast<uint8_t>(r >> 8);
+                break;
+        }
+    }
+}
+
+// 受信データを chunk バイトずつデコーダへ渡す
+template <typename Decoder>
+void feed_chunked(Decoder& decoder, span<const uint8_t> data, size_t chunk, Received& received) {
+    for (size_t offset = 0; offset < data.size(); offset += chunk) {
+        const size_t n = (data.size() - offset < chunk) ? data.size() - offset : chunk;
+        decoder.feed(data.subspan(offset, n), received);
+    }
+}
+
+} // namespace
+
+TEST_CASE("CobsEncoder - 符号化") {
+    MemoryWriter writer;
+    CobsEncoder encoder(writer);
+    const uint8_t payload[] = {0x11, 0x00, 0x22, 0x33};
+    REQUIRE(encoder.write_frame(span<const uint8_t>(payload)));
+
+    const uint16_t crc = Crc16::compute(span<const uint8_t>(payload));
+    const uint8_t crc_hi = static_cast<uint8_t>(crc >> 8);
+    const uint8_t crc_lo = static_cast<uint8_t>(crc);
+    REQUIRE(crc_hi != 0);
+    REQUIRE(crc_lo != 0);
+
+    const uint8_t expected[] = {0x02, 0x11, 0x05, 0x22, 0x33, crc_hi, crc_lo, 0x00};
+    span<const uint8_t> out = writer.written();
+    REQUIRE_EQ(out.size(), sizeof(expected));
+    CHECK_EQ(std::memcmp(out.data(), expected, sizeof(expected)), 0);
+
+    // 区切り以外に 0x00 を含まない
+    for (size_t i = 0; i + 1 < out.size(); ++i) {
+        CHECK_NE(out[i], 0);
+    }
+}
+
+TEST_CASE("SlipEncoder - 符号化") {
+    MemoryWriter writer;
+    SlipEncoder encoder(writer);
+    const uint8_t payload[] = {0x01, Slip::END, 0x02, Slip::ESC};
+    REQUIRE(encoder.write_frame(span<const uint8_t>(payload)));
+
+    span<const uint8_t> out = writer.written();
+    const uint8_t head[] = {Slip::END, 0x01, Slip::ESC, Slip::ESC_END, 0x02, Slip::ESC, Slip::ESC_ESC};
+    REQUIRE(out.size() >= sizeof(head) + 3);
+    CHECK_EQ(std::memcmp(out.data(), head, sizeof(head)), 0);
+    CHECK_EQ(out[out.size() - 1], Slip::END);
+}
+
+TEST_CASE("COBS / SLIP - 分割した送受信の往復") {
+    uint32_t state = 42;
+    static uint8_t payloads[5][600];
+    const size_t lengths[] = {0, 1, 253, 254, 600};
+
+    for (uint32_t i = 0; i < 5; ++i) {
+        fill_random(payloads[i], lengths[i], state);
+    }
+    // 0x00 を含まない 254 バイト以上の区間（0xFF ブロック）
+    std::memset(payloads[3], 0x7F, 254);
+
+    for (size_t chunk : {1U, 7U, 4096U}) {
+        MemoryWriter cobs_out;
+        MemoryWriter slip_out;
+        CobsEncoder cobs(cobs_out);
+        SlipEncoder slip(slip_out);
+
+        for (uint32_t i = 0; i < 5; ++i) {
+            // ペイロードも分割して書き込む
+            cobs.begin();
+            slip.begin();
+            for (size_t offset = 0; offset < lengths[i]; offset += 100) {
+                const size_t n = (lengths[i] - offset < 100) ? lengths[i] - offset : 100;
+                CHECK(cobs.write(span<const uint8_t>(payloads[i] + offset, n)));
+                CHECK(slip.write(span<const uint8_t>(payloads[i] + offset, n)));
+            }
+            CHECK(cobs.end());
+            CHECK(slip.end());
+        }
+
+        CobsDecoder<600> cobs_decoder;
+        SlipDecoder<600> slip_decoder;
+        Received cobs_received;
+        Received slip_received;
+        feed_chunked(cobs_decoder, cobs_out.written(), chunk, cobs_received);
+        feed_chunked(slip_decoder, slip_out.written(), chunk, slip_received);
+
+        REQUIRE_EQ(cobs_received.count, 5U);
+        REQUIRE_EQ(slip_received.count, 5U);
+        for (uint32_t i = 0; i < 5; ++i) {
+            CHECK(cobs_received.equals(i, span<const uint8_t>(payloads[i], lengths[i])));
+            CHECK(slip_received.equals(i, span<const uint8_t>(payloads[i], lengths[i])));
+        }
+        CHECK_EQ(cobs_decoder.get_stats().frames, 5U);
+        CHECK_EQ(slip_decoder.get_stats().frames, 5U);
+    }
+}
+
+TEST_CASE("COBS / SLIP - 誤りの検出と再同期") {
+    const uint8_t a[] = {1, 2, 3, 4, 5};
+    const uint8_t b[] = {6, 7, 8};
+
+    SUBCASE("COBS") {
+        MemoryWriter writer;
+        CobsEncoder encoder(writer);
+        CHECK(encoder.write_frame(span<const uint8_t>(a)));
+        const size_t first_length = writer.written().size();
+        CHECK(encoder.write_frame(span<const uint8_t>(b)));
+
+        uint8_t wire[64];
+        const size_t wire_length = writer.written().size();
+        std::memcpy(wire, writer.written().data(), wire_length);
+        wire[2] ^= 0x40; // 1フレーム目を破損
+
+        // 受信途中から始まったゴミ + 破損フレーム + 正常フレーム
+        const uint8_t noise[] = {0x55, 0x66};
+        CobsDecoder<16> decoder;
+        Received received;
+        decoder.feed(span<const uint8_t>(noise), received);
+        decoder.feed(span<const uint8_t>(wire, wire_length), received);
+
+        // ゴミと破損フレームは最初の区切りまでの1フレームとして破棄される
+        REQUIRE_EQ(received.count, 1U);
+        CHECK(received.equals(0, span<const uint8_t>(b)));
+        CHECK_EQ(decoder.get_stats().crc_errors + decoder.get_stats().format_errors, 1U);
+
+        // 破損した1フレーム目だけを受信した場合
+        CobsDecoder<16> fresh;
+        Received first;
+        fresh.feed(span<const uint8_t>(wire, first_length), first);
+        CHECK_EQ(first.count, 0U);
+        CHECK_EQ(fresh.get_stats().crc_errors + fresh.get_stats().format_errors, 1U);
+    }
+
+    SUBCASE("SLIP") {
+        MemoryWriter writer;
+        SlipEncoder encoder(writer);
+        CHECK(encoder.write_frame(span<const uint8_t>(a)));
+        CHECK(encoder.write_frame(span<const uint8_t>(b)));
+
+        uint8_t wire[64];
+        const size_t wire_length = writer.written().size();
+        std::memcpy(wire, writer.written().data(), wire_length);
+        wire[3] ^= 0x01; // 1フレーム目を破損
+
+        SlipDecoder<16> decoder;
+        Received received;
+        decoder.feed(span<const uint8_t>(wire, wire_length), received);
+
+        REQUIRE_EQ(received.count, 1U);
+        CHECK(received.equals(0, span<const uint8_t>(b)));
+        CHECK_EQ(decoder.get_stats().crc_errors, 1U);
+
+        // 不正なエスケープ
+        const uint8_t bad[] = {Slip::END, 0x01, Slip::ESC, 0x01, 0x02, Slip::END};
+        decoder.feed(span<const uint8_t>(bad), received);
+        CHECK_EQ(decoder.get_stats().format_errors, 1U);
+    }
+}
+
+TEST_CASE("COBS / SLIP - 最大フレーム長の超過") {
+    uint8_t big[40];
+    std::memset(big, 0x11, sizeof(big));
+    const uint8_t small[] = {9};
+
+    MemoryWriter cobs_out;
+    MemoryWriter slip_out;
+    CobsEncoder cobs(cobs_out);
+    SlipEncoder slip(slip_out);
+    CHECK(cobs.write_frame(span<const uint8_t>(big)));
+    CHECK(cobs.write_frame(span<const uint8_t>(small)));
+    CHECK(slip.write_frame(span<const uint8_t>(big)));
+    CHECK(slip.write_frame(span<const uint8_t>(small)));
+
+    CobsDecoder<32> cobs_decoder;
+    SlipDecoder<32> slip_decoder;
+    Received cobs_received;
+    Received slip_received;
+    cobs_decoder.feed(cobs_out.written(), cobs_received);
+    slip_decoder.feed(slip_out.written(), slip_received);
+
+    REQUIRE_EQ(cobs_received.count, 1U);
+    REQUIRE_EQ(slip_received.count, 1U);
+    CHECK(cobs_received.equals(0, span<const uint8_t>(small)));
+    CHECK_EQ(cobs_decoder.get_stats().overflow_errors, 1U);
+    CHECK_EQ(slip_decoder.get_stats().overflow_errors, 1U);
+}
+
+TEST_CASE("SlipEncoder - 入力をコピーせず writev で出力") {
+    MemoryWriter writer;
+    SlipEncoder encoder(writer);
+    uint8_t payload[100];
+    std::memset(payload, 0x33, sizeof(payload));
+
+    encoder.begin();
+    CHECK(encoder.write(span<const uint8_t>(payload)));
+    // END と 100 バイトの区間を1回の writev（デフォルト実装では2回の write）で出力
+    CHECK_EQ(writer.write_calls, 2U);
+    CHECK(encoder.end());
+}
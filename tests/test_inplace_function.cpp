@@ -0,0 +1,149 @@
+// InplaceFunction の単体テスト
+
+#define DOCTEST_CONFIG_NO_EXCEPTIONS
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <omusubi/core/inplace_function.hpp>
+
+#include "doctest.h"
+
+#include <cstdint>
+
+using namespace omusubi;
+
+namespace {
+
+int twice(int x) {
+    return x * 2;
+}
+
+// 生存数を数える関数オブジェクト
+struct Counted {
+    static int alive;
+    int* calls;
+
+    explicit Counted(int* c) noexcept : calls(c) { ++alive; }
+
+    Counted(Counted&& other) noexcept : calls(other.calls) { ++alive; }
+
+    Counted(const Counted&) = delete;
+    Counted& operator=(const Counted&) = delete;
+    Counted& operator=(Counted&&) = delete;
+
+    ~Counted() { --alive; }
+
+    void operator()() const { ++*calls; }
+};
+
+int Counted::alive = 0;
+
+// ムーブ専用の所有権
+struct UniqueToken {
+    int* owner;
+
+    explicit UniqueToken(int* o) noexcept : owner(o) {}
+
+    UniqueToken(UniqueToken&& other) noexcept : owner(other.owner) { other.owner = nullptr; }
+
+    UniqueToken(const UniqueToken&) = delete;
+    UniqueToken& operator=(const UniqueToken&) = delete;
+    UniqueToken& operator=(UniqueToken&&) = delete;
+    ~UniqueToken() = default;
+};
+
+} // namespace
+
+TEST_CASE("InplaceFunction - 基本") {
+    SUBCASE("空") {
+        InplaceFunction<void()> empty;
+        CHECK_FALSE(empty);
+        InplaceFunction<void()> null = nullptr;
+        CHECK_FALSE(null);
+    }
+
+    SUBCASE("関数ポインタ") {
+        InplaceFunction<int(int)> f = &twice;
+        REQUIRE(f);
+        CHECK_EQ(f(21), 42);
+    }
+
+    SUBCASE("捕捉したラムダ") {
+        int total = 0;
+        InplaceFunction<void(int)> add = [&total](int n) { total += n; };
+        add(3);
+        add(4);
+        CHECK_EQ(total, 7);
+    }
+
+    SUBCASE("mutable ラムダは状態を持つ") {
+        InplaceFunction<int()> counter = [n = 0]() mutable { return ++n; };
+        CHECK_EQ(counter(), 1);
+        CHECK_EQ(counter(), 2);
+    }
+
+    SUBCASE("戻り値の変換") {
+        InplaceFunction<int64_t(int32_t)> widen = [](int32_t x) { return x; };
+        CHECK_EQ(widen(-5), -5);
+    }
+
+    SUBCASE("容量を指定してより大きな捕捉を保持") {
+        uint8_t block[32] = {};
+        block[31] = 9;
+        InplaceFunction<int(), 40> read_last = [block]() { return block[31]; };
+        CHECK_EQ(read_last(), 9);
+        CHECK_GE(sizeof(read_last), 40U);
+    }
+}
+
+TEST_CASE("InplaceFunction - ムーブと破棄") {
+    int calls = 0;
+    Counted::alive = 0;
+
+    SUBCASE("ムーブで中身が移る") {
+        InplaceFunction<void()> a = Counted(&calls);
+        CHECK_EQ(Counted::alive, 1);
+
+        InplaceFunction<void()> b = static_cast<InplaceFunction<void()>&&>(a);
+        CHECK_FALSE(a);
+        REQUIRE(b);
+        CHECK_EQ(Counted::alive, 1);
+        b();
+        CHECK_EQ(calls, 1);
+    }
+
+    SUBCASE("代入で前の中身を破棄") {
+        InplaceFunction<void()> a = Counted(&calls);
+        InplaceFunction<void()> b = Counted(&calls);
+        CHECK_EQ(Counted::alive, 2);
+
+        b = static_cast<InplaceFunction<void()>&&>(a);
+        CHECK_EQ(Counted::alive, 1);
+        b = nullptr;
+        CHECK_EQ(Counted::alive, 0);
+        CHECK_FALSE(b);
+    }
+
+    SUBCASE("スコープを抜けると破棄") {
+        {
+            InplaceFunction<void()> a = Counted(&calls);
+            a();
+        }
+        CHECK_EQ(Counted::alive, 0);
+        CHECK_EQ(calls, 1);
+    }
+
+    SUBCASE("ムーブ専用の捕捉") {
+        int resource = 5;
+        InplaceFunction<int()> owner = [token = UniqueToken(&resource)]() { return *token.owner; };
+        InplaceFunction<int()> moved = static_cast<InplaceFunction<int()>&&>(owner);
+        CHECK_EQ(moved(), 5);
+    }
+
+    SUBCASE("トリビアルな捕捉のムーブ") {
+        int value = 11;
+        InplaceFunction<int()> a = [p = &value]() { return *p; };
+        InplaceFunction<int()> b;
+        b = static_cast<InplaceFunction<int()>&&>(a);
+        CHECK_FALSE(a);
+        CHECK_EQ(b(), 11);
+    }
+}
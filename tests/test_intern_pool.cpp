@@ -0,0 +1,144 @@
+// InternPool<ArenaSize, MaxEntries> の単体テスト
+
+#define DOCTEST_CONFIG_NO_EXCEPTIONS
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <omusubi/core/intern_pool.hpp>
+
+#include "doctest.h"
+
+using namespace omusubi;
+using namespace std::literals;
+
+TEST_CASE("hash_string - 基本機能") {
+    SUBCASE("FNV-1a 既知の値") {
+        CHECK_EQ(hash_string(""sv), 2166136261U);
+        CHECK_EQ(hash_string("a"sv), 0xE40C292CU);
+    }
+
+    SUBCASE("コンパイル時計算") {
+        constexpr uint32_t h = hash_string("device"sv);
+        static_assert(h == hash_string("device"sv), "constexpr hash");
+        CHECK_NE(h, hash_string("Device"sv));
+    }
+}
+
+TEST_CASE("InternPool - 基本機能") {
+    InternPool<64, 8> pool;
+    CHECK_EQ(pool.size(), 0U);
+    CHECK_EQ(pool.capacity(), 8U);
+
+    auto a = pool.intern("M5Stack"sv);
+    REQUIRE(a.is_ok());
+    CHECK(a.value().is_valid());
+    CHECK_EQ(pool.view(a.value()), "M5Stack"sv);
+    CHECK_EQ(std::strcmp(pool.c_str(a.value()), "M5Stack"), 0);
+    CHECK_EQ(pool.size(), 1U);
+}
+
+TEST_CASE("InternPool - 重複排除") {
+    InternPool<64, 8> pool;
+
+    auto a = pool.intern("sensor/temp"sv);
+    auto b = pool.intern("sensor/humidity"sv);
+    auto c = pool.intern("sensor/temp"sv);
+    REQUIRE(a.is_ok());
+    REQUIRE(b.is_ok());
+    REQUIRE(c.is_ok());
+
+    SUBCASE("同じ文字列は同じハンドル") {
+        CHECK(a.value() == c.value());
+        CHECK_EQ(a.value().hash(), c.value().hash());
+    }
+
+    SUBCASE("異なる文字列は異なるハンドル") {
+        CHECK(a.value() != b.value());
+    }
+
+    SUBCASE("重複登録はアリーナを消費しない") {
+        CHECK_EQ(pool.size(), 2U);
+        CHECK_EQ(pool.get_stats().bytes_used, 12U + 16U);
+    }
+}
+
+TEST_CASE("InternPool - 検索") {
+    InternPool<64, 8> pool;
+    auto a = pool.intern("key"sv);
+    REQUIRE(a.is_ok());
+
+    CHECK(pool.find("key"sv) == a.value());
+    CHECK(pool.contains("key"sv));
+    CHECK_FALSE(pool.find("missing"sv).is_valid());
+    CHECK_FALSE(pool.contains("ke"sv));
+}
+
+TEST_CASE("InternPool - 空文字列") {
+    InternPool<16, 4> pool;
+    auto a = pool.intern(""sv);
+    auto b = pool.intern(""sv);
+    REQUIRE(a.is_ok());
+    REQUIRE(b.is_ok());
+    CHECK(a.value() == b.value());
+    CHECK(pool.view(a.value()).empty());
+}
+
+TEST_CASE("InternPool - 容量制限") {
+    SUBCASE("エントリ数超過") {
+        InternPool<64, 2> pool;
+        CHECK(pool.intern("a"sv).is_ok());
+        CHECK(pool.intern("b"sv).is_ok());
+
+        auto c = pool.intern("c"sv);
+        REQUIRE(c.is_err());
+        CHECK_EQ(c.error(), Error::BUFFER_FULL);
+
+        // 既存の文字列は容量超過後も取得できる
+        CHECK(pool.intern("a"sv).is_ok());
+    }
+
+    SUBCASE("アリーナ超過") {
+        InternPool<8, 4> pool;
+        CHECK(pool.intern("abcdef"sv).is_ok()); // 7バイト使用
+        CHECK(pool.intern(""sv).is_ok());       // 1バイト使用
+
+        auto r = pool.intern("x"sv);
+        REQUIRE(r.is_err());
+        CHECK_EQ(r.error(), Error::BUFFER_FULL);
+    }
+}
+
+TEST_CASE("InternPool - 無効なハンドル") {
+    InternPool<16, 4> pool;
+    InternHandle invalid;
+    CHECK_FALSE(invalid.is_valid());
+    CHECK_FALSE(pool.owns(invalid));
+    CHECK(pool.view(invalid).empty());
+    CHECK_EQ(pool.c_str(invalid)[0], '\0');
+    CHECK_FALSE(pool.owns(InternHandle(3)));
+}
+
+TEST_CASE("InternPool - 統計とクリア") {
+    InternPool<256, 16> pool;
+    for (char c = 'a'; c < 'a' + 16; ++c) {
+        const char key[] = {'k', c};
+        CHECK(pool.intern(std::string_view(key, 2)).is_ok());
+    }
+
+    auto stats = pool.get_stats();
+    CHECK_EQ(stats.string_count, 16U);
+    CHECK_EQ(stats.string_capacity, 16U);
+    CHECK_EQ(stats.bytes_used, 48U);
+    CHECK_EQ(stats.bytes_capacity, 256U);
+    CHECK_EQ(stats.table_size, 32U);
+    CHECK_LT(stats.max_probe_length, stats.table_size);
+
+    // 全エントリが検索可能
+    for (char c = 'a'; c < 'a' + 16; ++c) {
+        const char key[] = {'k', c};
+        CHECK(pool.contains(std::string_view(key, 2)));
+    }
+
+    pool.clear();
+    CHECK_EQ(pool.size(), 0U);
+    CHECK_EQ(pool.get_stats().bytes_used, 0U);
+    CHECK_FALSE(pool.contains("ka"sv));
+}
@@ -0,0 +1,475 @@
+// JsonWriter / JsonReader の単体テスト
+
+#define DOCTEST_CONFIG_NO_EXCEPTIONS
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <omusubi/core/fixed_string.hpp>
+#include <omusubi/core/json.hpp>
+
+#include "doctest.h"
+
+#include <cstring>
+
+using namespace omusubi;
+
+namespace {
+
+// 出力を記録する TextWritable
+class MemoryTextWriter : public TextWritable {
+public:
+    size_t write_text(span<const char> text) override {
+        const size_t room = sizeof(data_) - length_;
+        const size_t n = (text.size() < room) ? text.size() : room;
+        std::memcpy(data_ + length_, text.data(), n);
+        length_ += n;
+        return n;
+    }
+
+    [[nodiscard]] std::string_view written() const noexcept { return std::string_view(data_, length_); }
+
+private:
+    char data_[32] = {};
+    size_t length_ = 0;
+};
+
+std::string_view format_double(double value, uint32_t decimals) {
+    static char buffer[48];
+    const uint32_t n = detail::json_format_double(value, decimals, buffer);
+    return std::string_view(buffer, n);
+}
+
+template <typename T>
+std::string_view format_shortest(T value) {
+    static char buffer[32];
+    const uint32_t n = detail::json_format_shortest(value, buffer);
+    return std::string_view(buffer, n);
+}
+
+// トークンの種類と文字列を順に取り出す
+template <uint32_t MaxDepth>
+JsonToken next_token(JsonReader<MaxDepth>& reader) {
+    const Result<JsonToken> token = reader.next();
+    if (token.is_err()) {
+        JsonToken error;
+        error.text = "<error>";
+        return error;
+    }
+    return token.value();
+}
+
+} // namespace
+
+TEST_CASE("JsonWriter - オブジェクトと配列") {
+    FixedString<128> json;
+    JsonWriter writer(json);
+    writer.begin_object();
+    writer.write("name", "omusubi");
+    writer.write("count", 42);
+    writer.write("offset", -7);
+    writer.write("ok", true);
+    writer.key("none");
+    writer.write(nullptr);
+    const int32_t values[] = {1, 2, 3};
+    writer.write("values", span<const int32_t>(values));
+    writer.key("empty");
+    writer.begin_array();
+    writer.end_array();
+    writer.write("accel", Vector3(0.5F, -1.0F, 9.75F));
+    writer.end_object();
+
+    const Result<uint32_t> size = writer.finish();
+    REQUIRE(size.is_ok());
+    CHECK(json.view() == R"({"name":"omusubi","count":42,"offset":-7,"ok":true,"none":null,"values":[1,2,3],"empty":[],"accel":[0.5,-1,9.75]})");
+    CHECK_EQ(size.value(), json.byte_length());
+}
+
+TEST_CASE("JsonWriter - 文字列のエスケープ") {
+    FixedString<128> json;
+    JsonWriter writer(json);
+    writer.write(std::string_view("quote\" back\\ nl\n tab\t ctl\x01 bell\x1f utf8:\xE3\x81\x82 long-run-without-specials-to-cover-simd-path\r"));
+    REQUIRE(writer.finish().is_ok());
+    CHECK(json.view() == R"("quote\" back\\ nl\n tab\t ctl\u0001 bell\u001f utf8:)" "\xE3\x81\x82" R"( long-run-without-specials-to-cover-simd-path\r")");
+}
+
+TEST_CASE("JsonWriter - 浮動小数点数") {
+    CHECK(format_double(23.5, 6) == "23.5");
+    CHECK(format_double(0.1F, 6) == "0.1");
+    CHECK(format_double(-1.25, 1) == "-1.3");
+    CHECK(format_double(0.0, 6) == "0");
+    CHECK(format_double(-0.0, 6) == "0");
+    CHECK(format_double(100.0, 3) == "100");
+    CHECK(format_double(0.999, 2) == "1");
+    CHECK(format_double(1.0e20, 3) == "1e20");
+    CHECK(format_double(-2.5e-9, 6) == "-2.5e-9");
+    CHECK(format_double(9.9999999e30, 3) == "1e31");
+    CHECK(format_double(123456789.125, 3) == "123456789.125");
+    CHECK(format_double(std::numeric_limits<double>::denorm_min(), 6) == "4.940656e-324");
+    CHECK(format_double(-std::numeric_limits<double>::denorm_min(), 0) == "-5e-324");
+    CHECK(format_double(std::numeric_limits<double>::min(), 6) == "2.225074e-308");
+    CHECK(format_double(std::numeric_limits<double>::max(), 6) == "1.797693e308");
+    CHECK(format_double(std::numeric_limits<double>::quiet_NaN(), 6) == "null");
+    CHECK(format_double(std::numeric_limits<double>::infinity(), 6) == "null");
+
+    // 書式化した値は parse<double> で読み戻せる
+    const double samples[] = {3.14159, -273.15, 1.0e-7, 6.02e23, 42.0};
+    for (double sample : samples) {
+        const Result<double> parsed = parse<double>(format_double(sample, 6));
+        REQUIRE(parsed.is_ok());
+        CHECK(std::fabs(parsed.value() - sample) <= std::fabs(sample) * 1.0e-6);
+    }
+
+    // 非正規化数も最も近い値に読み戻せる
+    const Result<double> denormal = parse<double>(format_double(std::numeric_limits<double>::denorm_min(), 0));
+    REQUIRE(denormal.is_ok());
+    CHECK(denormal.value() == std::numeric_limits<double>::denorm_min());
+}
+
+TEST_CASE("JsonWriter - 浮動小数点数の最短表記") {
+    CHECK(format_shortest(0.1234567891) == "0.1234567891");
+    CHECK(format_shortest(99999999.9999999) == "99999999.9999999");
+    CHECK(format_shortest(23.5) == "23.5");
+    CHECK(format_shortest(0.1) == "0.1");
+    CHECK(format_shortest(0.1F) == "0.1");
+    CHECK(format_shortest(16777216.0F) == "16777216");
+    CHECK(format_shortest(-273.15) == "-273.15");
+    CHECK(format_shortest(0.0) == "0");
+    CHECK(format_shortest(-0.0) == "0");
+    CHECK(format_shortest(100.0) == "100");
+    CHECK(format_shortest(1.0e20) == "100000000000000000000");
+    CHECK(format_shortest(1.0e21) == "1e21");
+    CHECK(format_shortest(0.000001) == "0.000001");
+    CHECK(format_shortest(1.0e-7) == "1e-7");
+    CHECK(format_shortest(-2.5e-9) == "-2.5e-9");
+    CHECK(format_shortest(std::numeric_limits<double>::denorm_min()) == "5e-324");
+    CHECK(format_shortest(std::numeric_limits<double>::max()) == "1.7976931348623157e308");
+    CHECK(format_shortest(std::numeric_limits<float>::max()) == "3.4028235e38");
+    CHECK(format_shortest(std::numeric_limits<double>::quiet_NaN()) == "null");
+    CHECK(format_shortest(-std::numeric_limits<float>::infinity()) == "null");
+
+    // write() は既定で最短表記、write_float() は桁数指定
+    FixedString<64> json;
+    JsonWriter writer(json);
+    writer.begin_array();
+    writer.write(0.1234567891);
+    writer.write(99999999.9999999);
+    writer.write_float(0.1234567891, 3);
+    writer.end_array();
+    REQUIRE(writer.finish().is_ok());
+    CHECK(json.view() == "[0.1234567891,99999999.9999999,0.123]");
+}
+
+TEST_CASE("JsonWriter - 最短表記は元の値に読み戻せる") {
+    // 任意のビット列（非正規化数・大小の指数を含む）で往復を確かめる
+    uint64_t state = 0x9E3779B97F4A7C15ULL;
+    const auto next = [&state]() {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        return state;
+    };
+
+    for (uint32_t i = 0; i < 20000; ++i) {
+        const uint64_t bits = next();
+        double value = 0.0;
+        std::memcpy(&value, &bits, sizeof(value));
+        if (!std::isfinite(value)) {
+            continue;
+        }
+        const Result<double> parsed = parse<double>(format_shortest(value));
+        REQUIRE(parsed.is_ok());
+        CHECK(parsed.value() == value);
+    }
+
+    for (uint32_t i = 0; i < 20000; ++i) {
+        const auto bits = static_cast<uint32_t>(next());
+        float value = 0.0F;
+        std::memcpy(&value, &bits, sizeof(value));
+        if (!std::isfinite(value)) {
+            continue;
+        }
+        const Result<float> parsed = parse<float>(format_shortest(value));
+        REQUIRE(parsed.is_ok());
+        CHECK(parsed.value() == value);
+    }
+}
+
+TEST_CASE("JsonWriter - 構造の誤りと容量不足") {
+    FixedString<64> json;
+
+    SUBCASE("キーのない値") {
+        JsonWriter writer(json);
+        writer.begin_object();
+        CHECK_FALSE(writer.write(1));
+        const Result<uint32_t> result = writer.finish();
+        REQUIRE(result.is_err());
+        CHECK_EQ(result.error(), Error::INVALID_PARAMETER);
+    }
+
+    SUBCASE("閉じていない") {
+        JsonWriter writer(json);
+        writer.begin_array();
+        writer.write(1);
+        const Result<uint32_t> result = writer.finish();
+        REQUIRE(result.is_err());
+        CHECK_EQ(result.error(), Error::INVALID_PARAMETER);
+    }
+
+    SUBCASE("対応しない閉じ括弧") {
+        JsonWriter writer(json);
+        writer.begin_array();
+        CHECK_FALSE(writer.end_object());
+    }
+
+    SUBCASE("入れ子の上限") {
+        JsonWriter<FixedString<64>, 2> writer(json);
+        CHECK(writer.begin_array());
+        CHECK(writer.begin_array());
+        CHECK_FALSE(writer.begin_array());
+        const Result<uint32_t> result = writer.finish();
+        REQUIRE(result.is_err());
+        CHECK_EQ(result.error(), Error::BUFFER_FULL);
+    }
+
+    SUBCASE("容量不足") {
+        FixedString<8> small;
+        JsonWriter writer(small);
+        writer.write("0123456789");
+        const Result<uint32_t> result = writer.finish();
+        REQUIRE(result.is_err());
+        CHECK_EQ(result.error(), Error::BUFFER_FULL);
+    }
+}
+
+TEST_CASE("JsonWriter - TextWritable への出力") {
+    MemoryTextWriter sink;
+    JsonWriter writer(sink);
+    writer.begin_array();
+    writer.write(1);
+    writer.write("a");
+    writer.end_array();
+    REQUIRE(writer.finish().is_ok());
+    CHECK(sink.written() == R"([1,"a"])");
+
+    writer.begin_array();
+    const Result<uint32_t> second_root = writer.finish();
+    REQUIRE(second_root.is_err());
+    CHECK_EQ(second_root.error(), Error::INVALID_PARAMETER);
+
+    MemoryTextWriter full;
+    JsonWriter overflow(full);
+    overflow.write("this string does not fit in the sink");
+    const Result<uint32_t> failed = overflow.finish();
+    REQUIRE(failed.is_err());
+    CHECK_EQ(failed.error(), Error::WRITE_FAILED);
+}
+
+TEST_CASE("JsonReader - トークン列") {
+    const std::string_view json = R"(
+        {
+            "id": 7,
+            "name": "sensor \"A\"",
+            "gains": [1.5, -2e3, 0],
+            "enabled": true,
+            "parent": null,
+            "nested": {"empty": {}, "list": []},
+            "off": false
+        }
+    )";
+
+    JsonReader reader(json);
+    const JsonTokenType expected[] = {
+        JsonTokenType::BEGIN_OBJECT, JsonTokenType::KEY,        JsonTokenType::NUMBER,       JsonTokenType::KEY,        JsonTokenType::STRING,     JsonTokenType::KEY,
+        JsonTokenType::BEGIN_ARRAY,  JsonTokenType::NUMBER,     JsonTokenType::NUMBER,       JsonTokenType::NUMBER,     JsonTokenType::END_ARRAY,  JsonTokenType::KEY,
+        JsonTokenType::TRUE_VALUE,   JsonTokenType::KEY,        JsonTokenType::NULL_VALUE,   JsonTokenType::KEY,        JsonTokenType::BEGIN_OBJECT, JsonTokenType::KEY,
+        JsonTokenType::BEGIN_OBJECT, JsonTokenType::END_OBJECT, JsonTokenType::KEY,          JsonTokenType::BEGIN_ARRAY, JsonTokenType::END_ARRAY, JsonTokenType::END_OBJECT,
+        JsonTokenType::KEY,          JsonTokenType::FALSE_VALUE, JsonTokenType::END_OBJECT,  JsonTokenType::END,
+    };
+
+    std::string_view texts[sizeof(expected)];
+    bool escaped[sizeof(expected)] = {};
+    uint32_t count = 0;
+    for (JsonTokenType type : expected) {
+        const JsonToken token = next_token(reader);
+        CHECK(token.type == type);
+        texts[count] = token.text;
+        escaped[count] = token.escaped;
+        ++count;
+    }
+
+    CHECK(texts[1] == "id");
+    CHECK(texts[2] == "7");
+    CHECK(texts[4] == R"(sensor \"A\")");
+    CHECK(escaped[4]);
+    CHECK_FALSE(escaped[3]);
+    CHECK(texts[8] == "-2e3");
+    CHECK_EQ(reader.depth(), 0U);
+
+    // キーは入力へのビュー
+    CHECK_EQ(texts[1].data(), json.data() + json.find("id"));
+
+    // END の後も END を返す
+    CHECK(next_token(reader).type == JsonTokenType::END);
+}
+
+TEST_CASE("JsonReader - 数値の変換と文字列の復元") {
+    JsonReader reader(R"(["café 🍙\n", -12, 3.25e1, "x"])");
+    CHECK(next_token(reader).type == JsonTokenType::BEGIN_ARRAY);
+
+    const JsonToken text = next_token(reader);
+    REQUIRE(text.escaped);
+    char buffer[32];
+    const Result<std::string_view> unescaped = json_unescape(text.text, span<char>(buffer));
+    REQUIRE(unescaped.is_ok());
+    CHECK(unescaped.value() == "caf\xC3\xA9 \xF0\x9F\x8D\x99\n");
+
+    char tiny[4];
+    const Result<std::string_view> too_small = json_unescape(text.text, span<char>(tiny));
+    REQUIRE(too_small.is_err());
+    CHECK_EQ(too_small.error(), Error::BUFFER_FULL);
+
+    const Result<std::string_view> lone_surrogate = json_unescape(R"(\udf59)", span<char>(buffer));
+    CHECK(lone_surrogate.is_err());
+
+    const JsonToken integer = next_token(reader);
+    const Result<int32_t> i = integer.as<int32_t>();
+    REQUIRE(i.is_ok());
+    CHECK_EQ(i.value(), -12);
+
+    const JsonToken real = next_token(reader);
+    const Result<float> f = real.as<float>();
+    REQUIRE(f.is_ok());
+    CHECK_EQ(f.value(), 32.5F);
+    CHECK(real.as<uint8_t>().is_err());
+
+    const JsonToken string = next_token(reader);
+    CHECK(string.as<int32_t>().is_err());
+}
+
+TEST_CASE("JsonReader - 値の読み飛ばし") {
+    JsonReader reader(R"({"skip": {"a": [1, {"b": 2}], "c": "}"}, "keep": 5})");
+    CHECK(next_token(reader).type == JsonTokenType::BEGIN_OBJECT);
+    CHECK(next_token(reader).text == "skip");
+
+    const Result<std::string_view> skipped = reader.skip();
+    REQUIRE(skipped.is_ok());
+    CHECK(skipped.value() == R"({"a": [1, {"b": 2}], "c": "}"})");
+
+    CHECK(next_token(reader).text == "keep");
+    const Result<std::string_view> scalar = reader.skip();
+    REQUIRE(scalar.is_ok());
+    CHECK(scalar.value() == "5");
+    CHECK(next_token(reader).type == JsonTokenType::END_OBJECT);
+    CHECK(next_token(reader).type == JsonTokenType::END);
+}
+
+TEST_CASE("JsonReader - 配列の要素の読み飛ばし") {
+    JsonReader reader(R"([1, {"a":[2,3]} ,4])");
+    CHECK(next_token(reader).type == JsonTokenType::BEGIN_ARRAY);
+
+    const Result<std::string_view> first = reader.skip();
+    REQUIRE(first.is_ok());
+    CHECK(first.value() == "1");
+
+    const Result<std::string_view> second = reader.skip();
+    REQUIRE(second.is_ok());
+    CHECK(second.value() == R"({"a":[2,3]})");
+
+    const Result<std::string_view> third = reader.skip();
+    REQUIRE(third.is_ok());
+    CHECK(third.value() == "4");
+
+    // 閉じ括弧は読まず、リーダーもエラーにしない
+    const Result<std::string_view> end = reader.skip();
+    REQUIRE(end.is_err());
+    CHECK_EQ(end.error(), Error::INVALID_DATA);
+    CHECK(next_token(reader).type == JsonTokenType::END_ARRAY);
+    CHECK(next_token(reader).type == JsonTokenType::END);
+}
+
+TEST_CASE("JsonReader - 値の位置以外での読み飛ばし") {
+    SUBCASE("空の配列・オブジェクト") {
+        JsonReader reader("[[], {}]");
+        CHECK(next_token(reader).type == JsonTokenType::BEGIN_ARRAY);
+        CHECK(next_token(reader).type == JsonTokenType::BEGIN_ARRAY);
+        CHECK(reader.skip().is_err());
+        CHECK(next_token(reader).type == JsonTokenType::END_ARRAY);
+        CHECK(next_token(reader).type == JsonTokenType::BEGIN_OBJECT);
+        CHECK(reader.skip().is_err());
+        CHECK(next_token(reader).type == JsonTokenType::END_OBJECT);
+        CHECK(next_token(reader).type == JsonTokenType::END_ARRAY);
+    }
+
+    SUBCASE("オブジェクトの値の後（次はキー）") {
+        JsonReader reader(R"({"a": 1, "b": 2})");
+        CHECK(next_token(reader).type == JsonTokenType::BEGIN_OBJECT);
+        CHECK(next_token(reader).text == "a");
+        CHECK(next_token(reader).text == "1");
+        CHECK(reader.skip().is_err());
+        CHECK(next_token(reader).text == "b");
+    }
+}
+
+TEST_CASE("JsonReader - エラー") {
+    const auto error_of = [](std::string_view json) {
+        JsonReader<4> reader(json);
+        for (uint32_t i = 0; i < 64; ++i) {
+            const Result<JsonToken> token = reader.next();
+            if (token.is_err()) {
+                return token.error();
+            }
+            if (token.value().type == JsonTokenType::END) {
+                return Error::OK;
+            }
+        }
+        return Error::UNKNOWN;
+    };
+
+    // 正しい入力
+    CHECK_EQ(error_of(R"([1, "a", {"b": [true, false, null]}])"), Error::OK);
+    CHECK_EQ(error_of("  0  "), Error::OK);
+
+    // 途中で終わる入力
+    CHECK_EQ(error_of(R"({"a": 1)"), Error::BUFFER_EMPTY);
+    CHECK_EQ(error_of(R"(["abc)"), Error::BUFFER_EMPTY);
+    CHECK_EQ(error_of("[tr"), Error::BUFFER_EMPTY);
+    CHECK_EQ(error_of("[1."), Error::BUFFER_EMPTY);
+    CHECK_EQ(error_of(""), Error::BUFFER_EMPTY);
+
+    // 構文の誤り
+    CHECK_EQ(error_of("[1,]"), Error::INVALID_DATA);
+    CHECK_EQ(error_of(R"({"a" 1})"), Error::INVALID_DATA);
+    CHECK_EQ(error_of("{1: 2}"), Error::INVALID_DATA);
+    CHECK_EQ(error_of("[01]"), Error::INVALID_DATA);
+    CHECK_EQ(error_of("[1.e5]"), Error::INVALID_DATA);
+    CHECK_EQ(error_of("[tru]"), Error::INVALID_DATA);
+    CHECK_EQ(error_of(R"(["a\x"])"), Error::INVALID_DATA);
+    CHECK_EQ(error_of("[\"tab\there\"]"), Error::INVALID_DATA);
+    CHECK_EQ(error_of("[1] 2"), Error::INVALID_DATA);
+    CHECK_EQ(error_of("[1}"), Error::INVALID_DATA);
+
+    // 入れ子の上限（MaxDepth = 4）
+    CHECK_EQ(error_of("[[[[1]]]]"), Error::OK);
+    CHECK_EQ(error_of("[[[[[1]]]]]"), Error::BUFFER_FULL);
+}
+
+TEST_CASE("json_find_special - SIMD / SWAR と逐次判定の一致") {
+    static char text[200];
+    for (uint32_t trial = 0; trial < 256; ++trial) {
+        for (uint32_t i = 0; i < sizeof(text); ++i) {
+            text[i] = static_cast<char>('a' + (i % 26));
+        }
+        const uint32_t position = (trial * 37) % sizeof(text);
+        const char specials[] = {'"', '\\', '\x01', '\x1f', '\n'};
+        text[position] = specials[trial % sizeof(specials)];
+        // 0x80 以上（UTF-8）は該当しない
+        text[(position + 150) % sizeof(text)] = static_cast<char>(0xE3);
+
+        for (uint32_t start = 0; start < 20; start += 7) {
+            const char* found = detail::json_find_special(text + start, text + sizeof(text));
+            const char* expected = text + start;
+            while (expected < text + sizeof(text) && !detail::json_is_special(*expected)) {
+                ++expected;
+            }
+            CHECK_EQ(found, expected);
+        }
+    }
+}
@@ -0,0 +1,181 @@
+// LineReader<BufferSize, MaxLineLength> の単体テスト
+
+#define DOCTEST_CONFIG_NO_EXCEPTIONS
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <omusubi/core/line_reader.hpp>
+
+#include "doctest.h"
+
+using namespace omusubi;
+using namespace std::literals;
+
+namespace {
+
+// 文字列を chunk バイトずつ返すソース（zero_copy の場合は peek / consume に対応）
+class ChunkedSource : public ByteReadable {
+public:
+    ChunkedSource(std::string_view data, size_t chunk, bool zero_copy) noexcept : data_(data), chunk_(chunk), zero_copy_(zero_copy) {}
+
+    size_t read(span<uint8_t> buffer) override {
+        ++read_calls;
+        size_t n = 0;
+        while (n < buffer.size() && n < chunk_ && position_ < data_.size()) {
+            buffer[n++] = static_cast<uint8_t>(data_[position_++]);
+        }
+        return n;
+    }
+
+    [[nodiscard]] size_t available() const override { return data_.size() - position_; }
+
+    [[nodiscard]] span<const uint8_t> peek() override {
+        if (!zero_copy_) {
+            return span<const uint8_t>();
+        }
+        const size_t rest = data_.size() - position_;
+        return span<const uint8_t>(reinterpret_cast<const uint8_t*>(data_.data() + position_), (rest < chunk_) ? rest : chunk_);
+    }
+
+    size_t consume(size_t count) override {
+        if (!zero_copy_) {
+            return ByteReadable::consume(count);
+        }
+        position_ += count;
+        return count;
+    }
+
+    [[nodiscard]] const char* position() const noexcept { return data_.data() + position_; }
+
+    uint32_t read_calls = 0;
+
+private:
+    std::string_view data_;
+    size_t position_ = 0;
+    size_t chunk_;
+    bool zero_copy_;
+};
+
+// 次の行を取得（完全な行がない場合は "<none>"）
+template <typename Reader>
+std::string_view next_line(Reader& reader) {
+    auto result = reader.read_line();
+    return result.is_ok() ? result.value() : "<none>"sv;
+}
+
+} // namespace
+
+TEST_CASE("LineReader - LF / CRLF 区切り") {
+    for (bool zero_copy : {false, true}) {
+        for (size_t chunk : {1U, 3U, 64U}) {
+            ChunkedSource source("$GPGGA,1\r\n$GPRMC,2\n\r\nlast"sv, chunk, zero_copy);
+            LineReader<32> reader(source);
+
+            std::string_view expected[] = {"$GPGGA,1"sv, "$GPRMC,2"sv, ""sv};
+            for (std::string_view line : expected) {
+                auto result = reader.read_line();
+                REQUIRE(result.is_ok());
+                CHECK_EQ(result.value(), line);
+            }
+
+            // 改行のない末尾は完全な行ではない
+            auto rest = reader.read_line();
+            REQUIRE(rest.is_err());
+            CHECK_EQ(rest.error(), Error::BUFFER_EMPTY);
+        }
+    }
+}
+
+TEST_CASE("LineReader - peek() 領域の行はコピーせずに返す") {
+    const std::string_view data = "hello\nworld\n"sv;
+    ChunkedSource source(data, 64, true);
+    LineReader<16> reader(source);
+
+    auto first = reader.read_line();
+    REQUIRE(first.is_ok());
+    CHECK_EQ(first.value(), "hello"sv);
+    CHECK_EQ(first.value().data(), data.data()); // ソースのバッファを直接参照
+    CHECK_EQ(source.read_calls, 0U);
+
+    auto second = reader.read_line();
+    REQUIRE(second.is_ok());
+    CHECK_EQ(second.value().data(), data.data() + 6);
+
+    CHECK(reader.read_line().is_err());
+    CHECK_EQ(source.position(), data.data() + data.size());
+}
+
+TEST_CASE("LineReader - 最大行長の超過") {
+    const std::string_view data = "ok\n0123456789ABCDEF\nnext\n"sv;
+
+    SUBCASE("DISCARD") {
+        ChunkedSource source(data, 4, false);
+        LineReader<12, 8> reader(source, LineOverflowPolicy::DISCARD);
+        CHECK_EQ(next_line(reader), "ok"sv);
+        CHECK_EQ(next_line(reader), "next"sv);
+        CHECK_EQ(reader.overflow_count(), 1U);
+    }
+
+    SUBCASE("TRUNCATE") {
+        ChunkedSource source(data, 4, false);
+        LineReader<12, 8> reader(source, LineOverflowPolicy::TRUNCATE);
+        CHECK_EQ(next_line(reader), "ok"sv);
+        CHECK_EQ(next_line(reader), "01234567"sv);
+        CHECK_EQ(next_line(reader), "next"sv);
+        CHECK_EQ(reader.overflow_count(), 1U);
+    }
+
+    SUBCASE("SPLIT") {
+        ChunkedSource source(data, 4, false);
+        LineReader<12, 8> reader(source, LineOverflowPolicy::SPLIT);
+        CHECK_EQ(next_line(reader), "ok"sv);
+        CHECK_EQ(next_line(reader), "01234567"sv);
+        CHECK_EQ(next_line(reader), "89ABCDEF"sv);
+        CHECK_EQ(next_line(reader), "next"sv);
+    }
+
+    SUBCASE("一度に届いた長い行（peek領域）") {
+        ChunkedSource source(data, 64, true);
+        LineReader<12, 8> reader(source, LineOverflowPolicy::TRUNCATE);
+        CHECK_EQ(next_line(reader), "ok"sv);
+        CHECK_EQ(next_line(reader), "01234567"sv);
+        CHECK_EQ(next_line(reader), "next"sv);
+    }
+
+    SUBCASE("CRを除いて最大行長ちょうどの行は超過しない") {
+        ChunkedSource source("01234567\r\n"sv, 1, false);
+        LineReader<10, 8> reader(source);
+        CHECK_EQ(next_line(reader), "01234567"sv);
+        CHECK_EQ(reader.overflow_count(), 0U);
+    }
+}
+
+TEST_CASE("LineReader - TextReadable として使用") {
+    ChunkedSource source("AT+OK\r\n"sv, 2, false);
+    LineReader<16> reader(source);
+    TextReadable& text = reader;
+
+    char buffer[4];
+    CHECK_EQ(text.read_line(span<char>(buffer)), 4U); // 切り詰め
+    CHECK_EQ(std::string_view(buffer, 4), "AT+O"sv);
+    CHECK_EQ(text.read_line(span<char>(buffer)), 0U);
+}
+
+TEST_CASE("LineReader - 多数の行（バッファの詰め直し）") {
+    char data[1000];
+    size_t length = 0;
+    for (uint32_t i = 0; i < 100; ++i) {
+        const uint32_t digits = i % 7;
+        for (uint32_t d = 0; d < digits; ++d) {
+            data[length++] = static_cast<char>('a' + d);
+        }
+        data[length++] = '\n';
+    }
+
+    ChunkedSource source(std::string_view(data, length), 5, false);
+    LineReader<16, 8> reader(source);
+    for (uint32_t i = 0; i < 100; ++i) {
+        auto line = reader.read_line();
+        REQUIRE(line.is_ok());
+        CHECK_EQ(line.value().size(), i % 7);
+    }
+    CHECK(reader.read_line().is_err());
+}
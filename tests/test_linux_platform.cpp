@@ -0,0 +1,306 @@
+// Linux プラットフォーム実装の単体テスト（openpty による疑似端末で送受信する）
+
+#define DOCTEST_CONFIG_NO_EXCEPTIONS
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <omusubi/platform/linux/linux_system_context.hpp>
+
+#include "doctest.h"
+
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <fcntl.h>
+#include <poll.h>
+#include <pty.h>
+#include <thread>
+#include <unistd.h>
+
+using namespace omusubi;
+using namespace omusubi::platform::linux_host;
+
+namespace {
+
+// 疑似端末のマスター側（テストからの送受信に使う）
+class PseudoTerminal {
+public:
+    PseudoTerminal() {
+        int slave = -1;
+        if (openpty(&master_, &slave, name_, nullptr, nullptr) == 0) {
+            // スレーブ側は LinuxSerialContext が開く
+            ::close(slave);
+        }
+    }
+
+    ~PseudoTerminal() {
+        if (master_ >= 0) {
+            ::close(master_);
+        }
+    }
+
+    PseudoTerminal(const PseudoTerminal&) = delete;
+    PseudoTerminal& operator=(const PseudoTerminal&) = delete;
+
+    [[nodiscard]] bool is_open() const { return master_ >= 0; }
+
+    [[nodiscard]] std::string_view slave_name() const { return name_; }
+
+    void send(std::string_view text) const {
+        size_t sent = 0;
+        while (sent < text.size()) {
+            const ssize_t n = ::write(master_, text.data() + sent, text.size() - sent);
+            if (n <= 0) {
+                break;
+            }
+            sent += static_cast<size_t>(n);
+        }
+    }
+
+    // size バイト届くか timeout_ms を過ぎるまで読む
+    size_t receive(uint8_t* buffer, size_t size, int timeout_ms) const {
+        size_t received = 0;
+        pollfd pfd {master_, POLLIN, 0};
+        while (received < size && poll(&pfd, 1, timeout_ms) > 0) {
+            const ssize_t n = ::read(master_, buffer + received, size - received);
+            if (n <= 0) {
+                break;
+            }
+            received += static_cast<size_t>(n);
+        }
+        return received;
+    }
+
+private:
+    int master_ = -1;
+    char name_[128] = {};
+};
+
+} // namespace
+
+TEST_CASE("linux - SystemContext") {
+    SystemContext& ctx = get_system_context();
+    ctx.begin();
+
+    CHECK_NE(dynamic_cast<LinuxSystemContext*>(&ctx), nullptr);
+    CHECK_EQ(ctx.get_connectable_context().get_serial_count(), 3U);
+    CHECK_NE(ctx.get_connectable_context().get_serial_context(2), nullptr);
+    CHECK_EQ(ctx.get_connectable_context().get_serial_context(3), nullptr);
+    CHECK_EQ(ctx.get_connectable_context().get_bluetooth_context(), nullptr);
+    CHECK_EQ(ctx.get_scannable_context().get_wifi_context(), nullptr);
+
+    SystemInfoContext& info = ctx.get_system_info_context();
+    CHECK_FALSE(info.get_firmware_version().empty());
+    CHECK_GT(info.get_free_memory(), 0U);
+    CHECK_LE(ctx.get_power_context().get_battery_level(), 100U);
+
+    SUBCASE("delay と稼働時間は CLOCK_MONOTONIC") {
+        const uint32_t start = info.get_uptime_ms();
+        const auto wall_start = std::chrono::steady_clock::now();
+        ctx.delay(30);
+        const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - wall_start).count();
+        CHECK_GE(elapsed, 30);
+        CHECK_GE(info.get_uptime_ms() - start, 30U);
+        CHECK_LT(info.get_uptime_ms() - start, 1000U);
+    }
+
+    SUBCASE("reset で稼働時間の起点を戻す") {
+        ctx.delay(5);
+        ctx.reset();
+        CHECK_LT(info.get_uptime_ms(), 5U);
+    }
+}
+
+TEST_CASE("linux - LinuxSerialContext の接続") {
+    PseudoTerminal pty;
+    REQUIRE(pty.is_open());
+
+    LinuxSerialContext serial(1);
+    CHECK_EQ(serial.get_device(), "/dev/ttyUSB1");
+    const LinuxSerialContext port12(12);
+    CHECK_EQ(port12.get_device(), "/dev/ttyUSB12");
+    const LinuxSerialContext port255(255);
+    CHECK_EQ(port255.get_device(), "/dev/ttyUSB255");
+    CHECK_EQ(serial.read(span<uint8_t>()), 0U);
+
+    serial.set_device("/nonexistent/tty");
+    CHECK_FALSE(serial.connect());
+
+    CHECK(serial.set_device(pty.slave_name()));
+    serial.set_baud_rate(12345);
+    CHECK_FALSE(serial.connect());
+
+    serial.set_baud_rate(921600);
+    REQUIRE(serial.connect());
+    CHECK(serial.is_connected());
+    CHECK(serial.connect());
+
+    CHECK(serial.disconnect());
+    CHECK_FALSE(serial.is_connected());
+    CHECK_FALSE(serial.disconnect());
+}
+
+TEST_CASE("linux - LinuxSerialContext の受信") {
+    PseudoTerminal pty;
+    REQUIRE(pty.is_open());
+    LinuxSerialContext serial(0);
+    serial.set_device(pty.slave_name());
+    REQUIRE(serial.connect());
+
+    SUBCASE("read と available") {
+        CHECK_FALSE(serial.wait_readable(10));
+        pty.send("abc");
+        REQUIRE(serial.wait_readable(1000));
+        CHECK_EQ(serial.available(), 3U);
+
+        uint8_t buffer[8] = {};
+        CHECK_EQ(serial.read(span<uint8_t>(buffer, 8)), 3U);
+        CHECK_EQ(std::memcmp(buffer, "abc", 3), 0);
+        CHECK_EQ(serial.available(), 0U);
+    }
+
+    SUBCASE("read_line は改行が届くまで読まない") {
+        char line[16] = {};
+        pty.send("hello\r\nwor");
+        REQUIRE(serial.wait_readable(1000));
+        CHECK_EQ(serial.read_line(span<char>(line, sizeof(line))), 5U);
+        CHECK_EQ(std::string_view(line, 5), "hello");
+
+        serial.wait_readable(100);
+        CHECK_EQ(serial.read_line(span<char>(line, sizeof(line))), 0U);
+        pty.send("ld\n");
+        for (int i = 0; i < 100 && serial.available() < 6; ++i) {
+            serial.wait_readable(10);
+        }
+        CHECK_EQ(serial.read_line(span<char>(line, sizeof(line))), 5U);
+        CHECK_EQ(std::string_view(line, 5), "world");
+    }
+
+    SUBCASE("read_line は改行のないまま受信バッファが一杯になったら区切る") {
+        static char text[LinuxSerialContext::RX_BUFFER_SIZE + 8];
+        std::memset(text, 'x', sizeof(text));
+        text[sizeof(text) - 1] = '\n';
+        pty.send(std::string_view(text, sizeof(text)));
+        for (int i = 0; i < 100 && serial.available() < sizeof(text); ++i) {
+            serial.wait_readable(10);
+        }
+
+        static char line[LinuxSerialContext::RX_BUFFER_SIZE * 2];
+        CHECK_EQ(serial.read_line(span<char>(line, sizeof(line))), LinuxSerialContext::RX_BUFFER_SIZE);
+        for (int i = 0; i < 100 && serial.available() < 8; ++i) {
+            serial.wait_readable(10);
+        }
+        CHECK_EQ(serial.read_line(span<char>(line, sizeof(line))), 7U);
+    }
+
+    SUBCASE("async_read は SystemContext::update() と同じ経路で完了する") {
+        uint8_t buffer[8] = {};
+        size_t received = 0;
+        REQUIRE(serial.async_read(span<uint8_t>(buffer), [&](Result<size_t> result) { received = result.value(); }));
+        CHECK_EQ(serial.poll_async(), 0U);
+
+        pty.send("xyz");
+        for (int i = 0; i < 100 && received == 0; ++i) {
+            serial.wait_readable(10);
+            serial.poll_async();
+        }
+        CHECK_EQ(received, 3U);
+        CHECK_EQ(std::memcmp(buffer, "xyz", 3), 0);
+    }
+
+    SUBCASE("peek はリングバッファを直接参照する") {
+        pty.send("frame");
+        REQUIRE(serial.wait_readable(1000));
+        for (int i = 0; i < 100 && serial.available() < 5; ++i) {
+            serial.wait_readable(10);
+        }
+
+        const span<const uint8_t> region = serial.peek();
+        REQUIRE_EQ(region.size(), 5U);
+        CHECK_EQ(region[0], 'f');
+        CHECK_EQ(serial.consume(2), 2U);
+        CHECK_EQ(serial.peek()[0], 'a');
+        CHECK_EQ(serial.consume(100), 3U);
+    }
+}
+
+TEST_CASE("linux - LinuxSerialContext の送信") {
+    PseudoTerminal pty;
+    REQUIRE(pty.is_open());
+    LinuxSerialContext serial(0);
+    serial.set_device(pty.slave_name());
+    REQUIRE(serial.connect());
+
+    SUBCASE("writev はまとめて送る") {
+        const uint8_t header[] = {0xAA, 0x55};
+        const uint8_t payload[] = {1, 2, 3, 4};
+        const span<const uint8_t> parts[] = {span<const uint8_t>(header), span<const uint8_t>(), span<const uint8_t>(payload)};
+        CHECK_EQ(serial.writev(span<const span<const uint8_t>>(parts)), 6U);
+        CHECK_EQ(serial.write_text(span<const char>("!", 1)), 1U);
+
+        uint8_t received[7] = {};
+        CHECK_EQ(pty.receive(received, 7, 1000), 7U);
+        CHECK_EQ(received[0], 0xAA);
+        CHECK_EQ(received[5], 4);
+        CHECK_EQ(received[6], '!');
+    }
+
+    SUBCASE("カーネルのバッファが一杯なら空くまで待つ") {
+        constexpr size_t SIZE = 256 * 1024;
+        static uint8_t data[SIZE];
+        static uint8_t received[SIZE];
+        for (size_t i = 0; i < SIZE; ++i) {
+            data[i] = static_cast<uint8_t>(i * 7);
+        }
+
+        size_t count = 0;
+        std::thread reader([&] { count = pty.receive(received, SIZE, 2000); });
+        CHECK_EQ(serial.write(span<const uint8_t>(data, SIZE)), SIZE);
+        reader.join();
+        CHECK_EQ(count, SIZE);
+        CHECK_EQ(std::memcmp(data, received, SIZE), 0);
+    }
+
+    SUBCASE("async_write はカーネルのバッファを待たずに進む") {
+        constexpr size_t SIZE = 256 * 1024;
+        static uint8_t data[SIZE];
+        static uint8_t received[SIZE];
+        for (size_t i = 0; i < SIZE; ++i) {
+            data[i] = static_cast<uint8_t>(i * 13);
+        }
+
+        size_t completed = 0;
+        REQUIRE(serial.async_write(span<const uint8_t>(data, SIZE), [&](Result<size_t> result) { completed = result.is_ok() ? result.value() : 0; }));
+
+        // 相手が読むまではバッファが一杯になっても poll_async() はすぐに戻る
+        const auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < 10; ++i) {
+            serial.poll_async();
+        }
+        const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+        CHECK_LT(elapsed, 50);
+        CHECK(serial.is_write_pending());
+
+        size_t count = 0;
+        std::thread reader([&] { count = pty.receive(received, SIZE, 2000); });
+        for (int i = 0; i < 20000 && serial.is_write_pending(); ++i) {
+            serial.poll_async();
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+        reader.join();
+        CHECK_EQ(completed, SIZE);
+        CHECK_EQ(count, SIZE);
+        CHECK_EQ(std::memcmp(data, received, SIZE), 0);
+    }
+
+    SUBCASE("相手が読まなければタイムアウトで書けた分だけ返す") {
+        constexpr size_t SIZE = 1024 * 1024;
+        static uint8_t data[SIZE];
+        serial.set_write_timeout(50);
+
+        const auto start = std::chrono::steady_clock::now();
+        const size_t written = serial.write(span<const uint8_t>(data, SIZE));
+        const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+        CHECK_GT(written, 0U);
+        CHECK_LT(written, SIZE);
+        CHECK_GE(elapsed, 45);
+    }
+}
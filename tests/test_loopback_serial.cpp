@@ -0,0 +1,344 @@
+// LoopbackSerialContext の単体テスト
+
+#define DOCTEST_CONFIG_NO_EXCEPTIONS
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <omusubi/core/framing.hpp>
+#include <omusubi/platform/loopback/loopback_serial_context.hpp>
+
+#include "doctest.h"
+
+#include <cstring>
+
+using namespace omusubi;
+using namespace omusubi::platform::loopback;
+
+namespace {
+
+using Port = LoopbackSerialContext<1024, 8>;
+
+// 115200 baud の1バイト時間（10ビット）
+constexpr uint64_t BYTE_NS_115200 = 86806;
+
+uint32_t count_bit_differences(const uint8_t* a, const uint8_t* b, uint32_t size) {
+    uint32_t differences = 0;
+    for (uint32_t i = 0; i < size; ++i) {
+        for (uint8_t x = a[i] ^ b[i]; x != 0; x &= static_cast<uint8_t>(x - 1)) {
+            ++differences;
+        }
+    }
+    return differences;
+}
+
+} // namespace
+
+TEST_CASE("LoopbackSerialContext - VirtualClock") {
+    VirtualClock clock;
+    CHECK_EQ(clock.now_ns(), 0U);
+
+    clock.advance_ms(2);
+    clock.advance_us(3);
+    clock.advance_ns(4);
+    CHECK_EQ(clock.now_ns(), 2003004U);
+    CHECK_EQ(clock.now_us(), 2003U);
+    CHECK_EQ(clock.now_ms(), 2U);
+
+    clock.advance_to(1000);
+    CHECK_EQ(clock.now_ns(), 2003004U);
+    clock.advance_to(5000000);
+    CHECK_EQ(clock.now_ms(), 5U);
+}
+
+TEST_CASE("LoopbackSerialContext - ボーレートによる直列化") {
+    VirtualClock clock;
+    Port a(clock);
+    Port b(clock);
+    a.link(b);
+    REQUIRE(a.connect());
+    REQUIRE(b.connect());
+    CHECK_EQ(a.get_byte_time_ns(), BYTE_NS_115200);
+
+    const uint8_t data[] = {'h', 'e', 'l', 'l', 'o'};
+    CHECK_EQ(a.write(span<const uint8_t>(data)), 5U);
+    CHECK_EQ(b.available(), 0U);
+    CHECK_EQ(b.next_arrival_ns(), BYTE_NS_115200);
+    CHECK_EQ(a.tx_idle_ns(), 5 * BYTE_NS_115200);
+
+    SUBCASE("1バイト時間ごとに届く") {
+        clock.advance_ns(BYTE_NS_115200 - 1);
+        CHECK_EQ(b.available(), 0U);
+        clock.advance_ns(1);
+        CHECK_EQ(b.available(), 1U);
+        CHECK_EQ(b.next_arrival_ns(), 2 * BYTE_NS_115200);
+
+        clock.advance_to(3 * BYTE_NS_115200);
+        uint8_t rx[8] = {};
+        CHECK_EQ(b.read(span<uint8_t>(rx)), 3U);
+        CHECK_EQ(std::memcmp(rx, "hel", 3), 0);
+
+        clock.advance_to(b.next_arrival_ns());
+        clock.advance_to(b.next_arrival_ns());
+        CHECK_EQ(b.next_arrival_ns(), Port::NO_ARRIVAL);
+        CHECK_EQ(b.read(span<uint8_t>(rx)), 2U);
+        CHECK_EQ(std::memcmp(rx, "lo", 2), 0);
+    }
+
+    SUBCASE("続けて送ると前の送信の後に並ぶ") {
+        clock.advance_ns(BYTE_NS_115200);
+        CHECK_EQ(a.write(span<const uint8_t>(data, 2)), 2U);
+        CHECK_EQ(a.tx_idle_ns(), 7 * BYTE_NS_115200);
+
+        clock.advance_to(7 * BYTE_NS_115200 - 1);
+        CHECK_EQ(b.available(), 6U);
+        clock.advance_ns(1);
+        CHECK_EQ(b.available(), 7U);
+    }
+
+    SUBCASE("逆方向は独立") {
+        CHECK_EQ(a.available(), 0U);
+        CHECK_EQ(b.write(span<const uint8_t>(data, 1)), 1U);
+        clock.advance_to(BYTE_NS_115200);
+        CHECK_EQ(a.available(), 1U);
+        CHECK_EQ(b.available(), 1U);
+    }
+}
+
+TEST_CASE("LoopbackSerialContext - 遅延と揺らぎ") {
+    VirtualClock clock;
+    Port a(clock);
+    Port b(clock);
+    a.link(b);
+    REQUIRE(a.connect());
+    REQUIRE(b.connect());
+
+    SUBCASE("固定遅延") {
+        a.set_link_config({921600, 2000, 0, 0.0, 1});
+        const uint64_t byte_ns = a.get_byte_time_ns();
+        CHECK_EQ(byte_ns, 10851U);
+
+        const uint8_t data[] = {1, 2};
+        a.write(span<const uint8_t>(data));
+        CHECK_EQ(b.next_arrival_ns(), byte_ns + 2000000);
+        clock.advance_to(2 * byte_ns + 2000000);
+        CHECK_EQ(b.available(), 2U);
+    }
+
+    SUBCASE("揺らぎは範囲内で順序を保つ") {
+        a.set_link_config({0, 100, 500, 0.0, 7});
+
+        uint64_t previous = 0;
+        for (uint8_t i = 0; i < 100; ++i) {
+            a.write(span<const uint8_t>(&i, 1));
+            const uint64_t arrival = b.next_arrival_ns();
+            CHECK_GE(arrival, clock.now_ns() + 100000);
+            CHECK_LE(arrival, clock.now_ns() + 600000);
+            CHECK_GE(arrival, previous);
+            previous = arrival;
+
+            clock.advance_to(arrival);
+            uint8_t rx = 0xFF;
+            CHECK_EQ(b.read(span<uint8_t>(&rx, 1)), 1U);
+            CHECK_EQ(rx, i);
+        }
+    }
+
+    SUBCASE("同じ種なら同じ結果") {
+        uint64_t arrivals[2][16] = {};
+        for (auto& run : arrivals) {
+            VirtualClock local;
+            Port x(local);
+            Port y(local);
+            x.link(y);
+            REQUIRE(x.connect());
+            REQUIRE(y.connect());
+            x.set_link_config({115200, 0, 1000, 0.0, 42});
+            for (uint64_t& arrival : run) {
+                const uint8_t byte = 0x55;
+                x.write(span<const uint8_t>(&byte, 1));
+                arrival = y.next_arrival_ns();
+                local.advance_ms(2);
+            }
+        }
+        CHECK_EQ(std::memcmp(arrivals[0], arrivals[1], sizeof(arrivals[0])), 0);
+    }
+}
+
+TEST_CASE("LoopbackSerialContext - ビット誤り") {
+    VirtualClock clock;
+    LoopbackSerialContext<1 << 16> a(clock);
+    LoopbackSerialContext<1 << 16> b(clock);
+    a.link(b);
+    REQUIRE(a.connect());
+    REQUIRE(b.connect());
+
+    static uint8_t sent[60000];
+    static uint8_t received[60000];
+    for (uint32_t i = 0; i < sizeof(sent); ++i) {
+        sent[i] = static_cast<uint8_t>(i * 31);
+    }
+
+    SUBCASE("誤り率0ならそのまま届く") {
+        a.set_link_config({0, 0, 0, 0.0, 1});
+        CHECK_EQ(a.write(span<const uint8_t>(sent)), sizeof(sent));
+        CHECK_EQ(b.read(span<uint8_t>(received)), sizeof(sent));
+        CHECK_EQ(std::memcmp(sent, received, sizeof(sent)), 0);
+        CHECK_EQ(a.get_tx_stats().bit_errors, 0U);
+    }
+
+    SUBCASE("反転したビット数は統計と一致し、期待値に近い") {
+        a.set_link_config({0, 0, 0, 1e-3, 3});
+        // 分割して送っても誤りの位置は続きから数える
+        CHECK_EQ(a.write(span<const uint8_t>(sent, 1000)), 1000U);
+        CHECK_EQ(a.write(span<const uint8_t>(sent + 1000, sizeof(sent) - 1000)), sizeof(sent) - 1000);
+        CHECK_EQ(b.read(span<uint8_t>(received)), sizeof(sent));
+
+        const uint32_t flipped = count_bit_differences(sent, received, sizeof(sent));
+        CHECK_EQ(flipped, a.get_tx_stats().bit_errors);
+        // 期待値 480、標準偏差 約22
+        CHECK_GT(flipped, 380U);
+        CHECK_LT(flipped, 580U);
+    }
+
+    SUBCASE("誤り率1なら全ビット反転") {
+        a.set_link_config({0, 0, 0, 1.0, 1});
+        CHECK_EQ(a.write(span<const uint8_t>(sent, 16)), 16U);
+        CHECK_EQ(b.read(span<uint8_t>(received, 16)), 16U);
+        CHECK_EQ(received[1], static_cast<uint8_t>(~sent[1]));
+        CHECK_EQ(a.get_tx_stats().bit_errors, 128U);
+    }
+}
+
+TEST_CASE("LoopbackSerialContext - 受信バッファと接続") {
+    VirtualClock clock;
+    Port a(clock);
+    Port b(clock);
+    a.link(b);
+    static uint8_t data[2048];
+
+    SUBCASE("切断中は送れない・相手が切断中なら失われる") {
+        CHECK_EQ(a.write(span<const uint8_t>(data, 4)), 0U);
+        REQUIRE(a.connect());
+        CHECK_EQ(a.write(span<const uint8_t>(data, 4)), 4U);
+        CHECK_EQ(a.get_tx_stats().bytes_lost, 4U);
+
+        REQUIRE(b.connect());
+        clock.advance_ms(1);
+        CHECK_EQ(b.available(), 0U);
+        CHECK(b.disconnect());
+        CHECK_FALSE(b.disconnect());
+    }
+
+    SUBCASE("空きが足りなければ入る分だけ受け付ける") {
+        REQUIRE(a.connect());
+        REQUIRE(b.connect());
+        a.set_link_config({0, 0, 0, 0.0, 1});
+        CHECK_EQ(a.write(span<const uint8_t>(data)), 1024U);
+        CHECK_EQ(a.get_tx_stats().bytes_rejected, 1024U);
+        CHECK_EQ(a.write(span<const uint8_t>(data, 1)), 0U);
+
+        CHECK_EQ(b.consume(24), 24U);
+        CHECK_EQ(a.write(span<const uint8_t>(data)), 24U);
+    }
+
+    SUBCASE("到着待ちの区間表が一杯なら受け付けない") {
+        REQUIRE(a.connect());
+        REQUIRE(b.connect());
+        // 送信路が空いてから送ると別のバーストになる
+        a.set_link_config({115200, 5000, 0, 0.0, 1});
+        for (int i = 0; i < 8; ++i) {
+            CHECK_EQ(a.write(span<const uint8_t>(data, 1)), 1U);
+            clock.advance_ns(2 * BYTE_NS_115200);
+        }
+        CHECK_EQ(a.write(span<const uint8_t>(data, 1)), 0U);
+        CHECK_EQ(b.available(), 0U);
+
+        clock.advance_to(b.next_arrival_ns());
+        CHECK_EQ(b.read(span<uint8_t>(data, 1)), 1U);
+        CHECK_EQ(a.write(span<const uint8_t>(data, 1)), 1U);
+    }
+
+    SUBCASE("使用中の送信路に続けて送ると同じバーストになる") {
+        REQUIRE(a.connect());
+        REQUIRE(b.connect());
+        a.set_link_config({115200, 1000, 1000, 0.0, 5});
+        for (int i = 0; i < 32; ++i) {
+            CHECK_EQ(a.write(span<const uint8_t>(data, 4)), 4U);
+        }
+        clock.advance_ms(20);
+        CHECK_EQ(b.available(), 128U);
+    }
+}
+
+TEST_CASE("LoopbackSerialContext - ループバックプラグ") {
+    VirtualClock clock;
+    Port port(clock);
+    REQUIRE(port.connect());
+    port.set_link_config({0, 0, 0, 0.0, 1});
+
+    SUBCASE("read_line") {
+        char line[16] = {};
+        port.write_text(span<const char>("hello\r\nwor", 10));
+        CHECK_EQ(port.read_line(span<char>(line, sizeof(line))), 5U);
+        CHECK_EQ(std::string_view(line, 5), "hello");
+        CHECK_EQ(port.read_line(span<char>(line, sizeof(line))), 0U);
+
+        port.write_text(span<const char>("ld\n", 3));
+        CHECK_EQ(port.read_line(span<char>(line, sizeof(line))), 5U);
+        CHECK_EQ(std::string_view(line, 5), "world");
+    }
+
+    SUBCASE("read_line は改行のないまま受信バッファが一杯になったら区切る") {
+        LoopbackSerialContext<64> small(clock);
+        REQUIRE(small.connect());
+        small.set_link_config({0, 0, 0, 0.0, 1});
+
+        char text[64];
+        std::memset(text, 'x', sizeof(text));
+        CHECK_EQ(small.write_text(span<const char>(text, sizeof(text))), 64U);
+        CHECK_EQ(small.write_text(span<const char>("y\n", 2)), 0U);
+
+        char line[128] = {};
+        CHECK_EQ(small.read_line(span<char>(line, sizeof(line))), 64U);
+        CHECK_EQ(small.write_text(span<const char>("y\n", 2)), 2U);
+        CHECK_EQ(small.read_line(span<char>(line, sizeof(line))), 1U);
+        CHECK_EQ(line[0], 'y');
+    }
+
+    SUBCASE("writev は1回の送信") {
+        port.set_link_config({115200, 0, 0, 0.0, 1});
+        const uint8_t header[] = {0xAA};
+        const uint8_t payload[] = {1, 2, 3};
+        const span<const uint8_t> parts[] = {span<const uint8_t>(header), span<const uint8_t>(payload)};
+        CHECK_EQ(port.writev(span<const span<const uint8_t>>(parts)), 4U);
+        CHECK_EQ(port.tx_idle_ns(), 4 * BYTE_NS_115200);
+
+        clock.advance_to(port.tx_idle_ns());
+        const span<const uint8_t> region = port.peek();
+        REQUIRE_EQ(region.size(), 4U);
+        CHECK_EQ(region[0], 0xAA);
+        CHECK_EQ(region[3], 3);
+        CHECK_EQ(port.consume(10), 4U);
+    }
+
+    SUBCASE("COBS フレームが届く") {
+        port.set_link_config({921600, 100, 0, 0.0, 1});
+        CobsEncoder encoder(port);
+        CobsDecoder<64> decoder;
+        uint8_t payload[40];
+        for (uint8_t i = 0; i < sizeof(payload); ++i) {
+            payload[i] = i;
+        }
+
+        uint32_t frames = 0;
+        for (int i = 0; i < 10; ++i) {
+            CHECK(encoder.write_frame(span<const uint8_t>(payload)));
+        }
+        while (port.next_arrival_ns() != Port::NO_ARRIVAL) {
+            clock.advance_to(port.next_arrival_ns());
+            const span<const uint8_t> region = port.peek();
+            frames += decoder.feed(region, [&](span<const uint8_t> frame) { CHECK_EQ(std::memcmp(frame.data(), payload, sizeof(payload)), 0); });
+            port.consume(region.size());
+        }
+        CHECK_EQ(frames, 10U);
+        CHECK_EQ(decoder.get_stats().crc_errors, 0U);
+    }
+}
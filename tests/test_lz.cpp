@@ -0,0 +1,229 @@
+// LzCompressor / LzDecompressor / LzWriter の単体テスト
+
+#define DOCTEST_CONFIG_NO_EXCEPTIONS
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <omusubi/core/lz.hpp>
+
+#include "doctest.h"
+
+#include <cstdio>
+#include <cstring>
+
+using namespace omusubi;
+
+namespace {
+
+constexpr uint32_t INPUT_SIZE = 40000;
+constexpr uint32_t OUTPUT_CAPACITY = INPUT_SIZE + INPUT_SIZE / 32 + 64;
+
+uint8_t input[INPUT_SIZE];
+uint8_t compressed[OUTPUT_CAPACITY];
+uint8_t restored[INPUT_SIZE];
+
+// ログ風のテキスト（繰り返しが多い）
+void make_log(uint8_t* out, uint32_t size) {
+    static const char* const levels[] = {"INFO", "WARN", "DEBUG"};
+    uint32_t length = 0;
+    for (uint32_t line = 0; length < size; ++line) {
+        char text[96];
+        const int n = std::snprintf(text, sizeof(text), "[%08u] %s sensor: temp=%u.%u humidity=%u%%\n", line * 250, levels[line % 3], 20 + line % 7, line % 10, 40 + line % 13);
+        for (int i = 0; i < n && length < size; ++i) {
+            out[length++] = static_cast<uint8_t>(text[i]);
+        }
+    }
+}
+
+// 圧縮しにくい疑似乱数列
+void make_noise(uint8_t* out, uint32_t size) {
+    uint32_t state = 1;
+    for (uint32_t i = 0; i < size; ++i) {
+        state = state * 1103515245U + 12345U;
+        out[i] = static_cast<uint8_t>(state >> 16);
+    }
+}
+
+// in_chunk / out_chunk バイトずつ圧縮する
+template <typename Compressor>
+uint32_t compress_all(Compressor& lz, span<const uint8_t> data, uint32_t in_chunk, uint32_t out_chunk) {
+    uint32_t read = 0;
+    uint32_t written = 0;
+    while (read < data.size()) {
+        const uint32_t n = (data.size() - read < in_chunk) ? static_cast<uint32_t>(data.size() - read) : in_chunk;
+        const uint32_t room = (OUTPUT_CAPACITY - written < out_chunk) ? OUTPUT_CAPACITY - written : out_chunk;
+        const auto step = lz.compress(data.subspan(read, n), span<uint8_t>(compressed + written, room), false);
+        read += step.consumed;
+        written += step.produced;
+    }
+    do {
+        const uint32_t room = (OUTPUT_CAPACITY - written < out_chunk) ? OUTPUT_CAPACITY - written : out_chunk;
+        const auto step = lz.compress(span<const uint8_t>(), span<uint8_t>(compressed + written, room), true);
+        written += step.produced;
+    } while (lz.has_pending());
+    return written;
+}
+
+template <typename Decompressor>
+bool decompress_all(Decompressor& lz, uint32_t size, uint32_t expected, uint32_t chunk) {
+    uint32_t read = 0;
+    uint32_t written = 0;
+    while (read < size || written < expected) {
+        const uint32_t n = (size - read < chunk) ? size - read : chunk;
+        const uint32_t room = (expected - written < chunk) ? expected - written : chunk;
+        auto step = lz.decompress(span<const uint8_t>(compressed + read, n), span<uint8_t>(restored + written, room));
+        if (step.is_err() || (step.value().consumed == 0 && step.value().produced == 0)) {
+            return false;
+        }
+        read += step.value().consumed;
+        written += step.value().produced;
+    }
+    return written == expected && lz.is_complete() && std::memcmp(input, restored, expected) == 0;
+}
+
+template <uint32_t WindowBits, uint32_t HashBits>
+void check_round_trip(uint32_t in_chunk, uint32_t out_chunk) {
+    static LzCompressor<WindowBits, HashBits> compressor;
+    static LzDecompressor<WindowBits> decompressor;
+    compressor.reset();
+    decompressor.reset();
+
+    const uint32_t size = compress_all(compressor, span<const uint8_t>(input, INPUT_SIZE), in_chunk, out_chunk);
+    CHECK_LT(size, OUTPUT_CAPACITY);
+    CHECK(decompress_all(decompressor, size, INPUT_SIZE, out_chunk));
+}
+
+// 出力を記録する ByteWritable
+class MemoryWriter : public ByteWritable {
+public:
+    size_t write(span<const uint8_t> data) override {
+        const size_t room = limit - length;
+        const size_t n = (data.size() < room) ? data.size() : room;
+        std::memcpy(compressed + length, data.data(), n);
+        length += n;
+        return n;
+    }
+
+    size_t length = 0;
+    size_t limit = OUTPUT_CAPACITY;
+};
+
+} // namespace
+
+TEST_CASE("lz - 往復") {
+    SUBCASE("ログは小さくなる") {
+        make_log(input, INPUT_SIZE);
+        LzCompressor<13, 13> compressor;
+        const uint32_t size = compress_all(compressor, span<const uint8_t>(input, INPUT_SIZE), INPUT_SIZE, OUTPUT_CAPACITY);
+        CHECK_LT(size, INPUT_SIZE / 3);
+
+        LzDecompressor<13> decompressor;
+        CHECK(decompress_all(decompressor, size, INPUT_SIZE, OUTPUT_CAPACITY));
+    }
+
+    SUBCASE("窓とハッシュ表の組み合わせ、分割した入出力") {
+        make_log(input, INPUT_SIZE);
+        check_round_trip<13, 13>(1000, 7);
+        check_round_trip<8, 0>(1, 1);
+        check_round_trip<8, 8>(33, 5);
+        check_round_trip<10, 0>(300, 64);
+        check_round_trip<12, 14>(5000, 300);
+    }
+
+    SUBCASE("圧縮しにくいデータの膨張はリテラルの制御バイトのみ") {
+        make_noise(input, INPUT_SIZE);
+        LzCompressor<13, 13> compressor;
+        const uint32_t size = compress_all(compressor, span<const uint8_t>(input, INPUT_SIZE), 4096, 4096);
+        CHECK_LE(size, INPUT_SIZE + (INPUT_SIZE + 31) / 32);
+
+        LzDecompressor<13> decompressor;
+        CHECK(decompress_all(decompressor, size, INPUT_SIZE, 4096));
+        check_round_trip<8, 0>(100, 100);
+    }
+
+    SUBCASE("同じバイトの連続") {
+        std::memset(input, 'A', INPUT_SIZE);
+        LzCompressor<8, 0> compressor;
+        const uint32_t size = compress_all(compressor, span<const uint8_t>(input, INPUT_SIZE), 512, 512);
+        CHECK_LT(size, INPUT_SIZE / 80);
+        LzDecompressor<8> decompressor;
+        CHECK(decompress_all(decompressor, size, INPUT_SIZE, 512));
+    }
+}
+
+TEST_CASE("lz - flush後も同じ窓で続けられる") {
+    make_log(input, 2000);
+    LzCompressor<10, 10> compressor;
+    LzDecompressor<10> decompressor;
+
+    uint32_t written = 0;
+    for (uint32_t part = 0; part < 2; ++part) {
+        const auto step = compressor.compress(span<const uint8_t>(input + part * 1000, 1000), span<uint8_t>(compressed + written, OUTPUT_CAPACITY - written), true);
+        CHECK_EQ(step.consumed, 1000U);
+        CHECK_FALSE(compressor.has_pending());
+        written += step.produced;
+
+        // flush までの符号だけで、それまでの入力がすべて復元できる
+        auto restored_part = decompressor.decompress(span<const uint8_t>(compressed + written - step.produced, step.produced), span<uint8_t>(restored + part * 1000, 1000));
+        REQUIRE(restored_part.is_ok());
+        CHECK_EQ(restored_part.value().produced, 1000U);
+        CHECK(decompressor.is_complete());
+    }
+    CHECK_EQ(std::memcmp(input, restored, 2000), 0);
+}
+
+TEST_CASE("lz - 空の出力先") {
+    make_log(input, 100);
+    LzCompressor<8, 8> compressor;
+    const auto step = compressor.compress(span<const uint8_t>(input, 100), span<uint8_t>(), false);
+    CHECK_EQ(step.produced, 0U);
+    CHECK(compressor.has_pending());
+
+    const uint32_t size = compress_all(compressor, span<const uint8_t>(input + step.consumed, 100 - step.consumed), 100, OUTPUT_CAPACITY);
+    LzDecompressor<8> decompressor;
+    CHECK(decompress_all(decompressor, size, 100, OUTPUT_CAPACITY));
+}
+
+TEST_CASE("lz - 不正な入力") {
+    LzDecompressor<8> decompressor;
+    uint8_t out[16];
+
+    // 履歴より遠い距離
+    const uint8_t too_far[] = {0x01, 'a', 'b', 0x20, 0x05};
+    auto result = decompressor.decompress(span<const uint8_t>(too_far, sizeof(too_far)), span<uint8_t>(out));
+    CHECK_EQ(result.error(), Error::INVALID_DATA);
+    auto sticky = decompressor.decompress(span<const uint8_t>(too_far, 1), span<uint8_t>(out));
+    CHECK_EQ(sticky.error(), Error::INVALID_DATA);
+
+    // 符号の途中で終わる入力は is_complete() が false
+    decompressor.reset();
+    const uint8_t partial[] = {0x02, 'x', 'y', 'z', 0x20};
+    auto ok = decompressor.decompress(span<const uint8_t>(partial, sizeof(partial)), span<uint8_t>(out));
+    REQUIRE(ok.is_ok());
+    CHECK_EQ(ok.value().produced, 3U);
+    CHECK_FALSE(decompressor.is_complete());
+}
+
+TEST_CASE("lz - LzWriter") {
+    make_log(input, INPUT_SIZE);
+
+    SUBCASE("ByteWritable の前段で圧縮") {
+        MemoryWriter sink;
+        LzWriter<12, 12, 32> writer(sink);
+        for (uint32_t offset = 0; offset < INPUT_SIZE; offset += 1234) {
+            const uint32_t n = (INPUT_SIZE - offset < 1234) ? INPUT_SIZE - offset : 1234;
+            CHECK_EQ(writer.write(span<const uint8_t>(input + offset, n)), n);
+        }
+        CHECK(writer.flush());
+        CHECK_LT(sink.length, INPUT_SIZE / 3);
+
+        LzDecompressor<12> decompressor;
+        CHECK(decompress_all(decompressor, static_cast<uint32_t>(sink.length), INPUT_SIZE, 256));
+    }
+
+    SUBCASE("出力の書き込み失敗") {
+        MemoryWriter sink;
+        sink.limit = 10;
+        LzWriter<8, 0> writer(sink);
+        CHECK_EQ(writer.write(span<const uint8_t>(input, 1000)), 0U);
+        CHECK_FALSE(writer.flush());
+    }
+}
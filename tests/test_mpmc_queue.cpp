@@ -0,0 +1,136 @@
+// MpmcQueue<T, N> の単体テスト
+
+#define DOCTEST_CONFIG_NO_EXCEPTIONS
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <omusubi/core/mpmc_queue.hpp>
+
+#include <atomic>
+#include <thread>
+
+#include "doctest.h"
+
+using namespace omusubi;
+
+TEST_CASE("MpmcQueue - 基本機能") {
+    MpmcQueue<int32_t, 4> queue;
+    CHECK_EQ(queue.capacity(), 4U);
+    CHECK_EQ(queue.size_approx(), 0U);
+
+    CHECK(queue.try_push(1));
+    CHECK(queue.try_push(2));
+    CHECK(queue.try_push(3));
+    CHECK(queue.try_push(4));
+    CHECK_FALSE(queue.try_push(5));
+    CHECK_EQ(queue.size_approx(), 4U);
+
+    auto first = queue.try_pop();
+    REQUIRE(first.is_ok());
+    CHECK_EQ(first.value(), 1);
+
+    int32_t value = 0;
+    CHECK(queue.try_pop(value));
+    CHECK_EQ(value, 2);
+
+    // 折り返し
+    CHECK(queue.try_push(5));
+    CHECK(queue.try_push(6));
+    for (int32_t expected = 3; expected <= 6; ++expected) {
+        REQUIRE(queue.try_pop(value));
+        CHECK_EQ(value, expected);
+    }
+
+    auto empty = queue.try_pop();
+    REQUIRE(empty.is_err());
+    CHECK_EQ(empty.error(), Error::BUFFER_EMPTY);
+}
+
+TEST_CASE("MpmcQueue - 一括操作") {
+    MpmcQueue<uint32_t, 8> queue;
+    const uint32_t input[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+    uint32_t output[10] = {};
+
+    SUBCASE("空きが足りない場合は入る分だけ") {
+        CHECK_EQ(queue.push(span<const uint32_t>(input, 10)), 8U);
+        CHECK_EQ(queue.push(span<const uint32_t>(input, 1)), 0U);
+        CHECK_EQ(queue.pop(span<uint32_t>(output, 10)), 8U);
+        CHECK_EQ(output[0], 1U);
+        CHECK_EQ(output[7], 8U);
+        CHECK_EQ(queue.pop(span<uint32_t>(output, 10)), 0U);
+    }
+
+    SUBCASE("折り返しをまたぐ") {
+        CHECK_EQ(queue.push(span<const uint32_t>(input, 6)), 6U);
+        CHECK_EQ(queue.pop(span<uint32_t>(output, 4)), 4U);
+        CHECK_EQ(queue.push(span<const uint32_t>(input + 6, 4)), 4U);
+        CHECK_EQ(queue.pop(span<uint32_t>(output, 10)), 6U);
+        for (uint32_t i = 0; i < 6; ++i) {
+            CHECK_EQ(output[i], i + 5);
+        }
+    }
+
+    SUBCASE("空の span") {
+        CHECK_EQ(queue.push(span<const uint32_t>()), 0U);
+        CHECK_EQ(queue.pop(span<uint32_t>()), 0U);
+    }
+}
+
+TEST_CASE("MpmcQueue - 複数の生産者と消費者") {
+    static MpmcQueue<uint32_t, 256> queue;
+    constexpr uint32_t PRODUCERS = 4;
+    constexpr uint32_t CONSUMERS = 4;
+    constexpr uint32_t PER_PRODUCER = 20000;
+
+    std::atomic<uint64_t> sum {0};
+    std::atomic<uint32_t> received {0};
+    std::thread producers[PRODUCERS];
+    std::thread consumers[CONSUMERS];
+
+    for (uint32_t p = 0; p < PRODUCERS; ++p) {
+        producers[p] = std::thread([p] {
+            uint32_t batch[5];
+            uint32_t next = 0;
+            while (next < PER_PRODUCER) {
+                uint32_t n = 0;
+                while (n < 5 && next + n < PER_PRODUCER) {
+                    batch[n] = p * PER_PRODUCER + next + n;
+                    ++n;
+                }
+                const uint32_t pushed = queue.push(span<const uint32_t>(batch, n));
+                if (pushed == 0) {
+                    std::this_thread::yield();
+                }
+                next += pushed;
+            }
+        });
+    }
+
+    for (auto& consumer : consumers) {
+        consumer = std::thread([&sum, &received] {
+            uint32_t batch[3];
+            while (received.load() < PRODUCERS * PER_PRODUCER) {
+                const uint32_t n = queue.pop(span<uint32_t>(batch, 3));
+                if (n == 0) {
+                    std::this_thread::yield();
+                }
+                uint64_t local = 0;
+                for (uint32_t i = 0; i < n; ++i) {
+                    local += batch[i];
+                }
+                sum += local;
+                received += n;
+            }
+        });
+    }
+
+    for (auto& producer : producers) {
+        producer.join();
+    }
+    for (auto& consumer : consumers) {
+        consumer.join();
+    }
+
+    constexpr uint64_t TOTAL = static_cast<uint64_t>(PRODUCERS) * PER_PRODUCER;
+    CHECK_EQ(received.load(), TOTAL);
+    CHECK_EQ(sum.load(), TOTAL * (TOTAL - 1) / 2);
+    CHECK_EQ(queue.size_approx(), 0U);
+}
@@ -0,0 +1,222 @@
+// ObjectPool<T, N> / LockFreeObjectPool<T, N> の単体テスト
+
+#define DOCTEST_CONFIG_NO_EXCEPTIONS
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <omusubi/core/object_pool.hpp>
+
+#include <thread>
+
+#include "doctest.h"
+
+using namespace omusubi;
+
+namespace {
+
+struct Session {
+    static int live_count;
+
+    uint32_t id;
+    uint16_t port;
+
+    Session(uint32_t session_id, uint16_t session_port) noexcept : id(session_id), port(session_port) { ++live_count; }
+
+    ~Session() noexcept { --live_count; }
+
+    Session(const Session&) = delete;
+    Session& operator=(const Session&) = delete;
+    Session(Session&&) = delete;
+    Session& operator=(Session&&) = delete;
+};
+
+int Session::live_count = 0;
+
+} // namespace
+
+TEST_CASE("ObjectPool - 生成と破棄") {
+    ObjectPool<Session, 3> pool;
+    CHECK_EQ(pool.capacity(), 3U);
+    CHECK_EQ(pool.available(), 3U);
+
+    Session* a = pool.create(1U, static_cast<uint16_t>(80));
+    REQUIRE(a != nullptr);
+    CHECK_EQ(a->id, 1U);
+    CHECK_EQ(a->port, 80);
+    CHECK_EQ(Session::live_count, 1);
+    CHECK(pool.owns(a));
+
+    Session* b = pool.create(2U, static_cast<uint16_t>(443));
+    Session* c = pool.create(3U, static_cast<uint16_t>(8080));
+    REQUIRE(b != nullptr);
+    REQUIRE(c != nullptr);
+    CHECK(pool.create(4U, static_cast<uint16_t>(0)) == nullptr);
+    CHECK_EQ(pool.size(), 3U);
+
+    pool.destroy(b);
+    CHECK_EQ(Session::live_count, 2);
+    CHECK_EQ(pool.available(), 1U);
+
+    // 返却したスロットが再利用される
+    Session* d = pool.create(5U, static_cast<uint16_t>(22));
+    CHECK(d == b);
+
+    pool.destroy(a);
+    pool.destroy(c);
+    pool.destroy(d);
+    pool.destroy(nullptr);
+    CHECK_EQ(Session::live_count, 0);
+    CHECK_EQ(pool.size(), 0U);
+}
+
+TEST_CASE("ObjectPool - owns") {
+    ObjectPool<uint32_t, 4> pool;
+    uint32_t outside = 0;
+    uint32_t* inside = pool.create(7U);
+
+    CHECK(pool.owns(inside));
+    CHECK_FALSE(pool.owns(&outside));
+    CHECK_FALSE(pool.owns(nullptr));
+    pool.destroy(inside);
+}
+
+TEST_CASE("ObjectPool - PoolHandle") {
+    ObjectPool<Session, 2> pool;
+
+    SUBCASE("スコープ終了で自動返却") {
+        {
+            auto handle = pool.make(1U, static_cast<uint16_t>(80));
+            REQUIRE(handle);
+            CHECK_EQ(handle->id, 1U);
+            CHECK_EQ((*handle).port, 80);
+            CHECK_EQ(pool.size(), 1U);
+        }
+        CHECK_EQ(pool.size(), 0U);
+        CHECK_EQ(Session::live_count, 0);
+    }
+
+    SUBCASE("満杯の場合は空のハンドル") {
+        auto a = pool.make(1U, static_cast<uint16_t>(1));
+        auto b = pool.make(2U, static_cast<uint16_t>(2));
+        auto c = pool.make(3U, static_cast<uint16_t>(3));
+        CHECK(a);
+        CHECK(b);
+        CHECK_FALSE(c);
+    }
+
+    SUBCASE("ムーブ") {
+        auto a = pool.make(1U, static_cast<uint16_t>(1));
+        ObjectPool<Session, 2>::Handle b(static_cast<ObjectPool<Session, 2>::Handle&&>(a));
+        CHECK_FALSE(a);
+        REQUIRE(b);
+        CHECK_EQ(b->id, 1U);
+        CHECK_EQ(pool.size(), 1U);
+
+        b = pool.make(2U, static_cast<uint16_t>(2)); // 古いオブジェクトは返却される
+        CHECK_EQ(b->id, 2U);
+        CHECK_EQ(pool.size(), 1U);
+    }
+
+    SUBCASE("release で所有権を手放す") {
+        Session* raw = nullptr;
+        {
+            auto handle = pool.make(9U, static_cast<uint16_t>(9));
+            raw = handle.release();
+        }
+        CHECK_EQ(pool.size(), 1U);
+        pool.destroy(raw);
+        CHECK_EQ(pool.size(), 0U);
+    }
+
+    CHECK_EQ(Session::live_count, 0);
+}
+
+TEST_CASE("ObjectPool - 統計情報") {
+    ObjectPool<uint32_t, 4> pool;
+
+    uint32_t* a = pool.create(1U);
+    uint32_t* b = pool.create(2U);
+    uint32_t* c = pool.create(3U);
+    pool.destroy(b);
+    pool.destroy(c);
+
+    auto stats = pool.get_stats();
+    CHECK_EQ(stats.capacity, 4U);
+    CHECK_EQ(stats.in_use, 1U);
+    CHECK_EQ(stats.high_water_mark, 3U);
+    CHECK_EQ(stats.total_allocations, 3U);
+    CHECK_EQ(stats.failed_allocations, 0U);
+
+    uint32_t* all[4] = {};
+    for (auto*& p : all) {
+        p = pool.create(0U);
+    }
+    CHECK(all[3] == nullptr);
+    CHECK_EQ(pool.get_stats().failed_allocations, 1U);
+    CHECK_EQ(pool.get_stats().high_water_mark, 4U);
+
+    for (auto* p : all) {
+        pool.destroy(p);
+    }
+    pool.reset_stats();
+    stats = pool.get_stats();
+    CHECK_EQ(stats.high_water_mark, 1U);
+    CHECK_EQ(stats.total_allocations, 0U);
+    pool.destroy(a);
+}
+
+TEST_CASE("LockFreeObjectPool - 基本機能") {
+    LockFreeObjectPool<Session, 2> pool;
+
+    {
+        auto a = pool.make(1U, static_cast<uint16_t>(1));
+        auto b = pool.make(2U, static_cast<uint16_t>(2));
+        REQUIRE(a);
+        REQUIRE(b);
+        CHECK(pool.owns(a.get()));
+        CHECK_FALSE(pool.make(3U, static_cast<uint16_t>(3)));
+        CHECK_EQ(pool.available(), 0U);
+    }
+
+    auto stats = pool.get_stats();
+    CHECK_EQ(stats.in_use, 0U);
+    CHECK_EQ(stats.high_water_mark, 2U);
+    CHECK_EQ(stats.total_allocations, 2U);
+    CHECK_EQ(stats.failed_allocations, 1U);
+    CHECK_EQ(Session::live_count, 0);
+}
+
+TEST_CASE("LockFreeObjectPool - 複数スレッド") {
+    static LockFreeObjectPool<uint64_t, 16> pool;
+    constexpr uint32_t THREADS = 4;
+    constexpr uint32_t ITERATIONS = 20000;
+
+    std::thread threads[THREADS];
+    bool ok[THREADS] = {};
+
+    for (uint32_t t = 0; t < THREADS; ++t) {
+        threads[t] = std::thread([t, &ok] {
+            bool valid = true;
+            for (uint32_t i = 0; i < ITERATIONS; ++i) {
+                const uint64_t tag = (static_cast<uint64_t>(t) << 32) | i;
+                auto handle = pool.make(tag);
+                if (!handle) {
+                    std::this_thread::yield();
+                    continue;
+                }
+                // 他スレッドと同じスロットを共有していないこと
+                std::this_thread::yield();
+                valid = valid && (*handle == tag);
+            }
+            ok[t] = valid;
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (bool result : ok) {
+        CHECK(result);
+    }
+    CHECK_EQ(pool.size(), 0U);
+    CHECK_LE(pool.get_stats().high_water_mark, 16U);
+}
@@ -0,0 +1,155 @@
+// PackedCodec<T, Order> の単体テスト
+
+#define DOCTEST_CONFIG_NO_EXCEPTIONS
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <omusubi/core/packed.hpp>
+
+#include "doctest.h"
+
+#include <cstring>
+
+using namespace omusubi;
+
+namespace {
+
+enum class Mode : uint8_t { IDLE = 1, ACTIVE = 2 };
+
+// 詰め物を含む構造体（フィールドごとに符号化される）
+struct SensorPacket {
+    uint16_t id;
+    int32_t temperature;
+    Vector3 accel;
+    bool alarm;
+    Mode mode;
+    uint8_t flags[2];
+    double timestamp;
+};
+
+// 詰め物のない構造体（リトルエンディアンのホストでは memcpy される）
+struct Sample {
+    uint32_t sequence;
+    int16_t values[4];
+    float gain;
+};
+
+// 宣言順と異なる順に並べた記述子
+struct Reordered {
+    uint32_t a;
+    uint32_t b;
+};
+
+} // namespace
+
+template <>
+struct omusubi::StructFields<SensorPacket>
+    : FieldList<&SensorPacket::id, &SensorPacket::temperature, &SensorPacket::accel, &SensorPacket::alarm, &SensorPacket::mode, &SensorPacket::flags, &SensorPacket::timestamp> {};
+
+template <>
+struct omusubi::StructFields<Sample> : FieldList<&Sample::sequence, &Sample::values, &Sample::gain> {};
+
+template <>
+struct omusubi::StructFields<Reordered> : FieldList<&Reordered::b, &Reordered::a> {};
+
+TEST_CASE("PackedCodec - 符号化後のサイズはコンパイル時定数") {
+    static_assert(PackedCodec<SensorPacket>::SIZE == 2 + 4 + 12 + 1 + 1 + 2 + 8, "packed size");
+    static_assert(PackedCodec<Sample>::SIZE == sizeof(Sample), "no padding");
+    static_assert(PackedCodec<Vector3, ByteOrder::BIG>::SIZE == 12, "Vector3");
+
+    uint8_t buffer[PackedCodec<SensorPacket>::SIZE];
+    CHECK_EQ(sizeof(buffer), 30U);
+}
+
+TEST_CASE("PackedCodec - リトルエンディアン・ビッグエンディアンの配置") {
+    SensorPacket packet {};
+    packet.id = 0x1234;
+    packet.temperature = -2;
+    packet.accel = Vector3(1.0F, -2.0F, 0.5F);
+    packet.alarm = true;
+    packet.mode = Mode::ACTIVE;
+    packet.flags[0] = 0xAA;
+    packet.flags[1] = 0xBB;
+    packet.timestamp = 1.0;
+
+    uint8_t little[PackedCodec<SensorPacket>::SIZE];
+    const Result<uint32_t> written = PackedCodec<SensorPacket, ByteOrder::LITTLE>::encode(packet, span<uint8_t>(little));
+    REQUIRE(written.is_ok());
+    CHECK_EQ(written.value(), 30U);
+
+    const uint8_t expected_little[] = {
+        0x34, 0x12,                                     // id
+        0xFE, 0xFF, 0xFF, 0xFF,                         // temperature
+        0x00, 0x00, 0x80, 0x3F,                         // accel.x = 1.0F
+        0x00, 0x00, 0x00, 0xC0,                         // accel.y = -2.0F
+        0x00, 0x00, 0x00, 0x3F,                         // accel.z = 0.5F
+        0x01,                                           // alarm
+        0x02,                                           // mode
+        0xAA, 0xBB,                                     // flags
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x3F, // timestamp = 1.0
+    };
+    CHECK_EQ(std::memcmp(little, expected_little, sizeof(expected_little)), 0);
+
+    uint8_t big[PackedCodec<SensorPacket>::SIZE];
+    REQUIRE((PackedCodec<SensorPacket, ByteOrder::BIG>::encode(packet, span<uint8_t>(big)).is_ok()));
+    const uint8_t expected_big_head[] = {0x12, 0x34, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0x80, 0x00, 0x00};
+    CHECK_EQ(std::memcmp(big, expected_big_head, sizeof(expected_big_head)), 0);
+    CHECK_EQ(big[22], 0x3F);
+    CHECK_EQ(big[23], 0xF0);
+
+    // 往復
+    const Result<SensorPacket> decoded = PackedCodec<SensorPacket, ByteOrder::BIG>::decode(span<const uint8_t>(big));
+    REQUIRE(decoded.is_ok());
+    const SensorPacket& value = decoded.value();
+    CHECK_EQ(value.id, 0x1234);
+    CHECK_EQ(value.temperature, -2);
+    CHECK_EQ(value.accel.y, -2.0F);
+    CHECK(value.alarm);
+    CHECK(value.mode == Mode::ACTIVE);
+    CHECK_EQ(value.flags[1], 0xBB);
+    CHECK_EQ(value.timestamp, 1.0);
+}
+
+TEST_CASE("PackedCodec - 一括コピーの判定") {
+    CHECK_FALSE(PackedCodec<SensorPacket>::is_bulk_copy());
+    CHECK_FALSE(PackedCodec<Reordered>::is_bulk_copy());
+    CHECK_FALSE((PackedCodec<Sample, ByteOrder::BIG>::is_bulk_copy()));
+    if constexpr (detail::HOST_BYTE_ORDER == ByteOrder::LITTLE && detail::HOST_BYTE_ORDER_KNOWN) {
+        CHECK(PackedCodec<Sample>::is_bulk_copy());
+        CHECK(PackedCodec<Vector3>::is_bulk_copy());
+    }
+
+    // 一括コピーでもフィールドごとの符号化と同じ結果になる
+    Sample sample {0x01020304, {1, -1, 300, -300}, 0.25F};
+    uint8_t fast[PackedCodec<Sample>::SIZE];
+    uint8_t slow[PackedCodec<Sample>::SIZE];
+    REQUIRE(PackedCodec<Sample>::encode(sample, span<uint8_t>(fast)).is_ok());
+    detail::PackedType<Sample, ByteOrder::LITTLE>::encode(sample, slow);
+    CHECK_EQ(std::memcmp(fast, slow, sizeof(fast)), 0);
+    CHECK_EQ(fast[0], 0x04);
+    CHECK_EQ(fast[6], 0xFF);
+
+    // 記述子の順序はワイヤ上の順序
+    Reordered reordered {1, 2};
+    uint8_t wire[8];
+    REQUIRE(PackedCodec<Reordered>::encode(reordered, span<uint8_t>(wire)).is_ok());
+    CHECK_EQ(wire[0], 2);
+    CHECK_EQ(wire[4], 1);
+
+    Reordered back {};
+    const Result<uint32_t> read = PackedCodec<Reordered>::decode(span<const uint8_t>(wire), back);
+    REQUIRE(read.is_ok());
+    CHECK_EQ(back.a, 1U);
+    CHECK_EQ(back.b, 2U);
+}
+
+TEST_CASE("PackedCodec - バッファ不足") {
+    Sample sample {};
+    uint8_t small[PackedCodec<Sample>::SIZE - 1];
+
+    const Result<uint32_t> written = PackedCodec<Sample>::encode(sample, span<uint8_t>(small));
+    REQUIRE(written.is_err());
+    CHECK_EQ(written.error(), Error::BUFFER_FULL);
+
+    const Result<Sample> decoded = PackedCodec<Sample>::decode(span<const uint8_t>(small));
+    REQUIRE(decoded.is_err());
+    CHECK_EQ(decoded.error(), Error::BUFFER_EMPTY);
+}
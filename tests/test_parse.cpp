@@ -0,0 +1,175 @@
+// parse<T>() の単体テスト
+
+#define DOCTEST_CONFIG_NO_EXCEPTIONS
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <omusubi/core/parse.hpp>
+
+#include <cmath>
+#include <cstring>
+
+#include "doctest.h"
+
+using namespace omusubi;
+using namespace std::literals;
+
+namespace {
+
+// ビット単位で一致するか判定（-0.0 と 0.0 を区別する）
+template <typename T>
+bool same_bits(T a, T b) {
+    return std::memcmp(&a, &b, sizeof(T)) == 0;
+}
+
+} // namespace
+
+TEST_CASE("parse<整数> - 基本機能") {
+    SUBCASE("符号なし") {
+        CHECK_EQ(parse<uint32_t>("0"sv).value(), 0U);
+        CHECK_EQ(parse<uint32_t>("42"sv).value(), 42U);
+        CHECK_EQ(parse<uint32_t>("+42"sv).value(), 42U);
+        CHECK_EQ(parse<uint32_t>("0007"sv).value(), 7U);
+    }
+
+    SUBCASE("符号付き") {
+        CHECK_EQ(parse<int32_t>("-42"sv).value(), -42);
+        CHECK_EQ(parse<int32_t>("-0"sv).value(), 0);
+        CHECK_EQ(parse<int16_t>("-1234"sv).value(), -1234);
+    }
+
+    SUBCASE("8桁以上（SWARパス）") {
+        CHECK_EQ(parse<uint32_t>("12345678"sv).value(), 12345678U);
+        CHECK_EQ(parse<uint32_t>("123456789"sv).value(), 123456789U);
+        CHECK_EQ(parse<uint64_t>("1234567890123456"sv).value(), 1234567890123456U);
+        CHECK_EQ(parse<int64_t>("-12345678901234567"sv).value(), -12345678901234567);
+    }
+}
+
+TEST_CASE("parse<整数> - 型ごとの範囲") {
+    SUBCASE("8bit") {
+        CHECK_EQ(parse<uint8_t>("255"sv).value(), 255U);
+        CHECK(parse<uint8_t>("256"sv).is_err());
+        CHECK_EQ(parse<int8_t>("-128"sv).value(), -128);
+        CHECK_EQ(parse<int8_t>("127"sv).value(), 127);
+        CHECK(parse<int8_t>("128"sv).is_err());
+        CHECK(parse<int8_t>("-129"sv).is_err());
+    }
+
+    SUBCASE("32bit") {
+        CHECK_EQ(parse<uint32_t>("4294967295"sv).value(), 4294967295U);
+        CHECK(parse<uint32_t>("4294967296"sv).is_err());
+        CHECK_EQ(parse<int32_t>("-2147483648"sv).value(), INT32_MIN);
+        CHECK(parse<int32_t>("2147483648"sv).is_err());
+    }
+
+    SUBCASE("64bit") {
+        CHECK_EQ(parse<uint64_t>("18446744073709551615"sv).value(), UINT64_MAX);
+        CHECK(parse<uint64_t>("18446744073709551616"sv).is_err());
+        CHECK(parse<uint64_t>("99999999999999999999"sv).is_err());
+        CHECK_EQ(parse<int64_t>("9223372036854775807"sv).value(), INT64_MAX);
+        CHECK_EQ(parse<int64_t>("-9223372036854775808"sv).value(), INT64_MIN);
+        CHECK(parse<int64_t>("-9223372036854775809"sv).is_err());
+    }
+}
+
+TEST_CASE("parse<整数> - 書式エラー") {
+    CHECK(parse<int32_t>(""sv).is_err());
+    CHECK(parse<int32_t>("-"sv).is_err());
+    CHECK(parse<int32_t>("+"sv).is_err());
+    CHECK(parse<int32_t>(" 1"sv).is_err());
+    CHECK(parse<int32_t>("1 "sv).is_err());
+    CHECK(parse<int32_t>("12a"sv).is_err());
+    CHECK(parse<int32_t>("1234567a9"sv).is_err());
+    CHECK(parse<int32_t>("1.0"sv).is_err());
+    CHECK(parse<uint32_t>("-1"sv).is_err());
+
+    auto r = parse<int32_t>("abc"sv);
+    REQUIRE(r.is_err());
+    CHECK_EQ(static_cast<uint8_t>(r.error()), static_cast<uint8_t>(Error::INVALID_DATA));
+}
+
+TEST_CASE("parse<float/double> - 基本機能") {
+    SUBCASE("高速パス") {
+        CHECK_EQ(parse<double>("0"sv).value(), 0.0);
+        CHECK_EQ(parse<double>("1.5"sv).value(), 1.5);
+        CHECK_EQ(parse<double>("-2.25"sv).value(), -2.25);
+        CHECK_EQ(parse<double>("1e22"sv).value(), 1e22);
+        CHECK_EQ(parse<float>("0.25"sv).value(), 0.25F);
+        CHECK_EQ(parse<float>("3.14159"sv).value(), 3.14159F);
+    }
+
+    SUBCASE("省略形") {
+        CHECK_EQ(parse<double>(".5"sv).value(), 0.5);
+        CHECK_EQ(parse<double>("5."sv).value(), 5.0);
+        CHECK_EQ(parse<double>("1E3"sv).value(), 1000.0);
+        CHECK_EQ(parse<double>("1e+3"sv).value(), 1000.0);
+        CHECK_EQ(parse<double>("+1e-3"sv).value(), 0.001);
+    }
+
+    SUBCASE("負のゼロ") {
+        CHECK(same_bits(parse<double>("-0"sv).value(), -0.0));
+        CHECK(same_bits(parse<float>("-0.0e10"sv).value(), -0.0F));
+    }
+
+    SUBCASE("特殊値") {
+        CHECK(std::isinf(parse<double>("inf"sv).value()));
+        CHECK(std::isinf(parse<float>("-Infinity"sv).value()));
+        CHECK(parse<float>("-Infinity"sv).value() < 0.0F);
+        CHECK(std::isnan(parse<double>("NaN"sv).value()));
+    }
+}
+
+TEST_CASE("parse<float/double> - 正確な丸め") {
+    SUBCASE("Eisel-Lemireパス") {
+        CHECK_EQ(parse<double>("1e23"sv).value(), 1e23);
+        CHECK_EQ(parse<double>("0.1"sv).value(), 0.1);
+        CHECK_EQ(parse<double>("9007199254740993"sv).value(), 9007199254740992.0);
+        CHECK_EQ(parse<double>("1.7976931348623157e308"sv).value(), 1.7976931348623157e308);
+        CHECK_EQ(parse<float>("3.4028235e38"sv).value(), 3.4028235e38F);
+        CHECK_EQ(parse<float>("16777217"sv).value(), 16777216.0F);
+    }
+
+    SUBCASE("非正規化数") {
+        CHECK_EQ(parse<double>("4.9406564584124654e-324"sv).value(), 4.9406564584124654e-324);
+        CHECK_EQ(parse<double>("2.2250738585072011e-308"sv).value(), 2.2250738585072011e-308);
+        CHECK_EQ(parse<float>("1.4e-45"sv).value(), 1.4e-45F);
+    }
+
+    SUBCASE("19桁を超える入力（多倍長比較）") {
+        // 1 と次の double のちょうど中間 → 偶数側（1.0）へ丸める
+        CHECK_EQ(parse<double>("1.00000000000000011102230246251565404236316680908203125"sv).value(), 1.0);
+        // 中間値よりわずかに大きい → 切り上げ
+        CHECK_EQ(parse<double>("1.00000000000000011102230246251565404236316680908203126"sv).value(), 1.0000000000000002);
+        CHECK_EQ(parse<double>("1.000000000000000111022302462515654042363166809082031250000000001"sv).value(), 1.0000000000000002);
+        CHECK_EQ(parse<double>("123456789012345678901234567890"sv).value(), 1.2345678901234568e29);
+        CHECK_EQ(parse<double>("00000000000000000000000000000000001.5"sv).value(), 1.5);
+    }
+
+    SUBCASE("アンダーフロー") {
+        CHECK_EQ(parse<double>("1e-400"sv).value(), 0.0);
+        CHECK_EQ(parse<float>("1e-50"sv).value(), 0.0F);
+        CHECK_EQ(parse<double>("2.4703282292062327e-324"sv).value(), 0.0);
+        CHECK_EQ(parse<double>("2.4703282292062328e-324"sv).value(), 4.9406564584124654e-324);
+    }
+}
+
+TEST_CASE("parse<float/double> - エラー") {
+    SUBCASE("オーバーフロー") {
+        CHECK(parse<double>("1e400"sv).is_err());
+        CHECK(parse<double>("1.7976931348623159e308"sv).is_err());
+        CHECK(parse<float>("3.5e38"sv).is_err());
+    }
+
+    SUBCASE("書式エラー") {
+        CHECK(parse<double>(""sv).is_err());
+        CHECK(parse<double>("."sv).is_err());
+        CHECK(parse<double>("-"sv).is_err());
+        CHECK(parse<double>("e5"sv).is_err());
+        CHECK(parse<double>("1e"sv).is_err());
+        CHECK(parse<double>("1e+"sv).is_err());
+        CHECK(parse<double>("1.2.3"sv).is_err());
+        CHECK(parse<double>("1.5 "sv).is_err());
+        CHECK(parse<double>("0x10"sv).is_err());
+        CHECK(parse<double>("infinite"sv).is_err());
+        CHECK(parse<float>("1,5"sv).is_err());
+    }
+}
@@ -0,0 +1,114 @@
+// PriorityQueue<T, N> の単体テスト
+
+#define DOCTEST_CONFIG_NO_EXCEPTIONS
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <omusubi/core/priority_queue.hpp>
+#include <omusubi/core/timer_wheel.hpp>
+
+#include "doctest.h"
+
+using namespace omusubi;
+
+namespace {
+
+struct Deadline {
+    uint32_t at_ms;
+    uint16_t id;
+};
+
+struct Earlier {
+    bool operator()(const Deadline& a, const Deadline& b) const noexcept { return is_time_before(a.at_ms, b.at_ms); }
+};
+
+struct Greater {
+    bool operator()(int32_t a, int32_t b) const noexcept { return a > b; }
+};
+
+uint32_t next_random(uint32_t& state) {
+    state = state * 1664525U + 1013904223U;
+    return state >> 8;
+}
+
+} // namespace
+
+TEST_CASE("PriorityQueue - 基本機能") {
+    PriorityQueue<int32_t, 8> queue;
+    CHECK(queue.is_empty());
+    CHECK(queue.top() == nullptr);
+    CHECK_FALSE(queue.pop());
+
+    for (int32_t value : {5, 3, 8, 1, 9, 2}) {
+        CHECK(queue.push(value));
+    }
+    CHECK_EQ(queue.size(), 6U);
+    CHECK_EQ(*queue.top(), 1);
+
+    int32_t out = 0;
+    for (int32_t expected : {1, 2, 3, 5, 8, 9}) {
+        REQUIRE(queue.pop(out));
+        CHECK_EQ(out, expected);
+    }
+    CHECK(queue.is_empty());
+}
+
+TEST_CASE("PriorityQueue - 容量超過") {
+    PriorityQueue<int32_t, 2> queue;
+    CHECK(queue.push(1));
+    CHECK(queue.push(2));
+    CHECK(queue.is_full());
+    CHECK_FALSE(queue.push(0));
+    CHECK_EQ(*queue.top(), 1);
+}
+
+TEST_CASE("PriorityQueue - 比較関数と分岐数") {
+    PriorityQueue<int32_t, 64, Greater, 2> max_heap;
+    uint32_t state = 7;
+    for (uint32_t i = 0; i < 64; ++i) {
+        CHECK(max_heap.push(static_cast<int32_t>(next_random(state) % 1000)));
+    }
+
+    int32_t previous = 1000;
+    int32_t value = 0;
+    while (max_heap.pop(value)) {
+        CHECK(value <= previous);
+        previous = value;
+    }
+}
+
+TEST_CASE("PriorityQueue - ラップアラウンドする期限") {
+    PriorityQueue<Deadline, 8, Earlier> deadlines;
+    const uint32_t now = 0xFFFFFF00U;
+
+    CHECK(deadlines.push(Deadline {now + 500, 3})); // ラップ後
+    CHECK(deadlines.push(Deadline {now + 100, 1}));
+    CHECK(deadlines.push(Deadline {now + 300, 2})); // ラップ後
+
+    Deadline next {};
+    for (uint16_t expected : {1, 2, 3}) {
+        REQUIRE(deadlines.pop(next));
+        CHECK_EQ(next.id, expected);
+    }
+}
+
+TEST_CASE("PriorityQueue - ランダム順の投入") {
+    PriorityQueue<uint32_t, 256> queue;
+    uint32_t state = 99;
+    uint32_t counts[128] = {};
+
+    for (uint32_t round = 0; round < 2000; ++round) {
+        if (next_random(state) % 3 != 0 && !queue.is_full()) {
+            const uint32_t value = next_random(state) % 128;
+            CHECK(queue.push(value));
+            ++counts[value];
+        } else if (!queue.is_empty()) {
+            uint32_t minimum = 0;
+            while (counts[minimum] == 0) {
+                ++minimum;
+            }
+            uint32_t value = 0;
+            REQUIRE(queue.pop(value));
+            CHECK_EQ(value, minimum);
+            --counts[value];
+        }
+    }
+}
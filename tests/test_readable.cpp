@@ -0,0 +1,98 @@
+// ByteReadable のゼロコピー読み取り（peek / consume）の単体テスト
+
+#define DOCTEST_CONFIG_NO_EXCEPTIONS
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <omusubi/core/ring_buffer.hpp>
+#include <omusubi/interface/readable.h>
+
+#include "doctest.h"
+
+using namespace omusubi;
+
+namespace {
+
+// RingBuffer を受信バッファとするドライバ（peek / consume をオーバーライド）
+class RingReader : public ByteReadable {
+public:
+    RingBuffer<uint8_t, 8> rx;
+
+    size_t read(span<uint8_t> buffer) override { return rx.pop(buffer); }
+
+    [[nodiscard]] size_t available() const override { return rx.size(); }
+
+    [[nodiscard]] span<const uint8_t> peek() override { return rx.read_region(); }
+
+    size_t consume(size_t count) override {
+        const size_t n = (count < rx.size()) ? count : rx.size();
+        rx.consume(static_cast<uint32_t>(n));
+        return n;
+    }
+};
+
+// read() だけを実装した既存ドライバ
+class LegacyReader : public ByteReadable {
+public:
+    explicit LegacyReader(span<const uint8_t> data) noexcept : data_(data) {}
+
+    size_t read(span<uint8_t> buffer) override {
+        size_t n = 0;
+        while (n < buffer.size() && position_ < data_.size()) {
+            buffer[n++] = data_[position_++];
+        }
+        return n;
+    }
+
+    [[nodiscard]] size_t available() const override { return data_.size() - position_; }
+
+private:
+    span<const uint8_t> data_;
+    size_t position_ = 0;
+};
+
+} // namespace
+
+TEST_CASE("ByteReadable - peek / consume のオーバーライド") {
+    RingReader reader;
+    const uint8_t first[] = {1, 2, 3, 4, 5, 6};
+    CHECK_EQ(reader.rx.push(span<const uint8_t>(first)), 6U);
+
+    span<const uint8_t> region = reader.peek();
+    REQUIRE_EQ(region.size(), 6U);
+    CHECK_EQ(region[0], 1);
+    CHECK_EQ(reader.consume(4), 4U);
+    CHECK_EQ(reader.available(), 2U);
+
+    // 折り返し位置までの領域だけが返る
+    const uint8_t second[] = {7, 8, 9, 10};
+    CHECK_EQ(reader.rx.push(span<const uint8_t>(second)), 4U);
+    region = reader.peek();
+    REQUIRE_EQ(region.size(), 4U);
+    CHECK_EQ(region[0], 5);
+    CHECK_EQ(region[3], 8);
+    CHECK_EQ(reader.consume(4), 4U);
+
+    region = reader.peek();
+    REQUIRE_EQ(region.size(), 2U);
+    CHECK_EQ(region[0], 9);
+}
+
+TEST_CASE("ByteReadable - デフォルト実装") {
+    uint8_t data[100];
+    for (uint8_t i = 0; i < 100; ++i) {
+        data[i] = i;
+    }
+    LegacyReader reader {span<const uint8_t>(data)};
+
+    // ゼロコピー非対応
+    CHECK(reader.peek().empty());
+
+    // consume は read() で読み捨てる
+    CHECK_EQ(reader.consume(70), 70U);
+    uint8_t next = 0;
+    CHECK_EQ(reader.read(span<uint8_t>(&next, 1)), 1U);
+    CHECK_EQ(next, 70);
+
+    // 残りより多く指定した場合は読めた分だけ
+    CHECK_EQ(reader.consume(100), 29U);
+    CHECK_EQ(reader.available(), 0U);
+}
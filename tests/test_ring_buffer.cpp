@@ -0,0 +1,170 @@
+// RingBuffer<T, N> の単体テスト
+
+#define DOCTEST_CONFIG_NO_EXCEPTIONS
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <omusubi/core/ring_buffer.hpp>
+
+#include <thread>
+
+#include "doctest.h"
+
+using namespace omusubi;
+
+TEST_CASE("RingBuffer - 基本機能") {
+    RingBuffer<uint8_t, 4> rb;
+    CHECK_EQ(rb.capacity(), 4U);
+    CHECK(rb.is_empty());
+    CHECK_FALSE(rb.is_full());
+    CHECK_EQ(rb.free_space(), 4U);
+
+    CHECK(rb.push(1));
+    CHECK(rb.push(2));
+    CHECK(rb.push(3));
+    CHECK(rb.push(4));
+    CHECK(rb.is_full());
+    CHECK_FALSE(rb.push(5));
+
+    uint8_t value = 0;
+    CHECK(rb.pop(value));
+    CHECK_EQ(value, 1);
+    CHECK_EQ(rb.size(), 3U);
+
+    // 折り返し
+    CHECK(rb.push(5));
+    for (uint8_t expected = 2; expected <= 5; ++expected) {
+        REQUIRE(rb.pop(value));
+        CHECK_EQ(value, expected);
+    }
+
+    CHECK(rb.is_empty());
+    CHECK_FALSE(rb.pop(value));
+}
+
+TEST_CASE("RingBuffer - 一括操作") {
+    RingBuffer<uint8_t, 8> rb;
+    uint8_t out[8] = {};
+
+    SUBCASE("空きが足りない場合は入る分だけ") {
+        const uint8_t data[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+        CHECK_EQ(rb.push(span<const uint8_t>(data, 10)), 8U);
+        CHECK(rb.is_full());
+        CHECK_EQ(rb.pop(span<uint8_t>(out, 3)), 3U);
+        CHECK_EQ(out[0], 1);
+        CHECK_EQ(out[2], 3);
+    }
+
+    SUBCASE("折り返しをまたぐ") {
+        const uint8_t first[] = {1, 2, 3, 4, 5, 6};
+        const uint8_t second[] = {7, 8, 9, 10, 11};
+        CHECK_EQ(rb.push(span<const uint8_t>(first, 6)), 6U);
+        CHECK_EQ(rb.pop(span<uint8_t>(out, 5)), 5U);
+        CHECK_EQ(rb.push(span<const uint8_t>(second, 5)), 5U);
+
+        CHECK_EQ(rb.pop(span<uint8_t>(out, 8)), 6U);
+        for (uint8_t i = 0; i < 6; ++i) {
+            CHECK_EQ(out[i], i + 6);
+        }
+    }
+}
+
+TEST_CASE("RingBuffer - 連続領域") {
+    RingBuffer<uint8_t, 8> rb;
+
+    SUBCASE("write_region / commit") {
+        auto region = rb.write_region();
+        REQUIRE_EQ(region.size(), 8U);
+        region[0] = 'a';
+        region[1] = 'b';
+        rb.commit(2);
+        CHECK_EQ(rb.size(), 2U);
+    }
+
+    SUBCASE("折り返し位置で分割される") {
+        const uint8_t data[] = {1, 2, 3, 4, 5, 6};
+        uint8_t out[6] = {};
+        rb.push(span<const uint8_t>(data, 6));
+        rb.pop(span<uint8_t>(out, 6));
+        rb.push(span<const uint8_t>(data, 5)); // 位置6〜7と0〜2
+
+        auto first = rb.read_region();
+        REQUIRE_EQ(first.size(), 2U);
+        CHECK_EQ(first[0], 1);
+        rb.consume(2);
+
+        auto second = rb.read_region();
+        REQUIRE_EQ(second.size(), 3U);
+        CHECK_EQ(second[0], 3);
+        rb.consume(3);
+        CHECK(rb.is_empty());
+
+        // 書き込み側も折り返し位置までの空きを返す
+        CHECK_EQ(rb.write_region().size(), 5U);
+    }
+
+    SUBCASE("peek は折り返し位置をまたいで取り出さずにコピー") {
+        const uint8_t data[] = {1, 2, 3, 4, 5, 6};
+        uint8_t out[6] = {};
+        rb.push(span<const uint8_t>(data, 6));
+        rb.pop(span<uint8_t>(out, 6));
+        rb.push(span<const uint8_t>(data, 5));
+
+        uint8_t copy[8] = {};
+        CHECK_EQ(rb.peek(span<uint8_t>(copy, 8)), 5U);
+        CHECK_EQ(copy[0], 1);
+        CHECK_EQ(copy[4], 5);
+        CHECK_EQ(rb.size(), 5U);
+    }
+
+    SUBCASE("clear") {
+        rb.push(1);
+        rb.push(2);
+        rb.clear();
+        CHECK(rb.is_empty());
+        CHECK_EQ(rb.read_region().size(), 0U);
+    }
+}
+
+TEST_CASE("RingBuffer - インデックスのオーバーフロー") {
+    RingBuffer<uint32_t, 4> rb;
+    uint32_t value = 0;
+
+    // uint32_t のインデックスが一周しても正しく動作する
+    for (uint32_t i = 0; i < 70000; ++i) {
+        REQUIRE(rb.push(i));
+        REQUIRE(rb.pop(value));
+        REQUIRE_EQ(value, i);
+    }
+}
+
+TEST_CASE("RingBuffer - 生産者と消費者のスレッド") {
+    static RingBuffer<uint32_t, 64> rb;
+    constexpr uint32_t COUNT = 200000;
+
+    std::thread producer([] {
+        uint32_t next = 0;
+        uint32_t chunk[7];
+        while (next < COUNT) {
+            uint32_t n = 0;
+            while (n < 7 && next + n < COUNT) {
+                chunk[n] = next + n;
+                ++n;
+            }
+            next += rb.push(span<const uint32_t>(chunk, n));
+        }
+    });
+
+    uint32_t expected = 0;
+    bool in_order = true;
+    uint32_t out[16];
+    while (expected < COUNT) {
+        const uint32_t n = rb.pop(span<uint32_t>(out, 16));
+        for (uint32_t i = 0; i < n; ++i) {
+            in_order = in_order && (out[i] == expected);
+            ++expected;
+        }
+    }
+
+    producer.join();
+    CHECK(in_order);
+    CHECK(rb.is_empty());
+}
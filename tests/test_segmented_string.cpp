@@ -0,0 +1,225 @@
+// SegmentedString<SegmentSize> の単体テスト
+
+#define DOCTEST_CONFIG_NO_EXCEPTIONS
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <omusubi/core/segmented_string.hpp>
+
+#include "doctest.h"
+
+#include <cstring>
+
+using namespace omusubi;
+using namespace std::literals;
+
+namespace {
+
+template <uint32_t SegmentSize>
+bool content_equals(const SegmentedString<SegmentSize>& str, std::string_view expected) {
+    char buffer[256] = {};
+    const uint32_t copied = str.copy_to(span<char>(buffer, sizeof(buffer)));
+    return std::string_view(buffer, copied) == expected;
+}
+
+// 書き込まれたテキストを記録する（limit バイトを超えた分は受け付けない）
+class TextSink : public TextWritable {
+public:
+    size_t write_text(span<const char> text) override {
+        const size_t space = limit - length;
+        const size_t n = (text.size() < space) ? text.size() : space;
+        std::memcpy(data_ + length, text.data(), n);
+        length += n;
+        return n;
+    }
+
+    size_t write_textv(span<const span<const char>> parts) override {
+        ++gathers;
+        return TextWritable::write_textv(parts);
+    }
+
+    [[nodiscard]] std::string_view written() const noexcept { return std::string_view(data_, length); }
+
+    size_t length = 0;
+    size_t limit = sizeof(data_);
+    uint32_t gathers = 0;
+
+private:
+    char data_[256] = {};
+};
+
+} // namespace
+
+TEST_CASE("SegmentPool - 取得と返却") {
+    SegmentPool<8, 3> pool;
+    CHECK_EQ(pool.capacity(), 3U);
+    CHECK_EQ(pool.available(), 3U);
+    CHECK_EQ(pool.segment_size(), 8U);
+
+    auto* a = pool.acquire();
+    auto* b = pool.acquire();
+    auto* c = pool.acquire();
+    REQUIRE(a != nullptr);
+    REQUIRE(b != nullptr);
+    REQUIRE(c != nullptr);
+    CHECK(pool.acquire() == nullptr);
+    CHECK_EQ(pool.available(), 0U);
+
+    a->next = b;
+    pool.release(a);
+    CHECK_EQ(pool.available(), 2U);
+    pool.release(c);
+    CHECK_EQ(pool.available(), 3U);
+}
+
+TEST_CASE("SegmentedString - 基本機能") {
+    SegmentPool<8, 4> pool;
+    SegmentedString<8> str(pool);
+
+    CHECK(str.is_empty());
+    CHECK_EQ(str.segment_count(), 0U);
+    CHECK_EQ(str.remaining(), 32U);
+
+    SUBCASE("1セグメントに収まる") {
+        CHECK(str.append("abc"sv));
+        CHECK(str.append('d'));
+        CHECK(str.append("ef"));
+        CHECK_EQ(str.byte_length(), 6U);
+        CHECK_EQ(str.segment_count(), 1U);
+        CHECK(content_equals(str, "abcdef"sv));
+    }
+
+    SUBCASE("セグメント境界をまたぐ") {
+        CHECK(str.append("0123456"sv));
+        CHECK(str.append("789abcdefghij"sv));
+        CHECK_EQ(str.byte_length(), 20U);
+        CHECK_EQ(str.segment_count(), 3U);
+        CHECK_EQ(pool.available(), 1U);
+        CHECK(content_equals(str, "0123456789abcdefghij"sv));
+    }
+
+    SUBCASE("空文字列はセグメントを消費しない") {
+        CHECK(str.append(""sv));
+        CHECK_EQ(str.segment_count(), 0U);
+    }
+}
+
+TEST_CASE("SegmentedString - スキャッタリスト") {
+    SegmentPool<4, 4> pool;
+    SegmentedString<4> str(pool);
+    CHECK(str.append("Hello, World"sv));
+
+    SUBCASE("to_scatter_list") {
+        span<const char> parts[4];
+        const uint32_t count = str.to_scatter_list(span<span<const char>>(parts));
+        REQUIRE_EQ(count, 3U);
+        CHECK_EQ(std::string_view(parts[0].data(), parts[0].size()), "Hell"sv);
+        CHECK_EQ(std::string_view(parts[1].data(), parts[1].size()), "o, W"sv);
+        CHECK_EQ(std::string_view(parts[2].data(), parts[2].size()), "orld"sv);
+    }
+
+    SUBCASE("出力先が足りない場合") {
+        span<const char> parts[2];
+        CHECK_EQ(str.to_scatter_list(span<span<const char>>(parts)), 2U);
+    }
+
+    SUBCASE("write_textv() にそのまま渡せる") {
+        span<const char> parts[4];
+        const uint32_t count = str.to_scatter_list(span<span<const char>>(parts));
+        TextSink sink;
+        CHECK_EQ(sink.write_textv(span<const span<const char>>(parts, count)), 12U);
+        CHECK_EQ(sink.written(), "Hello, World"sv);
+    }
+
+    SUBCASE("範囲for") {
+        uint32_t count = 0;
+        uint32_t total = 0;
+        for (std::string_view part : str) {
+            ++count;
+            total += static_cast<uint32_t>(part.size());
+        }
+        CHECK_EQ(count, 3U);
+        CHECK_EQ(total, 12U);
+    }
+
+    SUBCASE("copy_to の切り詰め") {
+        char buffer[6] = {};
+        CHECK_EQ(str.copy_to(span<char>(buffer)), 6U);
+        CHECK_EQ(std::string_view(buffer, 6), "Hello,"sv);
+    }
+}
+
+TEST_CASE("SegmentedString - write_to()") {
+    SegmentPool<4, 32> pool;
+    SegmentedString<4> str(pool);
+    for (uint32_t i = 0; i < 20; ++i) {
+        CHECK(str.append("abcd"sv));
+    }
+    REQUIRE_EQ(str.segment_count(), 20U);
+
+    SUBCASE("WRITE_BATCH 個ずつ write_textv() に渡す") {
+        TextSink sink;
+        CHECK_EQ(str.write_to(sink), 80U);
+        CHECK_EQ(sink.gathers, 2U);
+        CHECK(content_equals(str, sink.written()));
+    }
+
+    SUBCASE("書き込みが不足したら終了") {
+        TextSink sink;
+        sink.limit = 10;
+        CHECK_EQ(str.write_to(sink), 10U);
+        CHECK_EQ(sink.gathers, 1U);
+    }
+}
+
+TEST_CASE("SegmentedString - 容量制限") {
+    SegmentPool<4, 2> pool;
+    SegmentedString<4> str(pool);
+
+    CHECK(str.append("abcde"sv));
+    CHECK_EQ(str.remaining(), 3U);
+
+    // 収まらない場合は何も追加しない
+    CHECK_FALSE(str.append("fghi"sv));
+    CHECK_EQ(str.byte_length(), 5U);
+    CHECK(content_equals(str, "abcde"sv));
+
+    CHECK(str.append("fgh"sv));
+    CHECK_EQ(str.remaining(), 0U);
+    CHECK_FALSE(str.append('x'));
+}
+
+TEST_CASE("SegmentedString - プールの共有と返却") {
+    SegmentPool<4, 4> pool;
+
+    {
+        SegmentedString<4> a(pool);
+        SegmentedString<4> b(pool);
+        CHECK(a.append("12345678"sv));
+        CHECK_EQ(b.remaining(), 8U);
+        CHECK(b.append("abcd"sv));
+        CHECK_EQ(pool.available(), 1U);
+
+        a.clear();
+        CHECK(a.is_empty());
+        CHECK_EQ(pool.available(), 3U);
+    }
+
+    // デストラクタで全セグメントが返却される
+    CHECK_EQ(pool.available(), 4U);
+}
+
+TEST_CASE("SegmentedString - ムーブ") {
+    SegmentPool<4, 4> pool;
+    SegmentedString<4> a(pool);
+    CHECK(a.append("abcdef"sv));
+
+    SegmentedString<4> b(static_cast<SegmentedString<4>&&>(a));
+    CHECK(a.is_empty());
+    CHECK_EQ(b.byte_length(), 6U);
+    CHECK(content_equals(b, "abcdef"sv));
+
+    SegmentedString<4> c(pool);
+    CHECK(c.append("xyz"sv));
+    c = static_cast<SegmentedString<4>&&>(b);
+    CHECK(content_equals(c, "abcdef"sv));
+    CHECK_EQ(pool.available(), 2U);
+}
@@ -0,0 +1,190 @@
+// TimerWheel<T, MaxTimers> の単体テスト
+
+#define DOCTEST_CONFIG_NO_EXCEPTIONS
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <omusubi/core/timer_wheel.hpp>
+
+#include "doctest.h"
+
+using namespace omusubi;
+
+namespace {
+
+uint32_t next_random(uint32_t& state) {
+    state = state * 1664525U + 1013904223U;
+    return state >> 8;
+}
+
+} // namespace
+
+TEST_CASE("is_time_before - ラップアラウンド") {
+    CHECK(is_time_before(1, 2));
+    CHECK_FALSE(is_time_before(2, 2));
+    CHECK(is_time_before(0xFFFFFFF0U, 0x10));
+    CHECK_FALSE(is_time_before(0x10, 0xFFFFFFF0U));
+    CHECK(is_time_reached(0x10, 0xFFFFFFF0U));
+    CHECK(is_time_reached(5, 5));
+}
+
+TEST_CASE("TimerWheel - 基本機能") {
+    TimerWheel<uint32_t, 8> timers(1000);
+    uint32_t fired[8] = {};
+    uint32_t fired_count = 0;
+    auto record = [&](uint32_t& id) { fired[fired_count++] = id; };
+
+    CHECK(timers.schedule(1000, 250, 1).is_ok());
+    CHECK(timers.schedule(1000, 100, 2).is_ok());
+    CHECK(timers.schedule(1000, 5000, 3).is_ok());
+    CHECK_EQ(timers.size(), 3U);
+
+    CHECK_EQ(timers.advance(1099, record), 0U);
+    CHECK_EQ(timers.advance(1100, record), 1U);
+    CHECK_EQ(fired[0], 2U);
+
+    CHECK_EQ(timers.advance(1300, record), 1U);
+    CHECK_EQ(fired[1], 1U);
+
+    CHECK_EQ(timers.advance(5999, record), 0U);
+    CHECK_EQ(timers.advance(6000, record), 1U);
+    CHECK_EQ(fired[2], 3U);
+    CHECK(timers.is_empty());
+}
+
+TEST_CASE("TimerWheel - キャンセルとハンドルの世代") {
+    TimerWheel<uint32_t, 2> timers;
+    uint32_t fired_count = 0;
+    auto count = [&](uint32_t&) { ++fired_count; };
+
+    auto a = timers.schedule(0, 10, 1);
+    auto b = timers.schedule(0, 20, 2);
+    REQUIRE(a.is_ok());
+    REQUIRE(b.is_ok());
+
+    auto full = timers.schedule(0, 30, 3);
+    REQUIRE(full.is_err());
+    CHECK_EQ(full.error(), Error::BUFFER_FULL);
+
+    auto expiry = timers.expiry(a.value());
+    REQUIRE(expiry.is_ok());
+    CHECK_EQ(expiry.value(), 10U);
+    CHECK(timers.cancel(a.value()));
+    CHECK_FALSE(timers.cancel(a.value()));
+    CHECK(timers.expiry(a.value()).is_err());
+
+    // 同じスロットを再利用しても古いハンドルは無効
+    auto c = timers.schedule(0, 15, 4);
+    REQUIRE(c.is_ok());
+    CHECK_EQ(c.value().index(), a.value().index());
+    CHECK_FALSE(timers.cancel(a.value()));
+    CHECK(timers.is_active(c.value()));
+
+    CHECK_EQ(timers.advance(100, count), 2U);
+    CHECK_EQ(fired_count, 2U);
+    CHECK_FALSE(timers.is_active(b.value()));
+    CHECK_FALSE(timers.cancel(TimerHandle {}));
+}
+
+TEST_CASE("TimerWheel - コールバック内での再登録") {
+    TimerWheel<uint32_t, 4> timers;
+    uint32_t fired_count = 0;
+    uint32_t now = 0;
+
+    CHECK(timers.schedule(0, 250, 0).is_ok());
+
+    auto retransmit = [&](uint32_t& attempt) {
+        ++fired_count;
+        if (attempt < 3) {
+            CHECK(timers.schedule(now, 250, attempt + 1).is_ok());
+        }
+    };
+
+    for (now = 0; now <= 2000; now += 10) {
+        timers.advance(now, retransmit);
+    }
+
+    CHECK_EQ(fired_count, 4U);
+    CHECK(timers.is_empty());
+}
+
+TEST_CASE("TimerWheel - get_uptime_ms のラップアラウンド") {
+    const uint32_t start = 0xFFFFFF00U;
+    TimerWheel<uint32_t, 4> timers(start);
+    uint32_t fired_count = 0;
+    auto count = [&](uint32_t&) { ++fired_count; };
+
+    CHECK(timers.schedule(start, 0x200, 1).is_ok()); // 0x100 で発火
+    CHECK_EQ(timers.advance(0xFFFFFFFFU, count), 0U);
+    CHECK_EQ(timers.advance(0xFFU, count), 0U);
+    CHECK_EQ(timers.advance(0x100U, count), 1U);
+}
+
+TEST_CASE("TimerWheel - 長時間の停止後に呼ばれても全タイマーが発火する") {
+    TimerWheel<uint32_t, 4> timers;
+    uint32_t fired_count = 0;
+    auto count = [&](uint32_t&) { ++fired_count; };
+
+    CHECK(timers.schedule(0, 10, 1).is_ok());
+    CHECK(timers.schedule(0, 3600000, 2).is_ok()); // 1時間
+    CHECK(timers.schedule(0, 0x7FFFFFFFU, 3).is_ok()); // 約24.8日
+
+    CHECK_EQ(timers.advance(3599999, count), 1U);
+    CHECK_EQ(timers.advance(3600000, count), 1U);
+    CHECK_EQ(timers.advance(0x7FFFFFFEU, count), 0U);
+    CHECK_EQ(timers.advance(0x7FFFFFFFU, count), 1U);
+}
+
+TEST_CASE("TimerWheel - ランダム操作を全走査の参照実装と比較") {
+    constexpr uint16_t MAX_TIMERS = 64;
+    uint32_t state = 2024;
+
+    for (uint32_t start : {0U, 0xFFFF0000U, 0x7FFFFF00U}) {
+        TimerWheel<uint32_t, MAX_TIMERS> timers(start);
+        TimerHandle handles[MAX_TIMERS];
+        uint32_t expiries[MAX_TIMERS] = {};
+        bool active[MAX_TIMERS] = {};
+        uint32_t now = start;
+        bool fired_ok = true;
+
+        for (uint32_t step = 0; step < 20000; ++step) {
+            const uint32_t op = next_random(state) % 10;
+
+            if (op < 4) {
+                uint32_t id = next_random(state) % MAX_TIMERS;
+                if (!active[id]) {
+                    // 短い遅延を中心に、まれに長い遅延を混ぜる
+                    const uint32_t r = next_random(state);
+                    const uint32_t delay = (r % 16 == 0) ? (r % 5000000) : (r % 2000);
+                    auto result = timers.schedule(now, delay, id);
+                    REQUIRE(result.is_ok());
+                    handles[id] = result.value();
+                    expiries[id] = now + delay;
+                    active[id] = true;
+                }
+            } else if (op < 5) {
+                const uint32_t id = next_random(state) % MAX_TIMERS;
+                CHECK_EQ(timers.cancel(handles[id]), active[id]);
+                active[id] = false;
+            } else {
+                const uint32_t r = next_random(state);
+                now += (r % 64 == 0) ? (r % 1000000) : (r % 50);
+
+                timers.advance(now, [&](uint32_t& id) {
+                    // 期限前の発火・二重発火の検出
+                    if (!active[id] || !is_time_reached(now, expiries[id])) {
+                        fired_ok = false;
+                    }
+                    active[id] = false;
+                });
+
+                // 期限を過ぎたタイマーが残っていないこと
+                for (uint32_t id = 0; id < MAX_TIMERS; ++id) {
+                    if (active[id] && is_time_reached(now, expiries[id])) {
+                        fired_ok = false;
+                    }
+                }
+            }
+
+            REQUIRE(fired_ok);
+        }
+    }
+}
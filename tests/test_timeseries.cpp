@@ -0,0 +1,190 @@
+// TimestampEncoder / XorFloatEncoder の単体テスト
+
+#define DOCTEST_CONFIG_NO_EXCEPTIONS
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <omusubi/core/timeseries.hpp>
+
+#include "doctest.h"
+
+#include <cmath>
+#include <cstring>
+
+using namespace omusubi;
+
+namespace {
+
+template <typename T>
+bool same_bits(T a, T b) {
+    return std::memcmp(&a, &b, sizeof(T)) == 0;
+}
+
+} // namespace
+
+TEST_CASE("timeseries - 時刻の delta-of-delta") {
+    SUBCASE("一定周期は1サンプル1ビット") {
+        FixedBuffer<64> buffer;
+        TimestampEncoder encoder(buffer);
+        for (uint32_t i = 0; i < 100; ++i) {
+            CHECK(encoder.append(1000 + i * 10));
+        }
+        CHECK_EQ(encoder.count(), 100U);
+
+        auto size = encoder.finish();
+        REQUIRE(size.is_ok());
+        // 先頭32ビット + 初回の差分（'110' + 9ビット）+ 98ビット
+        CHECK_EQ(size.value(), (32U + 12U + 98U + 7U) / 8U);
+        CHECK_EQ(encoder.count(), 0U);
+
+        TimestampDecoder decoder(span<const uint8_t>(buffer.data(), buffer.size()), 100);
+        uint32_t mismatches = 0;
+        for (uint32_t i = 0; i < 100; ++i) {
+            auto t = decoder.next();
+            if (!t.is_ok() || t.value() != 1000 + i * 10) {
+                ++mismatches;
+            }
+        }
+        CHECK_EQ(mismatches, 0U);
+        auto end = decoder.next();
+        CHECK_EQ(end.error(), Error::BUFFER_EMPTY);
+    }
+
+    SUBCASE("各区間の境界とラップアラウンド") {
+        const int32_t dods[] = {0, 1, -1, 64, -63, 65, -64, 256, -255, 257, 2048, -2047, 2049, -2048, 100000, -100000, 0};
+        uint32_t timestamps[sizeof(dods) / sizeof(dods[0]) + 2];
+        timestamps[0] = 0xFFFFFF00U;
+        timestamps[1] = 0xFFFFFF10U;
+        uint32_t delta = 0x10;
+        for (size_t i = 0; i < sizeof(dods) / sizeof(dods[0]); ++i) {
+            delta += static_cast<uint32_t>(dods[i]);
+            timestamps[i + 2] = timestamps[i + 1] + delta;
+        }
+
+        FixedBuffer<128> buffer;
+        TimestampEncoder encoder(buffer);
+        for (const uint32_t t : timestamps) {
+            encoder.append(t);
+        }
+        auto size = encoder.finish();
+        REQUIRE(size.is_ok());
+
+        TimestampDecoder decoder(span<const uint8_t>(buffer.data(), buffer.size()), sizeof(timestamps) / sizeof(timestamps[0]));
+        for (const uint32_t expected : timestamps) {
+            auto t = decoder.next();
+            REQUIRE(t.is_ok());
+            CHECK_EQ(t.value(), expected);
+        }
+    }
+
+    SUBCASE("finish後は新しいブロック") {
+        FixedBuffer<64> buffer;
+        TimestampEncoder encoder(buffer);
+        encoder.append(5);
+        encoder.append(7);
+        auto first = encoder.finish();
+        REQUIRE(first.is_ok());
+        encoder.append(9);
+        auto second = encoder.finish();
+        REQUIRE(second.is_ok());
+        CHECK_EQ(second.value(), 4U);
+
+        TimestampDecoder decoder(span<const uint8_t>(buffer.data() + first.value(), second.value()), 1);
+        auto t = decoder.next();
+        CHECK_EQ(t.value(), 9U);
+    }
+
+    SUBCASE("容量不足と途中で終わる入力") {
+        FixedBuffer<4> buffer;
+        TimestampEncoder encoder(buffer);
+        CHECK(encoder.append(1));
+        CHECK_FALSE(encoder.append(1000000));
+        auto size = encoder.finish();
+        CHECK_EQ(size.error(), Error::BUFFER_FULL);
+
+        const uint8_t data[] = {0, 0, 0, 1, 0xC0};
+        TimestampDecoder decoder(span<const uint8_t>(data, sizeof(data)), 2);
+        auto first = decoder.next();
+        CHECK_EQ(first.value(), 1U);
+        auto truncated = decoder.next();
+        CHECK_EQ(truncated.error(), Error::BUFFER_EMPTY);
+    }
+}
+
+TEST_CASE("timeseries - 浮動小数点数の XOR 符号化") {
+    SUBCASE("float の往復") {
+        float values[200];
+        for (uint32_t i = 0; i < 200; ++i) {
+            values[i] = 9.80665F + 0.05F * std::sin(static_cast<float>(i) * 0.1F);
+        }
+        values[50] = values[49];
+        values[100] = -0.0F;
+        values[101] = std::nanf("");
+        values[102] = INFINITY;
+
+        FixedBuffer<1024> buffer;
+        XorFloatEncoder encoder(buffer);
+        for (const float v : values) {
+            CHECK(encoder.append(v));
+        }
+        auto size = encoder.finish();
+        REQUIRE(size.is_ok());
+        CHECK_LT(size.value(), sizeof(values));
+
+        XorFloatDecoder decoder(span<const uint8_t>(buffer.data(), buffer.size()), 200);
+        uint32_t mismatches = 0;
+        for (const float expected : values) {
+            auto v = decoder.next();
+            if (!v.is_ok() || !same_bits(v.value(), expected)) {
+                ++mismatches;
+            }
+        }
+        CHECK_EQ(mismatches, 0U);
+        CHECK_EQ(decoder.remaining(), 0U);
+    }
+
+    SUBCASE("同じ値の繰り返しは1ビット") {
+        FixedBuffer<64> buffer;
+        XorFloatEncoder encoder(buffer);
+        for (uint32_t i = 0; i < 81; ++i) {
+            encoder.append(1.5F);
+        }
+        auto size = encoder.finish();
+        REQUIRE(size.is_ok());
+        CHECK_EQ(size.value(), (32U + 80U) / 8U);
+    }
+
+    SUBCASE("double の往復") {
+        const double values[] = {0.0, 1.0, 1.0000001, -2.5, 1e300, -1e-300, 3.141592653589793, 3.141592653589793};
+        FixedBuffer<256> buffer;
+        XorFloatEncoder<256, double> encoder(buffer);
+        for (const double v : values) {
+            encoder.append(v);
+        }
+        auto size = encoder.finish();
+        REQUIRE(size.is_ok());
+
+        XorFloatDecoder<double> decoder(span<const uint8_t>(buffer.data(), buffer.size()), 8);
+        for (const double expected : values) {
+            auto v = decoder.next();
+            REQUIRE(v.is_ok());
+            CHECK(same_bits(v.value(), expected));
+        }
+    }
+
+    SUBCASE("不正な入力") {
+        // 2番目の値が範囲の記述なしに '10' で始まる
+        const uint8_t no_window[] = {0x3F, 0x80, 0x00, 0x00, 0x80};
+        XorFloatDecoder decoder(span<const uint8_t>(no_window, sizeof(no_window)), 2);
+        auto first = decoder.next();
+        CHECK_EQ(first.value(), 1.0F);
+        auto second = decoder.next();
+        CHECK_EQ(second.error(), Error::INVALID_DATA);
+
+        // 先頭の0ビット数31 + 有効ビット長32
+        const uint8_t too_wide[] = {0x3F, 0x80, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00};
+        XorFloatDecoder wide(span<const uint8_t>(too_wide, sizeof(too_wide)), 2);
+        auto head = wide.next();
+        CHECK(head.is_ok());
+        auto invalid = wide.next();
+        CHECK_EQ(invalid.error(), Error::INVALID_DATA);
+    }
+}
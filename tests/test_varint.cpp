@@ -0,0 +1,114 @@
+// LEB128 可変長整数と ZigZag 符号化の単体テスト
+
+#define DOCTEST_CONFIG_NO_EXCEPTIONS
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <omusubi/core/varint.hpp>
+
+#include "doctest.h"
+
+#include <cstring>
+#include <limits>
+
+using namespace omusubi;
+
+TEST_CASE("varint - ZigZag符号化") {
+    CHECK_EQ(zigzag_encode(0), 0U);
+    CHECK_EQ(zigzag_encode(-1), 1U);
+    CHECK_EQ(zigzag_encode(1), 2U);
+    CHECK_EQ(zigzag_encode(-2), 3U);
+    CHECK_EQ(zigzag_encode(std::numeric_limits<int64_t>::max()), 0xFFFFFFFFFFFFFFFEULL);
+    CHECK_EQ(zigzag_encode(std::numeric_limits<int64_t>::min()), 0xFFFFFFFFFFFFFFFFULL);
+
+    const int64_t values[] = {0, 1, -1, 63, -64, 1000000, -1000000, std::numeric_limits<int64_t>::max(), std::numeric_limits<int64_t>::min()};
+    for (const int64_t value : values) {
+        CHECK_EQ(zigzag_decode(zigzag_encode(value)), value);
+    }
+
+    static_assert(zigzag_encode(-3) == 5, "constexpr");
+}
+
+TEST_CASE("varint - LEB128符号化") {
+    SUBCASE("既知のバイト列") {
+        uint8_t out[VARINT_MAX_SIZE];
+        CHECK_EQ(encode_varint(0, out), 1U);
+        CHECK_EQ(out[0], 0x00);
+        CHECK_EQ(encode_varint(127, out), 1U);
+        CHECK_EQ(out[0], 0x7F);
+        CHECK_EQ(encode_varint(300, out), 2U);
+        CHECK_EQ(out[0], 0xAC);
+        CHECK_EQ(out[1], 0x02);
+        CHECK_EQ(encode_varint(~uint64_t {0}, out), 10U);
+        CHECK_EQ(out[9], 0x01);
+    }
+
+    SUBCASE("varint_size") {
+        CHECK_EQ(varint_size(0), 1U);
+        CHECK_EQ(varint_size(127), 1U);
+        CHECK_EQ(varint_size(128), 2U);
+        CHECK_EQ(varint_size(16383), 2U);
+        CHECK_EQ(varint_size(16384), 3U);
+        CHECK_EQ(varint_size(~uint64_t {0}), VARINT_MAX_SIZE);
+    }
+
+    SUBCASE("容量不足では何も追加しない") {
+        FixedBuffer<3> buffer;
+        CHECK(append_varint(buffer, 300));
+        CHECK_FALSE(append_varint(buffer, 300));
+        CHECK_EQ(buffer.size(), 2U);
+        CHECK(append_signed_varint(buffer, -1));
+        CHECK_EQ(buffer[2], 0x01);
+    }
+}
+
+TEST_CASE("varint - VarintReader") {
+    SUBCASE("往復") {
+        FixedBuffer<256> buffer;
+        const uint64_t values[] = {0, 1, 127, 128, 300, 0xFFFFFFFFULL, 0x123456789ABCDEFULL, ~uint64_t {0}};
+        for (const uint64_t value : values) {
+            CHECK(append_varint(buffer, value));
+        }
+        CHECK(append_signed_varint(buffer, -123456));
+
+        VarintReader reader {span<const uint8_t>(buffer.data(), buffer.size())};
+        for (const uint64_t value : values) {
+            auto result = reader.read_unsigned();
+            REQUIRE(result.is_ok());
+            CHECK_EQ(result.value(), value);
+        }
+        auto signed_value = reader.read_signed();
+        REQUIRE(signed_value.is_ok());
+        CHECK_EQ(signed_value.value(), -123456);
+        CHECK(reader.is_end());
+
+        auto end = reader.read_unsigned();
+        CHECK_EQ(end.error(), Error::BUFFER_EMPTY);
+    }
+
+    SUBCASE("途中で終わる値は位置を進めない") {
+        const uint8_t data[] = {0x05, 0xAC};
+        VarintReader reader {span<const uint8_t>(data, sizeof(data))};
+        auto first = reader.read_unsigned();
+        CHECK_EQ(first.value(), 5U);
+        auto truncated = reader.read_unsigned();
+        CHECK_EQ(truncated.error(), Error::BUFFER_EMPTY);
+        CHECK_EQ(reader.position(), 1U);
+        CHECK_EQ(reader.remaining(), 1U);
+    }
+
+    SUBCASE("64ビットを超える値は不正") {
+        uint8_t overflow[VARINT_MAX_SIZE];
+        std::memset(overflow, 0xFF, sizeof(overflow));
+        overflow[9] = 0x02;
+        VarintReader reader {span<const uint8_t>(overflow, sizeof(overflow))};
+        auto result = reader.read_unsigned();
+        CHECK_EQ(result.error(), Error::INVALID_DATA);
+
+        uint8_t too_long[11];
+        std::memset(too_long, 0x80, sizeof(too_long));
+        too_long[10] = 0x00;
+        VarintReader long_reader {span<const uint8_t>(too_long, sizeof(too_long))};
+        auto long_result = long_reader.read_unsigned();
+        CHECK_EQ(long_result.error(), Error::INVALID_DATA);
+        CHECK_EQ(long_reader.position(), 0U);
+    }
+}
@@ -0,0 +1,120 @@
+// ByteWritable / TextWritable のギャザー書き込みの単体テスト
+
+#define DOCTEST_CONFIG_NO_EXCEPTIONS
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <omusubi/output/serial_log_output.hpp>
+
+#include "doctest.h"
+
+#include <cstring>
+
+using namespace omusubi;
+using namespace std::literals;
+
+namespace {
+
+// 書き込み呼び出しを記録するシリアル（limit_ バイトで書き込みが頭打ちになる）
+class RecordingSerial : public SerialContext {
+public:
+    explicit RecordingSerial(size_t limit = sizeof(buffer_)) noexcept : limit_(limit) {}
+
+    size_t read(span<uint8_t>) override { return 0; }
+
+    [[nodiscard]] size_t available() const override { return 0; }
+
+    size_t read_line(span<char>) override { return 0; }
+
+    size_t write(span<const uint8_t> data) override { return append(as_chars(data)); }
+
+    size_t write_text(span<const char> text) override { return append(text); }
+
+    [[nodiscard]] bool connect() override { return true; }
+
+    [[nodiscard]] bool disconnect() override { return true; }
+
+    [[nodiscard]] bool is_connected() const override { return true; }
+
+    [[nodiscard]] std::string_view written() const noexcept { return std::string_view(buffer_, length_); }
+
+    uint32_t calls = 0;
+
+private:
+    size_t append(span<const char> data) noexcept {
+        ++calls;
+        const size_t room = limit_ - length_;
+        const size_t n = (data.size() < room) ? data.size() : room;
+        std::memcpy(buffer_ + length_, data.data(), n);
+        length_ += n;
+        return n;
+    }
+
+    char buffer_[128] {};
+    size_t length_ = 0;
+    size_t limit_;
+};
+
+// ギャザー書き込みを1回の呼び出しで処理する実装
+class GatherSerial : public RecordingSerial {
+public:
+    size_t writev(span<const span<const uint8_t>> buffers) override {
+        ++gather_calls;
+        return RecordingSerial::writev(buffers);
+    }
+
+    uint32_t gather_calls = 0;
+};
+
+} // namespace
+
+TEST_CASE("ByteWritable::writev - デフォルト実装") {
+    RecordingSerial serial;
+    const uint8_t header[] = {'H', ':'};
+    const uint8_t payload[] = {'a', 'b', 'c'};
+    const uint8_t crc[] = {'!'};
+    const span<const uint8_t> buffers[] = {span<const uint8_t>(header), span<const uint8_t>(payload), span<const uint8_t>(crc)};
+
+    CHECK_EQ(serial.writev(span<const span<const uint8_t>>(buffers)), 6U);
+    CHECK_EQ(serial.written(), "H:abc!"sv);
+    CHECK_EQ(serial.calls, 3U);
+}
+
+TEST_CASE("ByteWritable::writev - 書き込み不足で中断") {
+    RecordingSerial serial(4);
+    const uint8_t a[] = {1, 2, 3};
+    const uint8_t b[] = {4, 5, 6};
+    const uint8_t c[] = {7};
+    const span<const uint8_t> buffers[] = {span<const uint8_t>(a), span<const uint8_t>(b), span<const uint8_t>(c)};
+
+    CHECK_EQ(serial.writev(span<const span<const uint8_t>>(buffers)), 4U);
+    CHECK_EQ(serial.calls, 2U); // 3番目のバッファは書き込まない
+}
+
+TEST_CASE("ByteWritable::writev - オーバーライド") {
+    GatherSerial serial;
+    ByteWritable& writable = serial;
+    const uint8_t data[] = {'x'};
+    const span<const uint8_t> buffers[] = {span<const uint8_t>(data)};
+
+    CHECK_EQ(writable.writev(span<const span<const uint8_t>>(buffers)), 1U);
+    CHECK_EQ(serial.gather_calls, 1U);
+}
+
+TEST_CASE("TextWritable::write_textv - デフォルト実装") {
+    RecordingSerial serial;
+    const span<const char> parts[] = {span<const char>("temp=", 5), span<const char>("25", 2)};
+
+    CHECK_EQ(serial.write_textv(span<const span<const char>>(parts)), 7U);
+    CHECK_EQ(serial.written(), "temp=25"sv);
+}
+
+TEST_CASE("SerialLogOutput - プレフィックスとメッセージを個別に送信") {
+    RecordingSerial serial;
+    SerialLogOutput output(&serial);
+
+    output.write(LogLevel::WARNING, "battery low"sv);
+    CHECK_EQ(serial.written(), "[WARN] battery low\r\n"sv);
+    CHECK_EQ(serial.calls, 5U);
+
+    SerialLogOutput disabled(nullptr);
+    disabled.write(LogLevel::INFO, "ignored"sv);
+}